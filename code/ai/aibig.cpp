@@ -101,6 +101,7 @@ void ai_bpap(object *objp, vec3d *attacker_objp_pos, vec3d *attacker_objp_fvec,
 
 	vm_vec_zero(local_attack_point);
 
+	model_finish_pending_loads();
 	auto collision_tree = model_get_bsp_collision_tree(pm->submodel[pm->detail[0]].collision_tree_index);
 
 	if (!collision_tree->poly_centers.empty()) {
@@ -54,6 +54,7 @@
 #include "object/deadobjectdock.h"
 #include "object/objcollide.h"
 #include "object/object.h"
+#include "object/objectbounds.h"
 #include "object/objectdock.h"
 #include "object/objectshield.h"
 #include "object/waypoint.h"
@@ -2305,8 +2306,17 @@ int get_nearest_objnum(int objnum, int enemy_team_mask, int enemy_wing, float ra
 	eno.nearest_objnum = -1;
 	eno.check_danger_weapon_objnum = 0;
 
+	// The distance to fighters is halved and big ships measure to their bounding box so anything further away than
+	// this can never be picked. Checking that first avoids touching the data of far away ships.
+	const vec3d& search_pos = Obj_bounds.pos[objnum];
+	const float max_center_dist = 2.0f * range;
+
 	// go through the list of all ships and evaluate as potential targets
 	for ( so = GET_FIRST(&Ship_obj_list); so != END_OF_LIST(&Ship_obj_list); so = GET_NEXT(so) ) {
+		const float reach = max_center_dist + 2.0f * Obj_bounds.radius[so->objnum];
+		if (vm_vec_dist_squared(&search_pos, &Obj_bounds.pos[so->objnum]) > reach * reach)
+			continue;
+
 		if (Objects[so->objnum].flags[Object::Object_Flags::Should_be_dead])
 			continue;
 
@@ -2367,6 +2377,11 @@ int find_nearby_threat(int objnum, int enemy_team_mask, float range, int *count)
 	*count = 0;
 
 	for ( so = GET_FIRST(&Ship_obj_list); so != END_OF_LIST(&Ship_obj_list); so = GET_NEXT(so) ) {
+		// check the distance first, it only needs the bounds table
+		float dist = vm_vec_dist_quick(&Obj_bounds.pos[objnum], &Obj_bounds.pos[so->objnum]) - Obj_bounds.radius[so->objnum]*0.75f;
+		if (dist >= range)
+			continue;
+
 		objp = &Objects[so->objnum];
 		if (objp->flags[Object::Object_Flags::Should_be_dead])
 			continue;
@@ -2379,17 +2394,11 @@ int find_nearby_threat(int objnum, int enemy_team_mask, float range, int *count)
                 continue;
 
 			if (iff_matches_mask(Ships[objp->instance].team, enemy_team_mask)) {
-				float	dist;
-
-				dist = vm_vec_dist_quick(&Objects[objnum].pos, &objp->pos) - objp->radius*0.75f;
-				
-				if (dist < range) {
-					(*count)++;
+				(*count)++;
 
-					if (dist < nearest_dist) {
-						nearest_dist = dist;
-						nearest_objnum = OBJ_INDEX(objp);
-					}
+				if (dist < nearest_dist) {
+					nearest_dist = dist;
+					nearest_objnum = OBJ_INDEX(objp);
 				}
 			}
 		}
@@ -5864,7 +5873,8 @@ void set_primary_weapon_linkage(object *objp)
 
 	shipp = &Ships[objp->instance];
 
-	if (Num_weapons > (int) (MAX_WEAPONS * 0.75f)) {
+	// weapons can only run out of object slots now that the weapon pool grows
+	if (Num_objects > (int) (MAX_OBJECTS * 0.75f)) {
 		if (shipp->flags[Ship::Ship_Flags::Primary_linked]) {
 			nprintf(("AI", "Frame %i, ship %s: Unlinking primaries.\n", Framecount, shipp->ship_name));
 			shipp->flags.remove(Ship::Ship_Flags::Primary_linked);
@@ -6137,8 +6147,8 @@ int ai_fire_primary_weapon(object *objp)
 
 	aip = &Ai_info[shipp->ai_index];
 
-	//	If low on slots, fire a little less often.
-	if (Num_weapons > (int) (0.9f * MAX_WEAPONS)) {
+	//	If low on object slots, fire a little less often.
+	if (Num_objects > (int) (0.9f * MAX_OBJECTS)) {
 		if (frand() > 0.5f) {
 			nprintf(("AI", "Frame %i, %s not fire.\n", Framecount, shipp->ship_name));
 			return 0;
@@ -6286,6 +6296,9 @@ int num_nearby_fighters(int enemy_team_mask, vec3d *pos, float threshold)
 	int		count = 0;
 
 	for ( so = GET_FIRST(&Ship_obj_list); so != END_OF_LIST(&Ship_obj_list); so = GET_NEXT(so) ) {
+		// check the distance first, it only needs the bounds table
+		if (vm_vec_dist_quick(pos, &Obj_bounds.pos[so->objnum]) >= threshold)
+			continue;
 
 		ship_objp = &Objects[so->objnum];
 		if (ship_objp->flags[Object::Object_Flags::Should_be_dead])
@@ -6293,8 +6306,7 @@ int num_nearby_fighters(int enemy_team_mask, vec3d *pos, float threshold)
 
 		if (iff_matches_mask(Ships[ship_objp->instance].team, enemy_team_mask)) {
 			if (Ship_info[Ships[ship_objp->instance].ship_info_index].is_fighter_bomber()) {
-				if (vm_vec_dist_quick(pos, &ship_objp->pos) < threshold)
-					count++;
+				count++;
 			}
 		}
 	}
@@ -11974,6 +11986,9 @@ void ai_process_subobjects(int objnum)
 	polymodel_instance *pmi = model_get_instance(shipp->model_instance_num);
 	polymodel *pm = model_get(pmi->model_num);
 
+	// the turrets share the list of possible targets, which is gathered again for every ship since objects have moved
+	ai_turret_reset_target_candidates();
+
 	for ( pss = GET_FIRST(&shipp->subsys_list); pss !=END_OF_LIST(&shipp->subsys_list); pss = GET_NEXT(pss) ) {
 		auto psub = pss->system_info;
 
@@ -14341,7 +14356,7 @@ static int ai_find_shockwave_weapon(const object *objp)
 			continue;
 
 		Assert(A->type == OBJ_WEAPON);
-		Assert((A->instance >= 0) && (A->instance < MAX_WEAPONS));
+		Assert((A->instance >= 0) && (A->instance < Weapons.capacity()));
 		wp = &Weapons[A->instance];
 		wip = &Weapon_info[wp->weapon_info_index];
 		Assert( wip->subtype == WP_MISSILE );
@@ -34,4 +34,7 @@ bool check_los(int objnum, int target_objnum, float threshold, int primary_bank,
 //Does all the stuff needed to aim and fire a turret.
 void ai_turret_execute_behavior(ship *shipp, ship_subsys *ss);
 
+//Forgets the possible turret targets gathered for the last ship.  Called before the turrets of a ship are processed.
+void ai_turret_reset_target_candidates();
+
 #endif
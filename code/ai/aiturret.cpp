@@ -13,10 +13,12 @@
 #include "math/staticrand.h"
 #include "network/multi.h"
 #include "network/multimsgs.h"
+#include "object/objcollide.h"
 #include "object/objectdock.h"
 #include "scripting/global_hooks.h"
 #include "scripting/scripting.h"
 #include "render/3d.h"
+#include "tracing/tracing.h"
 #include "ship/ship.h"
 #include "ship/shipfx.h"
 #include "utils/Random.h"
@@ -64,6 +66,8 @@ const char *Turret_target_order_names[NUM_TURRET_ORDER_TYPES] = {
 #define EEOF_LASER			(1<<5)	// turret is a laser
 #define EEOF_MISSILE		(1<<6)	// turret is a missile
 
+#define EEOF_CANDIDATE		(1<<7)	// object comes from the turret candidate list, so the parent ship checks were already done
+
 const char* Turret_valid_types[NUM_TURRET_TYPES] = {
 	"Beam",
 	"Flak",
@@ -487,6 +491,140 @@ int valid_turret_enemy(object *objp, object *turret_parent)
 	return 0;
 }
 
+/**
+ * The checks of evaluate_obj_as_target() which only depend on the parent ship of the turret
+ */
+static bool turret_parent_may_target(object *objp, object *turret_parent, int enemy_team_mask, int weapon_system_ok)
+{
+	// Don't look for bombs when weapon system is not ok
+	if (objp->type == OBJ_WEAPON && !weapon_system_ok) {
+		return false;
+	}
+
+	if ( !valid_turret_enemy(objp, turret_parent) ) {
+		return false;
+	}
+
+	// check on enemy team
+	if ( (objp->type == OBJ_SHIP) && !iff_matches_mask(Ships[objp->instance].team, enemy_team_mask) ) {
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * The objects the turrets of one ship may shoot at.
+ *
+ * Every turret used to walk the missile, ship and asteroid lists on its own and repeat all the checks which only depend
+ * on the parent ship.  Now the first turret of a ship which looks for a target gathers the objects passing those checks
+ * and the other turrets of the ship only score what is left.  The lists keep the order of the object lists so ties are
+ * broken the same way as before.
+ */
+typedef struct turret_candidate_list {
+	int parent_objnum = -1;
+	int parent_signature = -1;
+	int enemy_team_mask = 0;
+	int weapon_system_ok = 0;
+
+	struct candidate {
+		int objnum;
+		int signature;
+	};
+
+	SCP_vector<candidate> bombs;		// bombs and interceptable weapons from Missile_obj_list
+	SCP_vector<candidate> ships;
+	SCP_vector<candidate> asteroids;	// only the asteroids which are about to hit the parent
+
+	// positions and radii of the ships, packed so the range test of a turret is a tight loop
+	SCP_vector<float> ship_x, ship_y, ship_z, ship_radius;
+} turret_candidate_list;
+
+static turret_candidate_list Turret_candidates;
+
+// per turret scratch space for the range test
+static SCP_vector<float> Turret_candidate_dist;
+
+void ai_turret_reset_target_candidates()
+{
+	Turret_candidates.parent_objnum = -1;
+}
+
+static const turret_candidate_list *turret_get_target_candidates(int turret_parent_objnum, int enemy_team_mask, int weapon_system_ok)
+{
+	auto tcl = &Turret_candidates;
+	auto parent_objp = &Objects[turret_parent_objnum];
+
+	if (tcl->parent_objnum == turret_parent_objnum && tcl->parent_signature == parent_objp->signature
+		&& tcl->enemy_team_mask == enemy_team_mask && tcl->weapon_system_ok == weapon_system_ok) {
+		return tcl;
+	}
+
+	TRACE_SCOPE(tracing::GatherTurretTargets);
+
+	tcl->parent_objnum = turret_parent_objnum;
+	tcl->parent_signature = parent_objp->signature;
+	tcl->enemy_team_mask = enemy_team_mask;
+	tcl->weapon_system_ok = weapon_system_ok;
+
+	tcl->bombs.clear();
+	tcl->ships.clear();
+	tcl->asteroids.clear();
+	tcl->ship_x.clear();
+	tcl->ship_y.clear();
+	tcl->ship_z.clear();
+	tcl->ship_radius.clear();
+
+	for (auto mo : list_range(&Missile_obj_list)) {
+		auto objp = &Objects[mo->objnum];
+		if (objp->flags[Object::Object_Flags::Should_be_dead])
+			continue;
+
+		Assert(objp->type == OBJ_WEAPON);
+		auto wip = &Weapon_info[Weapons[objp->instance].weapon_info_index];
+		if (!(wip->wi_flags[Weapon::Info_Flags::Bomb]) && !(wip->wi_flags[Weapon::Info_Flags::Turret_Interceptable]))
+			continue;
+
+		if (turret_parent_may_target(objp, parent_objp, enemy_team_mask, weapon_system_ok))
+			tcl->bombs.push_back({ mo->objnum, objp->signature });
+	}
+
+	for (auto so : list_range(&Ship_obj_list)) {
+		auto objp = &Objects[so->objnum];
+		if (objp->flags[Object::Object_Flags::Should_be_dead])
+			continue;
+
+		if (turret_parent_may_target(objp, parent_objp, enemy_team_mask, weapon_system_ok)) {
+			tcl->ships.push_back({ so->objnum, objp->signature });
+			tcl->ship_x.push_back(objp->pos.xyz.x);
+			tcl->ship_y.push_back(objp->pos.xyz.y);
+			tcl->ship_z.push_back(objp->pos.xyz.z);
+			tcl->ship_radius.push_back(objp->radius);
+		}
+	}
+
+	// asteroids are only ever picked when they are going to hit the parent
+	for (auto ao : list_range(&Asteroid_obj_list)) {
+		auto objp = &Objects[ao->objnum];
+		if (objp->flags[Object::Object_Flags::Should_be_dead])
+			continue;
+
+		if (asteroid_collide_objnum(objp) == turret_parent_objnum && turret_parent_may_target(objp, parent_objp, enemy_team_mask, weapon_system_ok))
+			tcl->asteroids.push_back({ ao->objnum, objp->signature });
+	}
+
+	return tcl;
+}
+
+/**
+ * Checks that a candidate was not destroyed or replaced since the candidates were gathered
+ */
+static inline bool turret_candidate_valid(const turret_candidate_list::candidate &c)
+{
+	auto objp = &Objects[c.objnum];
+	return objp->signature == c.signature && !(objp->flags[Object::Object_Flags::Should_be_dead]);
+}
+
 extern int Player_attacking_enabled;
 void evaluate_obj_as_target(object *objp, eval_enemy_obj_struct *eeo)
 {
@@ -496,12 +634,7 @@ void evaluate_obj_as_target(object *objp, eval_enemy_obj_struct *eeo)
 	float dist, dist_comp;
 	bool turret_has_no_target = false;
 
-	// Don't look for bombs when weapon system is not ok
-	if (objp->type == OBJ_WEAPON && !eeo->weapon_system_ok) {
-		return;
-	}
-
-	if ( !valid_turret_enemy(objp, turret_parent_obj) ) {
+	if ( !(eeo->eeo_flags & EEOF_CANDIDATE) && !turret_parent_may_target(objp, turret_parent_obj, eeo->enemy_team_mask, eeo->weapon_system_ok) ) {
 		return;
 	}
 
@@ -515,11 +648,6 @@ void evaluate_obj_as_target(object *objp, eval_enemy_obj_struct *eeo)
 		shipp = &Ships[objp->instance];
 		ship_info* sip = &Ship_info[shipp->ship_info_index];
 
-		// check on enemy team
-		if ( !iff_matches_mask(shipp->team, eeo->enemy_team_mask) ) {
-			return;
-		}
-
 		// check if protected
 		if (objp->flags[Object::Object_Flags::Protected]) {
 			return;
@@ -777,10 +905,6 @@ int get_nearest_turret_objnum(int turret_parent_objnum, ship_subsys *turret_subs
 	eval_enemy_obj_struct eeo;
 	ship_weapon *swp = &turret_subsys->weapons;
 
-	// list of stuff to go thru
-	ship_obj		*so;
-	missile_obj *mo;
-
 	//wip=&Weapon_info[tp->turret_weapon_type];
 	//weapon_travel_dist = MIN(wip->lifetime * wip->max_speed, wip->weapon_range);
 
@@ -978,6 +1102,10 @@ int get_nearest_turret_objnum(int turret_parent_objnum, ship_subsys *turret_subs
 		}
 	} else 
     {
+		// everything below only looks at objects which passed the checks of the parent ship
+		auto candidates = turret_get_target_candidates(turret_parent_objnum, enemy_team_mask, weapon_system_ok);
+		eeo.eeo_flags |= EEOF_CANDIDATE;
+
         flagset<Weapon::Info_Flags> tmp_flagset;
         const Weapon::Info_Flags weapon_flags[] = { Weapon::Info_Flags::Huge, Weapon::Info_Flags::Flak, Weapon::Info_Flags::Homing_aspect, Weapon::Info_Flags::Homing_heat, Weapon::Info_Flags::Homing_javelin, Weapon::Info_Flags::Spawn };
         tmp_flagset.set_multiple(std::begin(weapon_flags), std::end(weapon_flags));
@@ -996,17 +1124,10 @@ int get_nearest_turret_objnum(int turret_parent_objnum, ship_subsys *turret_subs
 					//don't fire anti capital ship turrets at bombs.
 					if ( !((aip->ai_profile_flags[AI::Profile_Flags::Huge_turret_weapons_ignore_bombs]) && big_only_flag) )
 					{
-						// Missile_obj_list
-						for( mo = GET_FIRST(&Missile_obj_list); mo != END_OF_LIST(&Missile_obj_list); mo = GET_NEXT(mo) ) {
-							auto objp = &Objects[mo->objnum];
-							if (objp->flags[Object::Object_Flags::Should_be_dead])
-								continue;
-
-							Assert(objp->type == OBJ_WEAPON);
-							if ((Weapon_info[Weapons[objp->instance].weapon_info_index].wi_flags[Weapon::Info_Flags::Bomb]) || (Weapon_info[Weapons[objp->instance].weapon_info_index].wi_flags[Weapon::Info_Flags::Turret_Interceptable]))
-							{
-								evaluate_obj_as_target(objp, &eeo);
-							}
+						// bombs from Missile_obj_list
+						for (const auto &c : candidates->bombs) {
+							if (turret_candidate_valid(c))
+								evaluate_obj_as_target(&Objects[c.objnum], &eeo);
 						}
 						// highest priority
 						if ( eeo.nearest_homing_bomb_objnum != -1 ) {					// highest priority is an incoming homing bomb
@@ -1020,11 +1141,25 @@ int get_nearest_turret_objnum(int turret_parent_objnum, ship_subsys *turret_subs
 				case 1:
 					//Return if a ship is found
 					// Ship_used_list
-					for ( so = GET_FIRST(&Ship_obj_list); so != END_OF_LIST(&Ship_obj_list); so = GET_NEXT(so) ) {
-						auto objp = &Objects[so->objnum];
-						if (objp->flags[Object::Object_Flags::Should_be_dead])
-							continue;
-						evaluate_obj_as_target(objp, &eeo);
+					{
+						// A ship is only picked if it is within range of the turret weapons, so do a range test over
+						// the packed positions first and only score the ships which pass it.
+						auto num_ships = candidates->ships.size();
+						Turret_candidate_dist.resize(num_ships);
+
+						const float tx = tpos->xyz.x, ty = tpos->xyz.y, tz = tpos->xyz.z;
+						for (size_t i = 0; i < num_ships; ++i) {
+							float dx = candidates->ship_x[i] - tx;
+							float dy = candidates->ship_y[i] - ty;
+							float dz = candidates->ship_z[i] - tz;
+							Turret_candidate_dist[i] = sqrtf(dx * dx + dy * dy + dz * dz) - candidates->ship_radius[i];
+						}
+
+						float max_dist = eeo.weapon_travel_dist + COLLISION_PREFILTER_SLACK;
+						for (size_t i = 0; i < num_ships; ++i) {
+							if (Turret_candidate_dist[i] < max_dist && turret_candidate_valid(candidates->ships[i]))
+								evaluate_obj_as_target(&Objects[candidates->ships[i].objnum], &eeo);
+						}
 					}
 
 					// next highest priority is attacking ship
@@ -1036,7 +1171,6 @@ int get_nearest_turret_objnum(int turret_parent_objnum, ship_subsys *turret_subs
 				case 2:
 					//Return if an asteroid is found
 					// asteroid check - taylor
-					asteroid_obj *ao;
 
 					// don't use turrets that are better for other things:
 					// - no cap ship beams
@@ -1050,11 +1184,9 @@ int get_nearest_turret_objnum(int turret_parent_objnum, ship_subsys *turret_subs
                     
 					if ( !all_turret_weapons_have_flags(swp, tmp_flagset) ) {
 						// Asteroid_obj_list
-						for ( ao = GET_FIRST(&Asteroid_obj_list); ao != END_OF_LIST(&Asteroid_obj_list); ao = GET_NEXT(ao) ) {
-							auto objp = &Objects[ao->objnum];
-							if (objp->flags[Object::Object_Flags::Should_be_dead])
-								continue;
-							evaluate_obj_as_target(objp, &eeo);
+						for (const auto &c : candidates->asteroids) {
+							if (turret_candidate_valid(c))
+								evaluate_obj_as_target(&Objects[c.objnum], &eeo);
 						}
 
 						if (eeo.nearest_objnum != -1) {
@@ -25,12 +25,15 @@
 #include "localization/localize.h"
 #include "math/staticrand.h"
 #include "math/vecmat.h"
+#include "mod_table/mod_table.h"
 #include "model/model.h"
+#include "model/modelrender.h"
 #include "network/multi.h"
 #include "network/multimsgs.h"
 #include "network/multiutil.h"
 #include "object/objcollide.h"
 #include "object/object.h"
+#include "object/objectbounds.h"
 #include "parse/parselo.h"
 #include "scripting/global_hooks.h"
 #include "particle/particle.h"
@@ -39,6 +42,8 @@
 #include "ship/shipfx.h"
 #include "ship/shiphit.h"
 #include "stats/scoring.h"
+#include "tracing/tracing.h"
+#include "weapon/beam.h"
 #include "weapon/weapon.h"
 
 #include <algorithm>
@@ -83,6 +88,19 @@ typedef struct asteroid_target {
 // if not, then this is whatever number of mission-specified ships (after they arrive, list is sanitized when they exit)
 SCP_vector<asteroid_target> Asteroid_targets;
 
+#define	ASTEROID_FIELD_ROCK_SCAN_TIMESTAMP	250		// how often field rocks are checked against ships and weapons
+#define	ASTEROID_FIELD_ROCK_PROMOTE_DIST	500.0f	// rocks this close to a ship or weapon become asteroid objects
+#define	ASTEROID_FIELD_ROCK_DEMOTE_DIST		1000.0f	// asteroids this far from all ships and weapons become rocks again
+
+// how close an asteroid is to the nearest ship or weapon during a scan
+#define	ASTEROID_NEAR_NONE		0
+#define	ASTEROID_NEAR_DEMOTE	1	// too close to become a rock again
+#define	ASTEROID_NEAR_PROMOTE	2	// close enough that it would become an asteroid right away if it was a rock
+
+static asteroid_field_rocks Field_rocks;
+static TIMESTAMP Field_rocks_scan_stamp;
+static fix Field_rocks_path_check_time;	// weapons fired since then haven't been checked against the rocks yet
+
 
 /**
  * Return number of asteroids expected to collide with a ship.
@@ -263,9 +281,12 @@ static void inner_bound_pos_fixup(asteroid_field *asfieldp, vec3d *pos)
 }
 
 /**
- * Create a single asteroid 
+ * Create a single asteroid
+ *
+ * @param rock If not -1, the field rock which becomes this asteroid. Its position, motion and hull are used instead of
+ * random ones and the caller removes the rock afterwards.
  */
-object *asteroid_create(asteroid_field *asfieldp, int asteroid_type, int asteroid_subtype, bool check_visibility)
+static object *asteroid_create_internal(asteroid_field *asfieldp, int asteroid_type, int asteroid_subtype, bool check_visibility, int rock)
 {
 	int				n, objnum;
 	matrix			orient;
@@ -356,6 +377,10 @@ object *asteroid_create(asteroid_field *asfieldp, int asteroid_type, int asteroi
 		angs.h = static_randf( rand_base++ ) * PI2;
 	}
 
+	if (rock >= 0) {
+		pos = Field_rocks.pos[rock];
+	}
+
 	// If the generated asteroid position is within the player view then abort
 	// I'm unsure how Eyepoint is handled for multiplayer, so this may need to move up into the SP
 	// only section - Mjn
@@ -363,7 +388,11 @@ object *asteroid_create(asteroid_field *asfieldp, int asteroid_type, int asteroi
 		return nullptr;
 	}
 
-	vm_angles_2_matrix(&orient, &angs);
+	if (rock >= 0) {
+		orient = Field_rocks.orient[rock];
+	} else {
+		vm_angles_2_matrix(&orient, &angs);
+	}
     flagset<Object::Object_Flags> asteroid_default_flagset;
     asteroid_default_flagset += Object::Object_Flags::Renders;
     asteroid_default_flagset += Object::Object_Flags::Physics;
@@ -421,6 +450,11 @@ object *asteroid_create(asteroid_field *asfieldp, int asteroid_type, int asteroi
 	}
 	
 	vm_vec_scale(&objp->phys_info.vel, speed);
+
+	if (rock >= 0) {
+		objp->phys_info.rotvel = Field_rocks.rotvel[rock];
+		objp->phys_info.vel = Field_rocks.vel[rock];
+	}
 	objp->phys_info.desired_vel = objp->phys_info.vel;
 
 	// blow out his reverse thrusters. Or drag, same thing.
@@ -440,11 +474,15 @@ object *asteroid_create(asteroid_field *asfieldp, int asteroid_type, int asteroi
 	objp->phys_info.I_body_inv.vec.uvec.xyz.y = objp->phys_info.I_body_inv.vec.rvec.xyz.x;
 	objp->phys_info.I_body_inv.vec.fvec.xyz.z = objp->phys_info.I_body_inv.vec.rvec.xyz.x;
 	objp->hull_strength = asip->initial_asteroid_strength * (0.8f + (float)Game_skill_level/NUM_SKILL_LEVELS)/2.0f;
+	if (rock >= 0) {
+		objp->hull_strength = Field_rocks.hull[rock];
+	}
 
 	// ensure vel is valid
 	Assert( !vm_is_vec_nan(&objp->phys_info.vel) );	
 
-	if (scripting::hooks::OnAsteroidCreated->isActive()) {
+	// a rock becoming an object again is the same asteroid, scripts already saw it being created
+	if ((rock < 0) && scripting::hooks::OnAsteroidCreated->isActive()) {
 		scripting::hooks::OnAsteroidCreated->run(
 			scripting::hook_param_list(
 				scripting::hook_param("Asteroid", 'o', objp)));
@@ -453,6 +491,77 @@ object *asteroid_create(asteroid_field *asfieldp, int asteroid_type, int asteroi
 	return objp;
 }
 
+object *asteroid_create(asteroid_field *asfieldp, int asteroid_type, int asteroid_subtype, bool check_visibility)
+{
+	return asteroid_create_internal(asfieldp, asteroid_type, asteroid_subtype, check_visibility, -1);
+}
+
+/**
+ * Whether the pieces of a field of this type are kept as field rocks while nothing is close to them
+ */
+static bool asteroid_field_uses_rocks(field_type_t field_type)
+{
+	return Asteroid_field_rocks && (field_type == FT_PASSIVE) && (Game_mode & GM_NORMAL) && !Fred_running;
+}
+
+/**
+ * The number of pieces a field of this type may have
+ */
+int asteroid_field_max_count(field_type_t field_type)
+{
+	return asteroid_field_uses_rocks(field_type) ? MAX_ASTEROID_FIELD_ROCKS : MAX_ASTEROIDS;
+}
+
+/**
+ * Create a single field rock, placed and moving like asteroid_create() would do it
+ */
+static void asteroid_field_rock_create(asteroid_field *asfieldp, int asteroid_type, int asteroid_subtype)
+{
+	if ((asteroid_type < 0) || (asteroid_type >= (int)Asteroid_info.size())) {
+		return;
+	}
+
+	if ((asteroid_subtype < 0) || (asteroid_subtype >= NUM_ASTEROID_POFS)) {
+		return;
+	}
+
+	asteroid_info *asip = &Asteroid_info[asteroid_type];
+
+	if (asip->modelp[asteroid_subtype] == nullptr) {
+		return;
+	}
+
+	if (Field_rocks.size() >= MAX_ASTEROID_FIELD_ROCKS) {
+		nprintf(("Warning", "Could not create field rock, no more slots left\n"));
+		return;
+	}
+
+	vec3d pos, delta_bound;
+	vm_vec_sub(&delta_bound, &asfieldp->max_bound, &asfieldp->min_bound);
+	pos.xyz.x = asfieldp->min_bound.xyz.x + delta_bound.xyz.x * frand();
+	pos.xyz.y = asfieldp->min_bound.xyz.y + delta_bound.xyz.y * frand();
+	pos.xyz.z = asfieldp->min_bound.xyz.z + delta_bound.xyz.z * frand();
+	inner_bound_pos_fixup(asfieldp, &pos);
+
+	angles angs;
+	angs.p = frand() * PI2;
+	angs.b = frand() * PI2;
+	angs.h = frand() * PI2;
+
+	matrix orient;
+	vm_angles_2_matrix(&orient, &angs);
+
+	vec3d rotvel, vel;
+	vm_vec_rand_vec_quick(&rotvel);
+	vm_vec_scale(&rotvel, frand()/4.0f + 0.1f);
+	vm_vec_rand_vec_quick(&vel);
+	vm_vec_scale(&vel, asteroid_cap_speed(asteroid_type, asfieldp->speed*frand_range(0.5f + (float) Game_skill_level/NUM_SKILL_LEVELS, 2.0f + (float) (2*Game_skill_level)/NUM_SKILL_LEVELS)));
+
+	float hull = asip->initial_asteroid_strength * (0.8f + (float)Game_skill_level/NUM_SKILL_LEVELS)/2.0f;
+
+	Field_rocks.add(pos, vel, orient, rotvel, f2fl(Missiontime), model_get_radius(asip->model_num[asteroid_subtype]), hull, asteroid_type, asteroid_subtype);
+}
+
 /**
  * Create asteroids when parent_objp blows up.
  */
@@ -600,6 +709,15 @@ void asteroid_create_all()
 
 	int max_asteroids = Asteroid_field.num_initial_asteroids; // * (1.0f - 0.1f*(MAX_DETAIL_LEVEL-Detail.asteroid_density)));
 
+	// far away pieces of a passive field only become objects when something gets close to them
+	const bool use_rocks = asteroid_field_uses_rocks(Asteroid_field.field_type);
+	if (use_rocks) {
+		max_asteroids = MIN(max_asteroids, MAX_ASTEROID_FIELD_ROCKS);
+		Field_rocks.reserve(max_asteroids);
+		Field_rocks_scan_stamp = TIMESTAMP::immediate();
+		Field_rocks_path_check_time = Missiontime;
+	}
+
 	int num_debris_types = 0;
 
 	// get number of ship debris types
@@ -662,8 +780,12 @@ void asteroid_create_all()
 				}
 			}
 
-			if (subtype >= 0)
-				asteroid_create(&Asteroid_field, ASTEROID_TYPE_LARGE, subtype);
+			if (subtype >= 0) {
+				if (use_rocks)
+					asteroid_field_rock_create(&Asteroid_field, ASTEROID_TYPE_LARGE, subtype);
+				else
+					asteroid_create(&Asteroid_field, ASTEROID_TYPE_LARGE, subtype);
+			}
 		} else {
 			Assert(num_debris_types > 0);
 
@@ -672,7 +794,10 @@ void asteroid_create_all()
 			for (idx=0; idx<MAX_ACTIVE_DEBRIS_TYPES; idx++) {
 				// for ship debris, choose type according to odds table
 				if (rand_choice < ship_debris_odds_table[idx].random_threshold) {
-					asteroid_create(&Asteroid_field, ship_debris_odds_table[idx].debris_type, 0);
+					if (use_rocks)
+						asteroid_field_rock_create(&Asteroid_field, ship_debris_odds_table[idx].debris_type, 0);
+					else
+						asteroid_create(&Asteroid_field, ship_debris_odds_table[idx].debris_type, 0);
 					break;
 				}
 			}
@@ -693,6 +818,7 @@ void remove_all_asteroids()
 			Objects[Asteroids[i].objnum].flags.set(Object::Object_Flags::Should_be_dead);
 		}
 	}
+	Field_rocks.clear();
 	// This feels hackish, but we need to make sure all the asteroids are actually gone before we continue-Mjn
 	obj_delete_all_that_should_be_dead();
 }
@@ -864,6 +990,7 @@ void asteroid_level_init()
 		Num_asteroids = 0;
 		asteroid_obj_list_init();
 		Asteroid_targets.clear();
+		Field_rocks.clear();
 	}
 }
 
@@ -873,40 +1000,40 @@ void asteroid_level_init()
  *
  * @return !0 if asteroid should be wrapped, 0 otherwise.  
  */
-static int asteroid_should_wrap(object *objp, asteroid_field *asfieldp)
+static int asteroid_should_wrap(const vec3d *pos, asteroid_field *asfieldp)
 {
 	if ( MULTIPLAYER_CLIENT )
 		return 0;
 
-	if (objp->pos.xyz.x < asfieldp->min_bound.xyz.x) {
+	if (pos->xyz.x < asfieldp->min_bound.xyz.x) {
 		return 1;
 	}
 
-	if (objp->pos.xyz.y < asfieldp->min_bound.xyz.y) {
+	if (pos->xyz.y < asfieldp->min_bound.xyz.y) {
 		return 1;
 	}
 
-	if (objp->pos.xyz.z < asfieldp->min_bound.xyz.z) {
+	if (pos->xyz.z < asfieldp->min_bound.xyz.z) {
 		return 1;
 	}
 
-	if (objp->pos.xyz.x > asfieldp->max_bound.xyz.x) {
+	if (pos->xyz.x > asfieldp->max_bound.xyz.x) {
 		return 1;
 	}
 
-	if (objp->pos.xyz.y > asfieldp->max_bound.xyz.y) {
+	if (pos->xyz.y > asfieldp->max_bound.xyz.y) {
 		return 1;
 	}
 
-	if (objp->pos.xyz.z > asfieldp->max_bound.xyz.z) {
+	if (pos->xyz.z > asfieldp->max_bound.xyz.z) {
 		return 1;
 	}
 
 	// check against inner bound
 	if (asfieldp->has_inner_bound) {
-		if ( (objp->pos.xyz.x > asfieldp->inner_min_bound.xyz.x) && (objp->pos.xyz.x < asfieldp->inner_max_bound.xyz.x)
-		  && (objp->pos.xyz.y > asfieldp->inner_min_bound.xyz.y) && (objp->pos.xyz.y < asfieldp->inner_max_bound.xyz.y)
-		  && (objp->pos.xyz.z > asfieldp->inner_min_bound.xyz.z) && (objp->pos.xyz.z < asfieldp->inner_max_bound.xyz.z) ) {
+		if ( (pos->xyz.x > asfieldp->inner_min_bound.xyz.x) && (pos->xyz.x < asfieldp->inner_max_bound.xyz.x)
+		  && (pos->xyz.y > asfieldp->inner_min_bound.xyz.y) && (pos->xyz.y < asfieldp->inner_max_bound.xyz.y)
+		  && (pos->xyz.z > asfieldp->inner_min_bound.xyz.z) && (pos->xyz.z < asfieldp->inner_max_bound.xyz.z) ) {
 
 			return 1;
 		}
@@ -1144,7 +1271,7 @@ static void asteroid_maybe_reposition(object *objp, asteroid_field *asfieldp)
 		return;
 	}
 
-	if (asteroid_should_wrap(objp, asfieldp)) {
+	if (asteroid_should_wrap(&objp->pos, asfieldp)) {
 
 		// Generate a possible new position if we do end up wrapping, but don't move the asteroid yet
 		vec3d new_pos = objp->pos;
@@ -1757,6 +1884,8 @@ void asteroid_level_close()
 		}
 	}
 
+	Field_rocks.clear();
+
 	//when a level is closed, all models are cleared, so let's make sure that
 	//is tracked for asteroids as well -Mjn
 	for (int i = 0; i < (int)Asteroid_info.size(); i++) {
@@ -2571,8 +2700,522 @@ static int set_asteroid_throw_objnum()
 
 }
 
+/**
+ * Brings the orientation of a field rock up to the given mission time
+ */
+static void asteroid_field_rock_rotate(int rock, float now)
+{
+	float dt = now - Field_rocks.orient_time[rock];
+	if (dt <= 0.0f) {
+		return;
+	}
+
+	const vec3d& rotvel = Field_rocks.rotvel[rock];
+	angles tangles;
+	tangles.p = rotvel.xyz.x * dt;
+	tangles.h = rotvel.xyz.y * dt;
+	tangles.b = rotvel.xyz.z * dt;
+
+	matrix rotmat, tmp;
+	vm_angles_2_matrix(&rotmat, &tangles);
+	vm_matrix_x_matrix(&tmp, &Field_rocks.orient[rock], &rotmat);
+	Field_rocks.orient[rock] = tmp;
+	vm_orthogonalize_matrix(&Field_rocks.orient[rock]);
+
+	Field_rocks.orient_time[rock] = now;
+}
+
+/**
+ * Moves all field rocks, they fly ballistic like the asteroid objects of a passive field
+ */
+static void asteroid_field_rocks_move(float frametime)
+{
+	const bool has_gravity = !IS_VEC_NULL(&The_mission.gravity);
+
+	for (int i = 0; i < Field_rocks.size(); i++) {
+		vec3d* pos = &Field_rocks.pos[i];
+		vec3d* vel = &Field_rocks.vel[i];
+
+		vm_vec_scale_add2(pos, vel, frametime);
+
+		if (has_gravity) {
+			float gravity_const = Asteroid_info[Field_rocks.asteroid_type[i]].gravity_const;
+			vm_vec_scale_add2(pos, &The_mission.gravity, frametime * frametime * gravity_const * 0.5f);
+			vm_vec_scale_add2(vel, &The_mission.gravity, frametime * gravity_const);
+		}
+	}
+}
+
+/**
+ * Wraps a field rock which left the field, with the same rules asteroid_maybe_reposition() uses for a passive field
+ */
+static void asteroid_field_rock_maybe_wrap(int rock)
+{
+	vec3d* pos = &Field_rocks.pos[rock];
+
+	if (!asteroid_should_wrap(pos, &Asteroid_field)) {
+		return;
+	}
+
+	vec3d new_pos = *pos;
+	asteroid_wrap_pos(&new_pos, &Asteroid_field);
+
+	if (asteroid_is_within_view(pos, Asteroid_field.bound_rad, Asteroid_field.enhanced_visibility_checks)
+		|| asteroid_is_within_view(&new_pos, Asteroid_field.bound_rad * 1.3f, Asteroid_field.enhanced_visibility_checks)) {
+		return;
+	}
+
+	*pos = new_pos;
+}
+
+/**
+ * Whether an asteroid can go back to being a field rock without anyone noticing
+ */
+static bool asteroid_field_can_demote(object *asteroid_objp)
+{
+	asteroid *asp = &Asteroids[asteroid_objp->instance];
+
+	if (asteroid_objp->flags[Object::Object_Flags::Should_be_dead]) {
+		return false;
+	}
+
+	// breaking up, about to hit something or thrown at something
+	if (asp->final_death_time.isValid() || (asp->collide_objnum >= 0) || (asp->target_objnum >= 0)) {
+		return false;
+	}
+
+	return !asteroid_is_targeted(asteroid_objp);
+}
+
+/**
+ * Turns an asteroid back into a field rock
+ *
+ * @return @c false if there is no room for another field rock
+ */
+static bool asteroid_field_rock_demote(object *asteroid_objp, float now)
+{
+	if (Field_rocks.size() >= MAX_ASTEROID_FIELD_ROCKS) {
+		return false;
+	}
+
+	asteroid *asp = &Asteroids[asteroid_objp->instance];
+	Field_rocks.add(asteroid_objp->pos, asteroid_objp->phys_info.vel, asteroid_objp->orient, asteroid_objp->phys_info.rotvel, now, asteroid_objp->radius, asteroid_objp->hull_strength, asp->asteroid_type, asp->asteroid_subtype);
+	asteroid_objp->flags.set(Object::Object_Flags::Should_be_dead);
+
+	return true;
+}
+
+/**
+ * Calls func for every entry of order whose position is inside the box, order has to be sorted by x
+ */
+template <typename PosFunc, typename Func>
+static void asteroid_field_find_in_box(const SCP_vector<int>& order, PosFunc get_pos, const vec3d& box_min, const vec3d& box_max, Func func)
+{
+	auto it = std::lower_bound(order.begin(), order.end(), box_min.xyz.x,
+		[&get_pos](int entry, float x) { return get_pos(entry).xyz.x < x; });
+
+	for (; it != order.end(); ++it) {
+		const vec3d& pos = get_pos(*it);
+		if (pos.xyz.x > box_max.xyz.x) {
+			break;
+		}
+
+		if ((pos.xyz.y < box_min.xyz.y) || (pos.xyz.y > box_max.xyz.y) || (pos.xyz.z < box_min.xyz.z) || (pos.xyz.z > box_max.xyz.z)) {
+			continue;
+		}
+
+		func(*it);
+	}
+}
+
+/**
+ * Turns field rocks into asteroid objects, promote has to be sorted from the highest index down since removing a rock
+ * moves the last one into its slot
+ *
+ * @return How many rocks at the end of promote are still rocks because there were no asteroid or object slots left
+ */
+static int asteroid_field_rocks_promote(const SCP_vector<int>& promote, float now)
+{
+	for (size_t i = 0; i < promote.size(); i++) {
+		int rock = promote[i];
+		asteroid_field_rock_rotate(rock, now);
+
+		object *objp = asteroid_create_internal(&Asteroid_field, Field_rocks.asteroid_type[rock], Field_rocks.asteroid_subtype[rock], false, rock);
+		if (objp == nullptr) {
+			return static_cast<int>(promote.size() - i);
+		}
+
+		obj_bounds_update(objp);
+		Field_rocks.remove(rock);
+	}
+
+	return 0;
+}
+
+/**
+ * How fast a ship or weapon may get before the next scan, missiles speed up after launch
+ */
+static float asteroid_field_mover_speed(const object *objp)
+{
+	float speed = vm_vec_mag_quick(&objp->phys_info.vel);
+
+	if (objp->type == OBJ_WEAPON) {
+		speed = MAX(speed, Weapon_info[Weapons[objp->instance].weapon_info_index].max_speed);
+	}
+
+	return speed;
+}
+
+void asteroid_field_pick_demotions(const SCP_vector<float>& asteroid_dist, const SCP_vector<float>& rock_dist, SCP_vector<int>& demote)
+{
+	static SCP_vector<int> asteroid_order;
+	static SCP_vector<float> rock_order;
+
+	demote.clear();
+
+	asteroid_order.clear();
+	for (int i = 0; i < static_cast<int>(asteroid_dist.size()); i++) {
+		asteroid_order.push_back(i);
+	}
+	std::sort(asteroid_order.begin(), asteroid_order.end(),
+		[&asteroid_dist](int a, int b) { return asteroid_dist[a] > asteroid_dist[b]; });
+
+	rock_order.assign(rock_dist.begin(), rock_dist.end());
+	std::sort(rock_order.begin(), rock_order.end());
+
+	// the farthest asteroid makes room for the nearest rock, as long as the rock is the nearer one
+	for (size_t i = 0; (i < asteroid_order.size()) && (i < rock_order.size()); i++) {
+		if (asteroid_dist[asteroid_order[i]] <= rock_order[i]) {
+			break;
+		}
+
+		demote.push_back(asteroid_order[i]);
+	}
+}
+
+bool asteroid_field_rock_near_segment(const vec3d *pos, float radius, const vec3d *p0, const vec3d *p1, float dist)
+{
+	vec3d seg, rel;
+	vm_vec_sub(&seg, p1, p0);
+	vm_vec_sub(&rel, pos, p0);
+
+	float len_squared = vm_vec_mag_squared(&seg);
+	float t = (len_squared > 0.0f) ? vm_vec_dot(&rel, &seg) / len_squared : 0.0f;
+	CLAMP(t, 0.0f, 1.0f);
+
+	vec3d nearest;
+	vm_vec_scale_add(&nearest, p0, &seg, t);
+
+	float reach = radius + dist;
+	return vm_vec_dist_squared(&nearest, pos) <= reach * reach;
+}
+
+/**
+ * Turns field rocks along active beams and newly fired weapons into asteroid objects. A beam reaches across the field the
+ * moment it fires and a slashing beam sweeps across it, and a fast weapon fired right after a scan could cross the
+ * promote distance before the next one, so waiting for the next scan would let them pass through rocks.
+ *
+ * @return @c false if some rocks couldn't be promoted because there were no asteroid or object slots left
+ */
+static bool asteroid_field_rocks_promote_near_paths()
+{
+	static SCP_vector<ubyte> rock_promote;
+	static SCP_vector<int> promote;
+
+	const float interval = ASTEROID_FIELD_ROCK_SCAN_TIMESTAMP / 1000.0f;
+
+	rock_promote.clear();
+
+	for (object *objp : list_range(&obj_used_list)) {
+		if (objp->flags[Object::Object_Flags::Should_be_dead]) {
+			continue;
+		}
+
+		vec3d p0, p1;
+		float dist;
+
+		if (objp->type == OBJ_BEAM) {
+			const beam *bm = &Beams[objp->instance];
+			p0 = bm->last_start;
+			p1 = bm->last_shot;
+			dist = ASTEROID_FIELD_ROCK_PROMOTE_DIST + bm->beam_collide_width * 0.5f;
+		} else if ((objp->type == OBJ_WEAPON) && (Weapons[objp->instance].creation_time >= Field_rocks_path_check_time)) {
+			// only once, the scans cover it from then on
+			p0 = objp->pos;
+			vm_vec_scale_add(&p1, &objp->pos, &objp->orient.vec.fvec, asteroid_field_mover_speed(objp) * interval);
+			dist = ASTEROID_FIELD_ROCK_PROMOTE_DIST + objp->radius;
+		} else {
+			continue;
+		}
+
+		if (rock_promote.empty()) {
+			rock_promote.assign(Field_rocks.size(), 0);
+		}
+
+		vec3d box_min = p0;
+		vec3d box_max = p0;
+		for (int axis = 0; axis < 3; axis++) {
+			box_min.a1d[axis] = MIN(box_min.a1d[axis], p1.a1d[axis]);
+			box_max.a1d[axis] = MAX(box_max.a1d[axis], p1.a1d[axis]);
+		}
+
+		for (int i = 0; i < Field_rocks.size(); i++) {
+			const vec3d& pos = Field_rocks.pos[i];
+			const float reach = dist + Field_rocks.radius[i];
+
+			if ((pos.xyz.x < box_min.xyz.x - reach) || (pos.xyz.x > box_max.xyz.x + reach)
+				|| (pos.xyz.y < box_min.xyz.y - reach) || (pos.xyz.y > box_max.xyz.y + reach)
+				|| (pos.xyz.z < box_min.xyz.z - reach) || (pos.xyz.z > box_max.xyz.z + reach)) {
+				continue;
+			}
+
+			if (asteroid_field_rock_near_segment(&pos, Field_rocks.radius[i], &p0, &p1, dist)) {
+				rock_promote[i] = 1;
+			}
+		}
+	}
+
+	Field_rocks_path_check_time = Missiontime;
+
+	promote.clear();
+	for (int i = static_cast<int>(rock_promote.size()) - 1; i >= 0; i--) {
+		if (rock_promote[i]) {
+			promote.push_back(i);
+		}
+	}
+
+	return asteroid_field_rocks_promote(promote, f2fl(Missiontime)) == 0;
+}
+
+/**
+ * Distance from a piece of the field to the closest of the swept bounds of movers, less its radius
+ */
+static float asteroid_field_nearest_mover_dist(const SCP_vector<int>& movers, const vec3d *pos, float radius)
+{
+	float nearest = FLT_MAX;
+
+	for (int objnum : movers) {
+		vec3d outside = vmd_zero_vector;
+		for (int axis = 0; axis < 3; axis++) {
+			if (pos->a1d[axis] < Obj_bounds.sweep_min[objnum].a1d[axis]) {
+				outside.a1d[axis] = Obj_bounds.sweep_min[objnum].a1d[axis] - pos->a1d[axis];
+			} else if (pos->a1d[axis] > Obj_bounds.sweep_max[objnum].a1d[axis]) {
+				outside.a1d[axis] = pos->a1d[axis] - Obj_bounds.sweep_max[objnum].a1d[axis];
+			}
+		}
+
+		nearest = MIN(nearest, vm_vec_mag(&outside));
+	}
+
+	return nearest - radius;
+}
+
+/**
+ * Turns field rocks near ships, weapons and beams into asteroid objects and asteroids far away from all of them back
+ * into rocks. Both sets are sorted along x so each ship or weapon only looks at the pieces in its own slab.
+ *
+ * If there aren't enough slots for all rocks which have to become asteroids, the asteroids farthest from all ships and
+ * weapons are turned into rocks to make room, as long as they are farther away than the rocks waiting for their slots.
+ *
+ * @return @c true if asteroids were turned into rocks to make room, the waiting rocks can be promoted once they are gone
+ */
+static bool asteroid_field_rocks_scan()
+{
+	static SCP_vector<int> rock_order;
+	static SCP_vector<ubyte> rock_promote;
+	static SCP_vector<int> promote;
+	static SCP_vector<int> asteroid_order;
+	static SCP_vector<ubyte> asteroid_near;	// ASTEROID_NEAR_*
+	static SCP_vector<int> movers;
+	static SCP_vector<int> candidates;
+	static SCP_vector<float> candidate_dist;
+	static SCP_vector<float> waiting_dist;
+	static SCP_vector<int> demote;
+
+	const float interval = ASTEROID_FIELD_ROCK_SCAN_TIMESTAMP / 1000.0f;
+	const float now = f2fl(Missiontime);
+
+	// passive fields only wrap if there is gravity
+	const bool wrap = !IS_VEC_NULL(&The_mission.gravity);
+
+	float max_radius = 0.0f;
+	float max_speed = 0.0f;
+
+	rock_order.clear();
+	for (int i = 0; i < Field_rocks.size(); i++) {
+		if (wrap) {
+			asteroid_field_rock_maybe_wrap(i);
+		}
+
+		max_radius = MAX(max_radius, Field_rocks.radius[i]);
+		max_speed = MAX(max_speed, vm_vec_mag_quick(&Field_rocks.vel[i]));
+		rock_order.push_back(i);
+	}
+	std::sort(rock_order.begin(), rock_order.end(),
+		[](int a, int b) { return Field_rocks.pos[a].xyz.x < Field_rocks.pos[b].xyz.x; });
+	rock_promote.assign(rock_order.size(), 0);
+
+	asteroid_order.clear();
+	for (asteroid_obj *aop = GET_FIRST(&Asteroid_obj_list); aop != END_OF_LIST(&Asteroid_obj_list); aop = GET_NEXT(aop)) {
+		object *objp = &Objects[aop->objnum];
+
+		max_radius = MAX(max_radius, objp->radius);
+		max_speed = MAX(max_speed, vm_vec_mag_quick(&objp->phys_info.vel));
+		asteroid_order.push_back(aop->objnum);
+	}
+	std::sort(asteroid_order.begin(), asteroid_order.end(),
+		[](int a, int b) { return Objects[a].pos.xyz.x < Objects[b].pos.xyz.x; });
+	asteroid_near.assign(MAX_OBJECTS, ASTEROID_NEAR_NONE);
+
+	auto rock_pos = [](int rock) -> const vec3d& { return Field_rocks.pos[rock]; };
+	auto asteroid_pos = [](int objnum) -> const vec3d& { return Objects[objnum].pos; };
+
+	movers.clear();
+	for (object *objp : list_range(&obj_used_list)) {
+		if ((objp->type != OBJ_SHIP) && (objp->type != OBJ_WEAPON) && (objp->type != OBJ_BEAM)) {
+			continue;
+		}
+
+		if (objp->flags[Object::Object_Flags::Should_be_dead]) {
+			continue;
+		}
+
+		// far enough that neither side can cover the distance before the next scan
+		const int objnum = OBJ_INDEX(objp);
+		const float reach = (asteroid_field_mover_speed(objp) + max_speed) * interval + max_radius;
+		movers.push_back(objnum);
+
+		vec3d box_min, box_max;
+		vec3d promote_margin, demote_margin;
+		vm_vec_make(&promote_margin, ASTEROID_FIELD_ROCK_PROMOTE_DIST + reach, ASTEROID_FIELD_ROCK_PROMOTE_DIST + reach, ASTEROID_FIELD_ROCK_PROMOTE_DIST + reach);
+		vm_vec_make(&demote_margin, ASTEROID_FIELD_ROCK_DEMOTE_DIST + reach, ASTEROID_FIELD_ROCK_DEMOTE_DIST + reach, ASTEROID_FIELD_ROCK_DEMOTE_DIST + reach);
+
+		vm_vec_sub(&box_min, &Obj_bounds.sweep_min[objnum], &promote_margin);
+		vm_vec_add(&box_max, &Obj_bounds.sweep_max[objnum], &promote_margin);
+		asteroid_field_find_in_box(rock_order, rock_pos, box_min, box_max, [](int rock) { rock_promote[rock] = 1; });
+		asteroid_field_find_in_box(asteroid_order, asteroid_pos, box_min, box_max, [](int asteroid_objnum) { asteroid_near[asteroid_objnum] = ASTEROID_NEAR_PROMOTE; });
+
+		vm_vec_sub(&box_min, &Obj_bounds.sweep_min[objnum], &demote_margin);
+		vm_vec_add(&box_max, &Obj_bounds.sweep_max[objnum], &demote_margin);
+		asteroid_field_find_in_box(asteroid_order, asteroid_pos, box_min, box_max, [](int asteroid_objnum) { asteroid_near[asteroid_objnum] = MAX(asteroid_near[asteroid_objnum], (ubyte)ASTEROID_NEAR_DEMOTE); });
+	}
+
+	// highest first, removing a rock moves the last one into its slot
+	promote.clear();
+	for (int i = Field_rocks.size() - 1; i >= 0; i--) {
+		if (rock_promote[i]) {
+			promote.push_back(i);
+		}
+	}
+
+	const int waiting = asteroid_field_rocks_promote(promote, now);
+
+	// the rocks left waiting for a slot, removing the ones before them hasn't moved them
+	waiting_dist.clear();
+	for (int i = static_cast<int>(promote.size()) - waiting; i < static_cast<int>(promote.size()); i++) {
+		waiting_dist.push_back(asteroid_field_nearest_mover_dist(movers, &Field_rocks.pos[promote[i]], Field_rocks.radius[promote[i]]));
+	}
+
+	int demoted = 0;
+	candidates.clear();
+	candidate_dist.clear();
+	for (int objnum : asteroid_order) {
+		object *objp = &Objects[objnum];
+
+		if (!asteroid_field_can_demote(objp)) {
+			continue;
+		}
+
+		if (asteroid_near[objnum]) {
+			// those close enough to be promoted again would only take the slots back at the next scan
+			if ((waiting > 0) && (asteroid_near[objnum] == ASTEROID_NEAR_DEMOTE)) {
+				candidates.push_back(objnum);
+				candidate_dist.push_back(asteroid_field_nearest_mover_dist(movers, &objp->pos, objp->radius));
+			}
+			continue;
+		}
+
+		if (!asteroid_field_rock_demote(objp, now)) {
+			break;
+		}
+		demoted++;
+	}
+
+	// whatever is left over didn't free enough slots
+	if (waiting > demoted) {
+		// the slots freed already go to the nearest rocks
+		std::sort(waiting_dist.begin(), waiting_dist.end());
+		waiting_dist.erase(waiting_dist.begin(), waiting_dist.begin() + demoted);
+		asteroid_field_pick_demotions(candidate_dist, waiting_dist, demote);
+
+		for (int candidate : demote) {
+			if (!asteroid_field_rock_demote(&Objects[candidates[candidate]], now)) {
+				break;
+			}
+			demoted++;
+		}
+	}
+
+	return (waiting > 0) && (demoted > 0);
+}
+
+/**
+ * Draws all field rocks in view, called with the other objects from obj_render_queue_all()
+ */
+void asteroid_field_rocks_render(model_draw_list *scene)
+{
+	if (!Asteroids_enabled || (Field_rocks.size() == 0)) {
+		return;
+	}
+
+	TRACE_SCOPE(tracing::AsteroidFieldRocks);
+
+	const float now = f2fl(Missiontime);
+
+	model_render_params render_info;
+	render_info.set_flags(MR_IS_ASTEROID);
+
+	// model_render_queue() drops asteroids which are dimmed below 1/32 anyway
+	const float max_depth = render_info.get_depth_scale() * 32.0f;
+
+	for (int i = 0; i < Field_rocks.size(); i++) {
+		const vec3d* pos = &Field_rocks.pos[i];
+
+		if (vm_vec_dist_quick(pos, &Eye_position) > max_depth) {
+			continue;
+		}
+
+		if (!obj_sphere_in_view_cone(pos, Field_rocks.radius[i])) {
+			continue;
+		}
+
+		asteroid_field_rock_rotate(i, now);
+
+		int model_num = Asteroid_info[Field_rocks.asteroid_type[i]].model_num[Field_rocks.asteroid_subtype[i]];
+		model_clear_instance(model_num);
+		model_render_queue(&render_info, scene, model_num, &Field_rocks.orient[i], &Field_rocks.pos[i]);
+	}
+}
+
 void asteroid_frame()
 {
+	if (asteroid_field_uses_rocks(Asteroid_field.field_type) && ((Field_rocks.size() > 0) || (Num_asteroids > 0))) {
+		TRACE_SCOPE(tracing::AsteroidFieldRocks);
+
+		asteroid_field_rocks_move(flFrametime);
+
+		// the slots of asteroids turned into rocks are only free once they are deleted, try again next frame
+		if (timestamp_elapsed(Field_rocks_scan_stamp)) {
+			bool made_room = asteroid_field_rocks_scan();
+			Field_rocks_scan_stamp = made_room ? TIMESTAMP::immediate() : _timestamp(ASTEROID_FIELD_ROCK_SCAN_TIMESTAMP);
+			Field_rocks_path_check_time = Missiontime;
+		} else if (Field_rocks.size() > 0) {
+			if (!asteroid_field_rocks_promote_near_paths()) {
+				Field_rocks_scan_stamp = TIMESTAMP::immediate();
+			}
+		}
+	}
+
 	if (Num_asteroids < 1)
 		return;
 
@@ -22,6 +22,7 @@ struct collision_info_struct;
 class model_draw_list;
 
 #define	MAX_ASTEROIDS			2000	//Increased from 512 to 2000 in 2022
+#define	MAX_ASTEROID_FIELD_ROCKS	32768	// passive field pieces which are not objects, see $Use field rocks for passive asteroid fields:
 
 #define	NUM_ASTEROID_SIZES		3
 #define	NUM_ASTEROID_POFS		3				// Number of POFs per debris size
@@ -148,6 +149,85 @@ typedef	struct asteroid_field {
 	SCP_vector<SCP_string> target_names;	// default retail behavior is to just throw at the first big ship in the field
 } asteroid_field;
 
+// Pieces of a passive field which are too far from ships and weapons to be hit by them. They are not objects, they
+// only move and get drawn. Kept as separate arrays because moving and culling them only reads a few of the values.
+// The orientation is only brought up to date when the rock is drawn or turned into an object.
+struct asteroid_field_rocks {
+	SCP_vector<vec3d> pos;
+	SCP_vector<vec3d> vel;
+	SCP_vector<matrix> orient;
+	SCP_vector<vec3d> rotvel;
+	SCP_vector<float> orient_time;	// mission time the orientation belongs to
+	SCP_vector<float> radius;
+	SCP_vector<float> hull;
+	SCP_vector<int> asteroid_type;
+	SCP_vector<int> asteroid_subtype;
+
+	int size() const { return static_cast<int>(pos.size()); }
+
+	void reserve(int count)
+	{
+		pos.reserve(count);
+		vel.reserve(count);
+		orient.reserve(count);
+		rotvel.reserve(count);
+		orient_time.reserve(count);
+		radius.reserve(count);
+		hull.reserve(count);
+		asteroid_type.reserve(count);
+		asteroid_subtype.reserve(count);
+	}
+
+	void clear()
+	{
+		pos.clear();
+		vel.clear();
+		orient.clear();
+		rotvel.clear();
+		orient_time.clear();
+		radius.clear();
+		hull.clear();
+		asteroid_type.clear();
+		asteroid_subtype.clear();
+	}
+
+	void add(const vec3d& new_pos, const vec3d& new_vel, const matrix& new_orient, const vec3d& new_rotvel,
+		float new_orient_time, float new_radius, float new_hull, int new_type, int new_subtype)
+	{
+		pos.push_back(new_pos);
+		vel.push_back(new_vel);
+		orient.push_back(new_orient);
+		rotvel.push_back(new_rotvel);
+		orient_time.push_back(new_orient_time);
+		radius.push_back(new_radius);
+		hull.push_back(new_hull);
+		asteroid_type.push_back(new_type);
+		asteroid_subtype.push_back(new_subtype);
+	}
+
+	// Moves the last rock into the slot of the removed one
+	void remove(int i)
+	{
+		remove_from(pos, i);
+		remove_from(vel, i);
+		remove_from(orient, i);
+		remove_from(rotvel, i);
+		remove_from(orient_time, i);
+		remove_from(radius, i);
+		remove_from(hull, i);
+		remove_from(asteroid_type, i);
+		remove_from(asteroid_subtype, i);
+	}
+
+  private:
+	template <typename T>
+	static void remove_from(SCP_vector<T>& values, int i)
+	{
+		values[i] = values.back();
+		values.pop_back();
+	}
+};
+
 extern SCP_vector< asteroid_info > Asteroid_info;
 extern asteroid Asteroids[MAX_ASTEROIDS];
 extern asteroid_field	Asteroid_field;
@@ -178,6 +258,15 @@ void	asteroid_show_brackets();
 void	asteroid_target_closest_danger();
 void asteroid_add_target(object* objp);
 int get_asteroid_index(const char* asteroid_name);
+int	asteroid_field_max_count(field_type_t field_type);
+void	asteroid_field_rocks_render(model_draw_list* scene);
+
+// whether a field rock at pos comes within dist of the segment from p0 to p1
+bool	asteroid_field_rock_near_segment(const vec3d *pos, float radius, const vec3d *p0, const vec3d *p1, float dist);
+
+// picks the asteroids to turn back into rocks so field rocks closer to ships and weapons can take their slots, at most one
+// for each rock and only asteroids farther away than the rock they make room for. demote gets indices into asteroid_dist.
+void	asteroid_field_pick_demotions(const SCP_vector<float>& asteroid_dist, const SCP_vector<float>& rock_dist, SCP_vector<int>& demote);
 
 // need to extern for keycontrol debug commands
 object *asteroid_create(asteroid_field *asfieldp, int asteroid_type, int asteroid_subtype, bool check_visibility = false);
@@ -176,6 +176,7 @@ Flag exe_params[] =
 
 	//flag					launcher text								FSO		on_flags							off_flags						category		reference URL
 	{ "-no_vsync",			"Disable vertical sync",					true,	0,									EASY_DEFAULT,					"Game Speed",	"http://www.hard-light.net/wiki/index.php/Command-Line_Reference#-no_vsync", },
+	{ "-model_cache",		"Cache processed models on disk",			true,	0,									EASY_DEFAULT,					"Game Speed",	"http://www.hard-light.net/wiki/index.php/Command-Line_Reference#-model_cache", },
 
 	//flag					launcher text								FSO		on_flags							off_flags						category		reference URL
 	{ "-fps",				"Show frames per second on HUD",			false,	0,									EASY_DEFAULT,					"HUD",			"http://www.hard-light.net/wiki/index.php/Command-Line_Reference#-fps", },
@@ -200,6 +201,7 @@ Flag exe_params[] =
 	{ "-nosound",			"Disable all sound",						false,	0,									EASY_DEFAULT,					"Audio",		"http://www.hard-light.net/wiki/index.php/Command-Line_Reference#-nosound", },
 	{ "-nomusic",			"Disable music",							false,	0,									EASY_DEFAULT,					"Audio",		"http://www.hard-light.net/wiki/index.php/Command-Line_Reference#-nomusic", },
 	{ "-no_enhanced_sound",	"Disable enhanced sound",					false,	0,									EASY_DEFAULT,					"Audio",		"http://www.hard-light.net/wiki/index.php/Command-Line_Reference#-no_enhanced_sound", },
+	{ "-sound_cache",		"Cache decoded sounds on disk",				true,	0,									EASY_DEFAULT,					"Audio",		"http://www.hard-light.net/wiki/index.php/Command-Line_Reference#-sound_cache", },
 
 	//flag					launcher text								FSO		on_flags							off_flags						category		reference URL
 	{ "-portable_mode",		"Store config in portable location",		false,	0,									EASY_DEFAULT,					"Launcher",		"http://www.hard-light.net/wiki/index.php/Command-Line_Reference#-portable_mode", },
@@ -274,6 +276,7 @@ Flag exe_params[] =
 	{ "-slow_frames_ok",	"Don't adjust timestamps for slow frames",	true,	0,									EASY_DEFAULT,					"Dev Tool",		"http://www.hard-light.net/wiki/index.php/Command-Line_Reference#-slow_frames_ok", },
 	{ "-imgui_debug",		"Show imgui debug/demo window in the lab",  true,	0,									EASY_DEFAULT,					"Dev Tool",		"http://www.hard-light.net/wiki/index.php/Command-Line_Reference#-imgui_debug", },
 	{ "-luadev",			"Make lua errors non-fatal",				true,	0,									EASY_DEFAULT,					"Dev Tool",		"http://www.hard-light.net/wiki/index.php/Command-Line_Reference#-luadev", },
+	{ "-profile_scripts",	"Profile Lua hooks and functions",			true,	0,									EASY_DEFAULT,					"Dev Tool",		"http://www.hard-light.net/wiki/index.php/Command-Line_Reference#-profile_scripts", },
 	{"-vulkan",			"Use vulkan render backend",				true,	0,									  EASY_DEFAULT,				"Dev Tool",		"http://www.hard-light.net/wiki/index.php/Command-Line_Reference#-vulkan", },
 };
 // clang-format on
@@ -385,9 +388,11 @@ int Cmdline_msaa_enabled = 0;
 // Game Speed related
 cmdline_parm no_fpscap("-no_fps_capping", "Don't limit frames-per-second", AT_NONE);	// Cmdline_NoFPSCap
 cmdline_parm no_vsync_arg("-no_vsync", NULL, AT_NONE);		// Cmdline_no_vsync
+cmdline_parm model_cache_arg("-model_cache", nullptr, AT_NONE);	// Cmdline_model_cache
 
 int Cmdline_NoFPSCap = 0; // Disable FPS capping - kazan
 int Cmdline_no_vsync = 0;
+bool Cmdline_model_cache = false;
 
 // HUD related
 cmdline_parm ballistic_gauge("-ballistic_gauge", NULL, AT_NONE);	// Cmdline_ballistic_gauge
@@ -419,9 +424,11 @@ int Cmdline_deadzone = -1;
 
 // Audio related
 cmdline_parm voice_recognition_arg("-voicer", NULL, AT_NONE);	// Cmdline_voice_recognition
+cmdline_parm sound_cache_arg("-sound_cache", nullptr, AT_NONE);	// Cmdline_sound_cache
 
 int Cmdline_voice_recognition = 0;
 int Cmdline_no_enhanced_sound = 0;
+bool Cmdline_sound_cache = false;
 
 // MOD related
 cmdline_parm mod_arg("-mod", "List of folders to overwrite/add-to the default data", AT_STRING, true);	// Cmdline_mod  -- DTP modsupport
@@ -529,6 +536,7 @@ cmdline_parm log_to_stdout_arg("-stdout_log", nullptr, AT_NONE); // Cmdline_log_
 cmdline_parm slow_frames_ok_arg("-slow_frames_ok", nullptr, AT_NONE);	// Cmdline_slow_frames_ok
 cmdline_parm fixed_seed_rand("-seed", nullptr, AT_INT);	// Cmdline_rng_seed,Cmdline_reuse_rng_seed;
 cmdline_parm luadev_arg("-luadev", "Make lua errors non-fatal", AT_NONE);	// Cmdline_lua_devmode
+cmdline_parm profile_scripts_arg("-profile_scripts", "Profile Lua hooks and functions, dumps the results on exit", AT_NONE);	// Cmdline_profile_scripts
 cmdline_parm override_arg("-override_data", "Enable override directory", AT_NONE);	// Cmdline_override_data
 cmdline_parm imgui_debug_arg("-imgui_debug", nullptr, AT_NONE);
 cmdline_parm vulkan("-vulkan", nullptr, AT_NONE);
@@ -565,6 +573,7 @@ bool Cmdline_graphics_debug_output = false;
 bool Cmdline_log_to_stdout = false;
 bool Cmdline_slow_frames_ok = false;
 bool Cmdline_lua_devmode = false;
+bool Cmdline_profile_scripts = false;
 bool Cmdline_override_data = false;
 bool Cmdline_show_imgui_debug = false;
 bool Cmdline_vulkan = false;
@@ -1548,6 +1557,11 @@ bool SetCmdlineParams()
 		Cmdline_NoFPSCap = 1;
 	}
 
+	// Cache processed models
+	if (model_cache_arg.found()) {
+		Cmdline_model_cache = true;
+	}
+
 	if(loadallweapons_arg.found())
 	{
 		Cmdline_load_all_weapons = 1;
@@ -1614,6 +1628,11 @@ bool SetCmdlineParams()
 		Cmdline_no_enhanced_sound = 1;
 	}
 
+	// Cache decoded sounds
+	if (sound_cache_arg.found()) {
+		Cmdline_sound_cache = true;
+	}
+
 	// should we start a network game
 	if ( startgame_arg.found() ) {
 		Cmdline_use_last_pilot = 1;
@@ -2215,6 +2234,10 @@ bool SetCmdlineParams()
 		Cmdline_lua_devmode = true;
 	}
 
+	if (profile_scripts_arg.found()) {
+		Cmdline_profile_scripts = true;
+	}
+
 	if ( override_arg.found()) {
 		Cmdline_override_data = true;
 	}
@@ -74,6 +74,7 @@ extern int Cmdline_msaa_enabled;
 // Game Speed related
 extern int Cmdline_NoFPSCap;
 extern int Cmdline_no_vsync;
+extern bool Cmdline_model_cache;
 
 // HUD related
 extern int Cmdline_ballistic_gauge;
@@ -92,6 +93,7 @@ extern int Cmdline_deadzone;
 // Audio related
 extern int Cmdline_voice_recognition;
 extern int Cmdline_no_enhanced_sound;
+extern bool Cmdline_sound_cache;
 
 // MOD related
 extern char *Cmdline_mod;	 // DTP for mod support
@@ -155,6 +157,7 @@ extern bool Cmdline_graphics_debug_output;
 extern bool Cmdline_log_to_stdout;
 extern bool Cmdline_slow_frames_ok;
 extern bool Cmdline_lua_devmode;
+extern bool Cmdline_profile_scripts;
 extern bool Cmdline_override_data;
 extern bool Cmdline_show_imgui_debug;
 extern bool Cmdline_vulkan;
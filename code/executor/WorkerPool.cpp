@@ -0,0 +1,130 @@
+#include "WorkerPool.h"
+
+#include <atomic>
+
+namespace executor {
+
+WorkerPool::WorkerPool(size_t numThreads)
+{
+	m_threads.reserve(numThreads);
+	for (size_t i = 0; i < numThreads; ++i) {
+		m_threads.emplace_back(&WorkerPool::workerMain, this);
+	}
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		m_stopping = true;
+	}
+	m_queueCondition.notify_all();
+
+	for (auto& thread : m_threads) {
+		thread.join();
+	}
+}
+
+void WorkerPool::post(Task task)
+{
+	if (m_threads.empty()) {
+		// No workers available so we have to do this ourself
+		task();
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		m_queue.push_back(std::move(task));
+	}
+	m_queueCondition.notify_one();
+}
+
+void WorkerPool::parallel_for(size_t count, const std::function<void(size_t)>& fn)
+{
+	if (count == 0) {
+		return;
+	}
+
+	if (m_threads.empty() || count == 1) {
+		for (size_t i = 0; i < count; ++i) {
+			fn(i);
+		}
+		return;
+	}
+
+	struct shared_state {
+		std::atomic<size_t> next{0};
+		std::atomic<size_t> finished{0};
+
+		std::mutex mutex;
+		std::condition_variable condition;
+	};
+	auto state = std::make_shared<shared_state>();
+
+	// Helpers may start running after all work has been claimed (and after this function has returned) so they must
+	// not touch fn unless they actually claimed an index
+	auto worker = [state, count, &fn]() {
+		size_t index;
+		while ((index = state->next.fetch_add(1)) < count) {
+			fn(index);
+
+			if (state->finished.fetch_add(1) + 1 == count) {
+				std::lock_guard<std::mutex> lock(state->mutex);
+				state->condition.notify_all();
+			}
+		}
+	};
+
+	auto helpers = std::min(count - 1, m_threads.size());
+	for (size_t i = 0; i < helpers; ++i) {
+		post(worker);
+	}
+
+	worker();
+
+	std::unique_lock<std::mutex> lock(state->mutex);
+	state->condition.wait(lock, [&state, count]() { return state->finished.load() == count; });
+}
+
+size_t WorkerPool::numThreads() const { return m_threads.size(); }
+
+void WorkerPool::workerMain()
+{
+	for (;;) {
+		Task task;
+		{
+			std::unique_lock<std::mutex> lock(m_queueMutex);
+			m_queueCondition.wait(lock, [this]() { return m_stopping || !m_queue.empty(); });
+
+			if (m_queue.empty()) {
+				// Only possible if we are stopping
+				return;
+			}
+
+			task = std::move(m_queue.front());
+			m_queue.pop_front();
+		}
+
+		task();
+	}
+}
+
+WorkerPool& workerPool()
+{
+	static WorkerPool pool([]() -> size_t {
+		auto hardware_threads = std::thread::hardware_concurrency();
+
+		if (hardware_threads <= 1) {
+			// Either we don't know or there is only one core. Either way, one worker still allows overlapping work
+			// with IO on the main thread
+			return 1;
+		}
+
+		return hardware_threads - 1;
+	}());
+
+	return pool;
+}
+
+} // namespace executor
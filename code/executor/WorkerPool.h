@@ -0,0 +1,97 @@
+#pragma once
+
+#include "globalincs/pstypes.h"
+
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace executor {
+
+/**
+ * @brief A fixed size pool of worker threads for CPU bound background work
+ *
+ * Work items are executed in FIFO order by the first free worker. Work items must not touch engine state which is not
+ * explicitly thread safe (most notably cfile, bmpman and the graphics and sound backends). The usual pattern is to
+ * gather the input data on the main thread, do the expensive computation in the pool and then apply the result on the
+ * main thread again.
+ *
+ * @note post() and submit() are thread safe.
+ */
+class WorkerPool {
+  public:
+	using Task = std::function<void()>;
+
+	/**
+	 * @brief Creates a pool with the specified number of threads
+	 * @param numThreads The number of worker threads. If 0, work items are executed synchronously by the caller.
+	 */
+	explicit WorkerPool(size_t numThreads);
+	~WorkerPool();
+
+	WorkerPool(const WorkerPool&) = delete;
+	WorkerPool& operator=(const WorkerPool&) = delete;
+
+	/**
+	 * @brief Adds a work item to the queue of this pool
+	 * @param task The work item
+	 */
+	void post(Task task);
+
+	/**
+	 * @brief Adds a work item whose result can be retrieved later
+	 *
+	 * @param fn The function to execute
+	 * @return A future which will receive the return value (or exception) of the function
+	 */
+	template <typename F>
+	std::future<typename std::result_of<F()>::type> submit(F fn)
+	{
+		using result_type = typename std::result_of<F()>::type;
+
+		// std::function requires a copyable target so the packaged task has to be shared
+		auto task = std::make_shared<std::packaged_task<result_type()>>(std::move(fn));
+		auto future = task->get_future();
+
+		post([task]() { (*task)(); });
+
+		return future;
+	}
+
+	/**
+	 * @brief Executes fn(i) for every i in [0, count) and waits until all invocations are finished
+	 *
+	 * The calling thread participates in the work so this is safe to use even if all workers are busy. The order in
+	 * which the indices are processed is unspecified.
+	 *
+	 * @param count The number of indices to process
+	 * @param fn The function to call for every index
+	 */
+	void parallel_for(size_t count, const std::function<void(size_t)>& fn);
+
+	/**
+	 * @brief The number of worker threads in this pool
+	 */
+	size_t numThreads() const;
+
+  private:
+	void workerMain();
+
+	std::mutex m_queueMutex;
+	std::condition_variable m_queueCondition;
+	SCP_deque<Task> m_queue;
+	bool m_stopping = false;
+
+	SCP_vector<std::thread> m_threads;
+};
+
+/**
+ * @brief The engine wide worker pool
+ *
+ * The pool is created on first use and has one thread less than the number of hardware threads so that the main
+ * thread still has a core of its own.
+ */
+WorkerPool& workerPool();
+
+} // namespace executor
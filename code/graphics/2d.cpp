@@ -27,6 +27,8 @@
 #include "executor/global_executors.h"
 #include "graphics/paths/PathRenderer.h"
 #include "graphics/post_processing.h"
+#include "graphics/render.h"
+#include "graphics/util/FrameRingBuffer.h"
 #include "graphics/util/GPUMemoryHeap.h"
 #include "graphics/util/UniformBuffer.h"
 #include "graphics/util/UniformBufferManager.h"
@@ -466,12 +468,16 @@ static auto VSyncOption __UNUSED = options::OptionBuilder<bool>("Graphics.VSync"
                               .finish();
 
 static std::unique_ptr<graphics::util::UniformBufferManager> UniformBufferManager;
+static std::unique_ptr<graphics::util::FrameRingBuffer> VertexRingBuffer;
 
 // Forward definitions
 static void uniform_buffer_managers_init();
 static void uniform_buffer_managers_deinit();
 static void uniform_buffer_managers_retire_buffers();
 
+static void vertex_ring_buffer_init();
+static void vertex_ring_buffer_deinit();
+
 static void gpu_heap_init();
 static void gpu_heap_deinit();
 
@@ -1028,6 +1034,8 @@ void gr_close()
 
 	// Cleanup uniform buffer managers
 	uniform_buffer_managers_deinit();
+
+	vertex_ring_buffer_deinit();
 	
 	font::close();
 
@@ -1637,6 +1645,8 @@ bool gr_init(std::unique_ptr<os::GraphicsOperations>&& graphicsOps, int d_mode,
 	// Initialize uniform buffer managers
 	uniform_buffer_managers_init();
 
+	vertex_ring_buffer_init();
+
 	gpu_heap_init();
 
 	mprintf(("Checking graphics capabilities:\n"));
@@ -2356,8 +2366,6 @@ void poly_list::calculate_tangent()
 	}
 }
 
-static poly_list buffer_list_internal;
-
 void poly_list::make_index_buffer(SCP_vector<int> &vertex_list)
 {
 	int nverts = 0;
@@ -2397,7 +2405,8 @@ void poly_list::make_index_buffer(SCP_vector<int> &vertex_list)
 		return;
 	}
 
-	buffer_list_internal.n_verts = 0;
+	// Model geometry is generated on worker threads so this may not use a shared buffer
+	poly_list buffer_list_internal;
 	buffer_list_internal.allocate(nverts);
 
 	for (j = 0; j < n_verts; j++) {
@@ -2570,8 +2579,6 @@ void gr_flip(bool execute_scripting)
 		}
 	}
 
-	gr_reset_immediate_buffer();
-
 	// Do per frame operations on the matrix state
 	gr_matrix_on_frame();
 
@@ -2583,9 +2590,13 @@ void gr_flip(bool execute_scripting)
 		output_uniform_debug_data();
 	}
 
+	gr_2d_draw_stats_end_frame();
+
 	// Use this opportunity for retiring the uniform buffers
 	uniform_buffer_managers_retire_buffers();
 
+	VertexRingBuffer->onFrameEnd();
+
 	TRACE_SCOPE(tracing::PageFlip);
 	gr_screen.gf_flip();
 }
@@ -2633,6 +2644,22 @@ graphics::util::UniformBuffer gr_get_uniform_buffer(uniform_block_type type, siz
 	return UniformBufferManager->getUniformBuffer(type, num_elements, element_size_override);
 }
 
+static void vertex_ring_buffer_init()
+{
+	// This is also used with the stub renderer so start small, it will grow to what the frames actually need
+	VertexRingBuffer.reset(new graphics::util::FrameRingBuffer(BufferType::Vertex, 256 * 1024));
+}
+
+static void vertex_ring_buffer_deinit()
+{
+	VertexRingBuffer.reset();
+}
+
+graphics::util::FrameRingBuffer& gr_get_vertex_ring_buffer()
+{
+	return *VertexRingBuffer;
+}
+
 SCP_vector<DisplayData> gr_enumerate_displays()
 {
 	// It seems that linux cannot handle having the video subsystem inited
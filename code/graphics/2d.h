@@ -27,6 +27,7 @@ namespace graphics {
 namespace util {
 class UniformBuffer;
 class GPUMemoryHeap;
+class FrameRingBuffer;
 } // namespace util
 } // namespace graphics
 namespace scripting {
@@ -693,192 +694,187 @@ typedef struct screen {
 
 	float line_width = 0.0f;
 
+	// The backend functions are plain function pointers set by the init function of the backend. Some of them are
+	// called thousands of times per frame so they should stay cheap to call.
+
 	// switch onscreen, offscreen
-	std::function<void()> gf_flip;
+	void (*gf_flip)();
 
 	// sets the clipping region
-	std::function<void(int x, int y, int w, int h, int resize_mode)> gf_set_clip;
+	void (*gf_set_clip)(int x, int y, int w, int h, int resize_mode);
 
 	// resets the clipping region to entire screen
-	std::function<void()> gf_reset_clip;
+	void (*gf_reset_clip)();
 
 	// clears entire clipping region to current color
-	std::function<void()> gf_clear;
+	void (*gf_clear)();
 
 	// dumps the current screen to a file
-	std::function<void(const char* filename)> gf_print_screen;
+	void (*gf_print_screen)(const char* filename);
 
 	// dumps the current screen to a html blob string
-	std::function<SCP_string()> gf_blob_screen;
+	SCP_string (*gf_blob_screen)();
 
 	// transforms and dumps the current environment map to a file
-	std::function<void(const char* filename)> gf_dump_envmap;
+	void (*gf_dump_envmap)(const char* filename);
 
 	// generate diffuse irradiance cubemap for IBL.
-	std::function<void()> gf_calculate_irrmap;
+	void (*gf_calculate_irrmap)();
 
 	// Retrieves the zbuffer mode.
-	std::function<int()> gf_zbuffer_get;
+	int (*gf_zbuffer_get)();
 
 	// Sets mode.  Returns previous mode.
-	std::function<int(int mode)> gf_zbuffer_set;
+	int (*gf_zbuffer_set)(int mode);
 
 	// Clears the zbuffer.  If use_zbuffer is FALSE, then zbuffering mode is ignored and zbuffer is always off.
-	std::function<void(int use_zbuffer)> gf_zbuffer_clear;
+	void (*gf_zbuffer_clear)(int use_zbuffer);
 
 	// Set the stencil buffer mode. Returns previous mode
-	std::function<int(int mode)> gf_stencil_set;
+	int (*gf_stencil_set)(int mode);
 
 	// Clears the stencil buffer.
-	std::function<void()> gf_stencil_clear;
+	void (*gf_stencil_clear)();
 
-	std::function<int(int mode, float alpha)> gf_alpha_mask_set;
+	int (*gf_alpha_mask_set)(int mode, float alpha);
 
 	// Saves screen. Returns an id you pass to restore and free.
-	std::function<int()> gf_save_screen;
+	int (*gf_save_screen)();
 
 	// Resets clip region and copies entire saved screen to the screen.
-	std::function<void(int id)> gf_restore_screen;
+	void (*gf_restore_screen)(int id);
 
 	// Frees up a saved screen.
-	std::function<void(int id)> gf_free_screen;
+	void (*gf_free_screen)(int id);
 
 	// grab a region of the screen. assumes data is large enough
-	std::function<void(int front, int w, int h, ubyte* data)> gf_get_region;
+	void (*gf_get_region)(int front, int w, int h, ubyte* data);
 
 	// poly culling
-	std::function<int(int cull)> gf_set_cull;
+	int (*gf_set_cull)(int cull);
 
 	// color buffer writes
-	std::function<int(int mode)> gf_set_color_buffer;
+	int (*gf_set_color_buffer)(int mode);
 
 	// preload a bitmap into texture memory
-	std::function<int(int bitmap_num, int is_aabitmap)> gf_preload;
+	int (*gf_preload)(int bitmap_num, int is_aabitmap);
 
 	// set the color to be used when clearing the background
-	std::function<void(int r, int g, int b)> gf_set_clear_color;
+	void (*gf_set_clear_color)(int r, int g, int b);
 
 	// Here be the bitmap functions
-	std::function<void(bitmap_slot* slot, bool release)> gf_bm_free_data;
-	std::function<void(bitmap_slot* slot)> gf_bm_create;
-	std::function<void(bitmap_slot* slot)> gf_bm_init;
-	std::function<void()> gf_bm_page_in_start;
-	std::function<bool(int handle, bitmap* bm)> gf_bm_data;
+	void (*gf_bm_free_data)(bitmap_slot* slot, bool release);
+	void (*gf_bm_create)(bitmap_slot* slot);
+	void (*gf_bm_init)(bitmap_slot* slot);
+	void (*gf_bm_page_in_start)();
+	bool (*gf_bm_data)(int handle, bitmap* bm);
 
-	std::function<int(int handle, int* width, int* height, int* bpp, int* mm_lvl, int flags)> gf_bm_make_render_target;
-	std::function<int(int handle, int face)> gf_bm_set_render_target;
+	int (*gf_bm_make_render_target)(int handle, int* width, int* height, int* bpp, int* mm_lvl, int flags);
+	int (*gf_bm_set_render_target)(int handle, int face);
 
-	std::function<void(int)> gf_set_texture_addressing;
+	void (*gf_set_texture_addressing)(int);
 
-	std::function<gr_buffer_handle(BufferType type, BufferUsageHint usage)> gf_create_buffer;
-	std::function<void(gr_buffer_handle handle)> gf_delete_buffer;
+	gr_buffer_handle (*gf_create_buffer)(BufferType type, BufferUsageHint usage);
+	void (*gf_delete_buffer)(gr_buffer_handle handle);
 
-	std::function<void(gr_buffer_handle handle, size_t size, const void* data)> gf_update_buffer_data;
-	std::function<void(gr_buffer_handle handle, size_t offset, size_t size, const void* data)>
-		gf_update_buffer_data_offset;
-	std::function<void*(gr_buffer_handle handle)> gf_map_buffer;
-	std::function<void(gr_buffer_handle handle, size_t offset, size_t size)> gf_flush_mapped_buffer;
-	std::function<void(void* data, size_t size)> gf_update_transform_buffer;
+	void (*gf_update_buffer_data)(gr_buffer_handle handle, size_t size, const void* data);
+	void (*gf_update_buffer_data_offset)(gr_buffer_handle handle, size_t offset, size_t size, const void* data);
+	void* (*gf_map_buffer)(gr_buffer_handle handle);
+	void (*gf_flush_mapped_buffer)(gr_buffer_handle handle, size_t offset, size_t size);
+	void (*gf_update_transform_buffer)(void* data, size_t size);
 
 	// postprocessing effects
-	std::function<void(const char*, int, const vec3d*)> gf_post_process_set_effect;
-	std::function<void()> gf_post_process_set_defaults;
+	void (*gf_post_process_set_effect)(const char*, int, const vec3d*);
+	void (*gf_post_process_set_defaults)();
 
-	std::function<void()> gf_post_process_begin;
-	std::function<void()> gf_post_process_end;
-	std::function<void()> gf_post_process_save_zbuffer;
-	std::function<void()> gf_post_process_restore_zbuffer;
+	void (*gf_post_process_begin)();
+	void (*gf_post_process_end)();
+	void (*gf_post_process_save_zbuffer)();
+	void (*gf_post_process_restore_zbuffer)();
 
-	std::function<void(bool clearNonColorBufs)> gf_deferred_lighting_begin;
-	std::function<void()> gf_deferred_lighting_msaa;
-	std::function<void()> gf_deferred_lighting_end;
-	std::function<void()> gf_deferred_lighting_finish;
+	void (*gf_deferred_lighting_begin)(bool clearNonColorBufs);
+	void (*gf_deferred_lighting_msaa)();
+	void (*gf_deferred_lighting_end)();
+	void (*gf_deferred_lighting_finish)();
 
-	std::function<void()> gf_scene_texture_begin;
-	std::function<void()> gf_scene_texture_end;
-	std::function<void()> gf_copy_effect_texture;
+	void (*gf_scene_texture_begin)();
+	void (*gf_scene_texture_end)();
+	void (*gf_copy_effect_texture)();
 
-	std::function<void(int zbias)> gf_zbias;
+	void (*gf_zbias)(int zbias);
 
-	std::function<void(int)> gf_set_fill_mode;
+	void (*gf_set_fill_mode)(int);
 
-	std::function<void(float width)> gf_set_line_width;
+	void (*gf_set_line_width)(float width);
 
-	std::function<void(material* material_def, float rad)> gf_sphere;
+	void (*gf_sphere)(material* material_def, float rad);
 
-	std::function<int(shader_type type, unsigned int flags)> gf_maybe_create_shader;
-	std::function<void(const std::function<void(size_t, size_t)>& progress_callback)> gf_recompile_all_shaders;
+	int (*gf_maybe_create_shader)(shader_type type, unsigned int flags);
+	void (*gf_recompile_all_shaders)(const std::function<void(size_t, size_t)>& progress_callback);
 
-	std::function<void()> gf_clear_states;
+	void (*gf_clear_states)();
 
-	std::function<void(int bitmap_handle, int bpp, const ubyte* data, int width, int height)> gf_update_texture;
-	std::function<void(void* data_out, int bitmap_num)> gf_get_bitmap_from_texture;
+	void (*gf_update_texture)(int bitmap_handle, int bpp, const ubyte* data, int width, int height);
+	void (*gf_get_bitmap_from_texture)(void* data_out, int bitmap_num);
 
-	std::function<void(matrix4* shadow_view_matrix, const matrix* light_matrix, vec3d* eye_pos)> gf_shadow_map_start;
-	std::function<void()> gf_shadow_map_end;
+	void (*gf_shadow_map_start)(matrix4* shadow_view_matrix, const matrix* light_matrix, vec3d* eye_pos);
+	void (*gf_shadow_map_end)();
 
-	std::function<void()> gf_start_decal_pass;
-	std::function<void()> gf_stop_decal_pass;
+	void (*gf_start_decal_pass)();
+	void (*gf_stop_decal_pass)();
 
 	// new drawing functions
-	std::function<
-		void(model_material* material_info, indexed_vertex_source* vert_source, vertex_buffer* bufferp, size_t texi)>
-		gf_render_model;
-	std::function<void(shield_material* material_info,
+	void (*gf_render_model)(model_material* material_info,
+		indexed_vertex_source* vert_source,
+		vertex_buffer* bufferp,
+		size_t texi);
+	void (*gf_render_shield_impact)(shield_material* material_info,
 		primitive_type prim_type,
 		vertex_layout* layout,
 		gr_buffer_handle buffer_handle,
-		int n_verts)>
-		gf_render_shield_impact;
-	std::function<void(material* material_info,
+		int n_verts);
+	void (*gf_render_primitives)(material* material_info,
 		primitive_type prim_type,
 		vertex_layout* layout,
 		int offset,
 		int n_verts,
 		gr_buffer_handle buffer_handle,
-		size_t buffer_offset)>
-		gf_render_primitives;
-	std::function<void(particle_material* material_info,
+		size_t buffer_offset);
+	void (*gf_render_primitives_particle)(particle_material* material_info,
 		primitive_type prim_type,
 		vertex_layout* layout,
 		int offset,
 		int n_verts,
-		gr_buffer_handle buffer_handle)>
-		gf_render_primitives_particle;
-	std::function<void(distortion_material* material_info,
+		gr_buffer_handle buffer_handle);
+	void (*gf_render_primitives_distortion)(distortion_material* material_info,
 		primitive_type prim_type,
 		vertex_layout* layout,
 		int offset,
 		int n_verts,
-		gr_buffer_handle buffer_handle)>
-		gf_render_primitives_distortion;
-	std::function<void(movie_material* material_info,
+		gr_buffer_handle buffer_handle);
+	void (*gf_render_movie)(movie_material* material_info,
 		primitive_type prim_type,
 		vertex_layout* layout,
 		int n_verts,
 		gr_buffer_handle buffer,
-		size_t buffer_offset)>
-		gf_render_movie;
-	std::function<void(batched_bitmap_material* material_info,
+		size_t buffer_offset);
+	void (*gf_render_primitives_batched)(batched_bitmap_material* material_info,
 		primitive_type prim_type,
 		vertex_layout* layout,
 		int offset,
 		int n_verts,
-		gr_buffer_handle buffer_handle)>
-		gf_render_primitives_batched;
-	std::function<void(nanovg_material* material_info,
+		gr_buffer_handle buffer_handle);
+	void (*gf_render_nanovg)(nanovg_material* material_info,
 		primitive_type prim_type,
 		vertex_layout* layout,
 		int offset,
 		int n_verts,
-		gr_buffer_handle buffer_handle)>
-		gf_render_nanovg;
-	std::function<void(decal_material* material_info,
+		gr_buffer_handle buffer_handle);
+	void (*gf_render_decals)(decal_material* material_info,
 		primitive_type prim_type,
 		vertex_layout* layout,
 		int num_elements,
-		const indexed_vertex_source& buffers)>
-		gf_render_decals;
+		const indexed_vertex_source& buffers);
 	void (*gf_render_rocket_primitives)(interface_material* material_info,
 		primitive_type prim_type,
 		vertex_layout* layout,
@@ -886,31 +882,30 @@ typedef struct screen {
 		gr_buffer_handle vertex_buffer,
 		gr_buffer_handle index_buffer);
 
-	std::function<bool(gr_capability capability)> gf_is_capable;
-	std::function<bool(gr_property property, void* destination)> gf_get_property;
+	bool (*gf_is_capable)(gr_capability capability);
+	bool (*gf_get_property)(gr_property property, void* destination);
 
-	std::function<void(const char* name)> gf_push_debug_group;
-	std::function<void()> gf_pop_debug_group;
+	void (*gf_push_debug_group)(const char* name);
+	void (*gf_pop_debug_group)();
 
-	std::function<int()> gf_create_query_object;
-	std::function<void(int obj, QueryType type)> gf_query_value;
-	std::function<bool(int obj)> gf_query_value_available;
-	std::function<uint64_t(int obj)> gf_get_query_value;
-	std::function<void(int obj)> gf_delete_query_object;
+	int (*gf_create_query_object)();
+	void (*gf_query_value)(int obj, QueryType type);
+	bool (*gf_query_value_available)(int obj);
+	uint64_t (*gf_get_query_value)(int obj);
+	void (*gf_delete_query_object)(int obj);
 
 	std::unique_ptr<os::Viewport> (*gf_create_viewport)(const os::ViewPortProperties& props);
-	std::function<void(os::Viewport* view)> gf_use_viewport;
+	void (*gf_use_viewport)(os::Viewport* view);
 
-	std::function<void(uniform_block_type bind_point, size_t offset, size_t size, gr_buffer_handle buffer)>
-		gf_bind_uniform_buffer;
+	void (*gf_bind_uniform_buffer)(uniform_block_type bind_point, size_t offset, size_t size, gr_buffer_handle buffer);
 
-	std::function<gr_sync()> gf_sync_fence;
-	std::function<bool(gr_sync sync, uint64_t timeoutns)> gf_sync_wait;
-	std::function<void(gr_sync sync)> gf_sync_delete;
+	gr_sync (*gf_sync_fence)();
+	bool (*gf_sync_wait)(gr_sync sync, uint64_t timeoutns);
+	void (*gf_sync_delete)(gr_sync sync);
 
-	std::function<void(int x, int y, int width, int height)> gf_set_viewport;
+	void (*gf_set_viewport)(int x, int y, int width, int height);
 
-	std::function<void(bool set_override)> gf_override_fog;
+	void (*gf_override_fog)(bool set_override);
 } screen;
 
 // handy macro
@@ -1351,6 +1346,16 @@ enum AnimatedShader {
 graphics::util::UniformBuffer gr_get_uniform_buffer(uniform_block_type type, size_t num_elements,
                                                     size_t element_size_override = 0);
 
+/**
+ * @brief Gets the ring buffer for vertex data which is only used in the current frame
+ *
+ * Data allocated from this buffer is valid until the next gr_flip(). This is used for batched effects and immediate
+ * draws.
+ *
+ * @return The vertex ring buffer
+ */
+graphics::util::FrameRingBuffer& gr_get_vertex_ring_buffer();
+
 struct VideoModeData {
 	uint32_t width = 0;
 	uint32_t height = 0;
@@ -526,6 +526,68 @@ const bvec4& material::get_color_mask() const {
 	return Color_mask;
 }
 
+bool material::operator==(const material& other) const
+{
+	for (int i = 0; i < TM_NUM_TYPES; ++i) {
+		if (Texture_maps[i] != other.Texture_maps[i]) {
+			return false;
+		}
+	}
+
+	if (Sdr_type != other.Sdr_type || Tex_type != other.Tex_type || Texture_addressing != other.Texture_addressing
+		|| Depth_mode != other.Depth_mode || Blend_mode != other.Blend_mode
+		|| Has_buffer_blends != other.Has_buffer_blends || Cull_mode != other.Cull_mode
+		|| Fill_mode != other.Fill_mode || Clr_scale != other.Clr_scale || Depth_bias != other.Depth_bias) {
+		return false;
+	}
+
+	if (Has_buffer_blends && Buffer_blend_mode != other.Buffer_blend_mode) {
+		return false;
+	}
+
+	if (Clr.xyzw.x != other.Clr.xyzw.x || Clr.xyzw.y != other.Clr.xyzw.y || Clr.xyzw.z != other.Clr.xyzw.z
+		|| Clr.xyzw.w != other.Clr.xyzw.w) {
+		return false;
+	}
+
+	if (Color_mask.x != other.Color_mask.x || Color_mask.y != other.Color_mask.y || Color_mask.z != other.Color_mask.z
+		|| Color_mask.w != other.Color_mask.w) {
+		return false;
+	}
+
+	if (Clip_params.enabled != other.Clip_params.enabled) {
+		return false;
+	}
+	if (Clip_params.enabled) {
+		auto same_vec = [](const vec3d& lhs, const vec3d& rhs) {
+			return lhs.xyz.x == rhs.xyz.x && lhs.xyz.y == rhs.xyz.y && lhs.xyz.z == rhs.xyz.z;
+		};
+
+		if (!same_vec(Clip_params.normal, other.Clip_params.normal)
+			|| !same_vec(Clip_params.position, other.Clip_params.position)) {
+			return false;
+		}
+	}
+
+	if (Stencil_test != other.Stencil_test) {
+		return false;
+	}
+	if (Stencil_test) {
+		auto same_op = [](const StencilOp& lhs, const StencilOp& rhs) {
+			return lhs.stencilFailOperation == rhs.stencilFailOperation
+				&& lhs.depthFailOperation == rhs.depthFailOperation && lhs.successOperation == rhs.successOperation;
+		};
+
+		if (Stencil_mask != other.Stencil_mask || Stencil_func.compare != other.Stencil_func.compare
+			|| Stencil_func.ref != other.Stencil_func.ref || Stencil_func.mask != other.Stencil_func.mask
+			|| !same_op(Front_stencil_op, other.Front_stencil_op) || !same_op(Back_stencil_op, other.Back_stencil_op)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
 model_material::model_material() : material() {
 	set_shader_type(SDR_TYPE_MODEL);
 }
@@ -724,6 +786,36 @@ void model_material::reset_alpha_mult() {
 	Alpha_mult = 1.0f;
 }
 
+bool model_material::operator==(const model_material& other) const
+{
+	if (Desaturate != other.Desaturate || Shadow_casting != other.Shadow_casting
+		|| Shadow_receiving != other.Shadow_receiving || Batched != other.Batched || Deferred != other.Deferred
+		|| HDR != other.HDR || lighting != other.lighting || Light_factor != other.Light_factor
+		|| Center_alpha != other.Center_alpha || Animated_effect != other.Animated_effect
+		|| Animated_timer != other.Animated_timer || Thrust_scale != other.Thrust_scale
+		|| Team_color_set != other.Team_color_set || Outline_thickness != other.Outline_thickness
+		|| Use_alpha_mult != other.Use_alpha_mult || Alpha_mult != other.Alpha_mult) {
+		return false;
+	}
+
+	if (Team_color_set && (Tm_color.base.r != other.Tm_color.base.r || Tm_color.base.g != other.Tm_color.base.g
+		|| Tm_color.base.b != other.Tm_color.base.b || Tm_color.stripe.r != other.Tm_color.stripe.r
+		|| Tm_color.stripe.g != other.Tm_color.stripe.g || Tm_color.stripe.b != other.Tm_color.stripe.b)) {
+		return false;
+	}
+
+	if (Fog_params.enabled != other.Fog_params.enabled) {
+		return false;
+	}
+	if (Fog_params.enabled && (Fog_params.r != other.Fog_params.r || Fog_params.g != other.Fog_params.g
+		|| Fog_params.b != other.Fog_params.b || Fog_params.dist_near != other.Fog_params.dist_near
+		|| Fog_params.dist_far != other.Fog_params.dist_far)) {
+		return false;
+	}
+
+	return material::operator==(other);
+}
+
 uint model_material::get_shader_flags() const
 {
 	uint Shader_flags = 0;
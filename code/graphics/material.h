@@ -161,6 +161,10 @@ public:
 							  StencilOperation depthFailOperation,
 							  StencilOperation successOperation);
 	const StencilOp& get_back_stencil_op() const;
+
+	// compares all render state, e.g. for merging the materials of queued draws
+	bool operator==(const material& other) const;
+	bool operator!=(const material& other) const { return !(*this == other); }
 };
 
 class model_material : public material
@@ -263,6 +267,8 @@ public:
 	void set_alpha_mult(float alpha);
 	void reset_alpha_mult();
 
+	bool operator==(const model_material& other) const;
+	bool operator!=(const model_material& other) const { return !(*this == other); }
 };
 
 class particle_material : public material
@@ -272,6 +272,11 @@ void gr_end_2d_matrix()
 	matrix_uniform_up_to_date = false;
 }
 
+bool gr_2d_matrix_is_set()
+{
+	return htl_2d_matrix_set;
+}
+
 static bool scale_matrix_set = false;
 
 void gr_push_scale_matrix(const vec3d *scale_factor)
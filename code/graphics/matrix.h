@@ -23,6 +23,7 @@ void gr_end_view_matrix();
 
 void gr_set_2d_matrix(/*int x, int y, int w, int h*/);
 void gr_end_2d_matrix();
+bool gr_2d_matrix_is_set();
 
 void gr_push_scale_matrix(const vec3d *scale_factor);
 void gr_pop_scale_matrix();
@@ -8,9 +8,156 @@
 #include "graphics/software/NVGFont.h"
 #include "graphics/software/VFNTFont.h"
 #include "graphics/software/font_internal.h"
+#include "graphics/util/FrameRingBuffer.h"
+#include "graphics/util/QuadBatch.h"
 #include "localization/localize.h"
 #include "mod_table/mod_table.h"
 #include "render/3d.h"
+#include "tracing/Monitor.h"
+
+MONITOR(Num2dDrawCalls)
+MONITOR(Num2dBatchedQuads)
+
+struct gr_2d_batch_capture : graphics::util::quad_batch_capture {
+};
+
+namespace {
+using graphics::util::quad_batch_vertex;
+
+bool batching_2d = false; //!< flag for when the immediate 2D draws are batched
+bool flushing_2d_batch = false;
+
+graphics::util::QuadBatch Quad_batch;
+
+gr_2d_draw_stats Frame_draw_stats;
+gr_2d_draw_stats Last_frame_draw_stats;
+
+void batch_flush()
+{
+	if (flushing_2d_batch) {
+		return;
+	}
+
+	Quad_batch.markBreak();
+
+	if (Quad_batch.empty()) {
+		return;
+	}
+
+	GR_DEBUG_SCOPE("Flush 2D batch");
+
+	// The draws below go through the flushing backend functions again
+	flushing_2d_batch = true;
+
+	vertex_layout vert_def;
+	vert_def.add_vertex_component(vertex_format_data::POSITION2, sizeof(quad_batch_vertex), (int) offsetof(quad_batch_vertex, x));
+	vert_def.add_vertex_component(vertex_format_data::TEX_COORD2, sizeof(quad_batch_vertex), (int) offsetof(quad_batch_vertex, u));
+
+	auto& verts = Quad_batch.vertices();
+	auto& runs = Quad_batch.runs();
+
+	auto offset = gr_add_to_immediate_buffer(sizeof(quad_batch_vertex) * verts.size(), const_cast<quad_batch_vertex*>(verts.data()));
+
+	// A flush triggered by another 2D draw happens when that draw has already set up the matrices
+	bool set_matrix = !gr_2d_matrix_is_set();
+	if (set_matrix) {
+		gr_set_2d_matrix();
+	}
+
+	for (auto& run : runs) {
+		gr_render_primitives(const_cast<material*>(&run.mat),
+			PRIM_TYPE_TRIS,
+			&vert_def,
+			run.first_vert,
+			run.n_verts,
+			gr_immediate_buffer_handle,
+			offset);
+	}
+
+	if (set_matrix) {
+		gr_end_2d_matrix();
+	}
+
+	Frame_draw_stats.draw_calls += (int) runs.size();
+	++Frame_draw_stats.batch_uploads;
+
+	Quad_batch.clear();
+
+	flushing_2d_batch = false;
+}
+
+void batch_add_quad(const material& mat, float x1, float y1, float u1, float v1, float x2, float y2, float u2, float v2)
+{
+	Quad_batch.addQuad(mat, x1, y1, u1, v1, x2, y2, u2, v2);
+	++Frame_draw_stats.batched_quads;
+}
+
+// While batching, the backend functions which draw, change what is drawn to or change the clip and viewport are replaced
+// by versions which flush the batch first. They are plain function pointers so every replaced member gets its own
+// instantiation.
+template <typename Func, Func screen::*Member>
+struct flushing_function;
+
+template <typename Ret, typename... Args, Ret (*screen::*Member)(Args...)>
+struct flushing_function<Ret (*)(Args...), Member> {
+	static Ret (*original)(Args...);
+
+	static Ret call(Args... args)
+	{
+		batch_flush();
+		return original(args...);
+	}
+
+	static void install()
+	{
+		original = gr_screen.*Member;
+		if (original != nullptr) {
+			gr_screen.*Member = call;
+		}
+	}
+
+	static void uninstall()
+	{
+		if (original != nullptr) {
+			gr_screen.*Member = original;
+			original = nullptr;
+		}
+	}
+};
+
+template <typename Ret, typename... Args, Ret (*screen::*Member)(Args...)>
+Ret (*flushing_function<Ret (*)(Args...), Member>::original)(Args...) = nullptr;
+
+#define FLUSHING_FUNCTIONS(X)                                                                                          \
+	X(gf_flip)                                                                                                         \
+	X(gf_set_clip)                                                                                                     \
+	X(gf_reset_clip)                                                                                                   \
+	X(gf_set_viewport)                                                                                                 \
+	X(gf_clear)                                                                                                        \
+	X(gf_zbuffer_clear)                                                                                                \
+	X(gf_stencil_clear)                                                                                                \
+	X(gf_save_screen)                                                                                                  \
+	X(gf_get_region)                                                                                                   \
+	X(gf_bm_set_render_target)                                                                                         \
+	X(gf_update_texture)                                                                                               \
+	X(gf_post_process_begin)                                                                                           \
+	X(gf_scene_texture_begin)                                                                                          \
+	X(gf_copy_effect_texture)                                                                                          \
+	X(gf_sphere)                                                                                                       \
+	X(gf_render_model)                                                                                                 \
+	X(gf_render_shield_impact)                                                                                         \
+	X(gf_render_primitives)                                                                                            \
+	X(gf_render_primitives_particle)                                                                                   \
+	X(gf_render_primitives_distortion)                                                                                 \
+	X(gf_render_movie)                                                                                                 \
+	X(gf_render_primitives_batched)                                                                                    \
+	X(gf_render_nanovg)                                                                                                \
+	X(gf_render_decals)                                                                                                \
+	X(gf_render_rocket_primitives)
+
+#define INSTALL_FLUSHING(member) flushing_function<decltype(screen::member), &screen::member>::install();
+#define UNINSTALL_FLUSHING(member) flushing_function<decltype(screen::member), &screen::member>::uninstall();
+} // namespace
 
 static void gr_flash_internal(int r, int g, int b, int a, bool alpha_flash)
 {
@@ -71,6 +218,11 @@ void gr_flash_alpha(int r, int g, int b, int a) {
 
 static void
 draw_textured_quad(material* mat, float x1, float y1, float u1, float v1, float x2, float y2, float u2, float v2) {
+	if (batching_2d) {
+		batch_add_quad(*mat, x1, y1, u1, v1, x2, y2, u2, v2);
+		return;
+	}
+
 	GR_DEBUG_SCOPE("Draw textured quad");
 
 	float glVertices[4][4] = {{ x1, y1, u1, v1 },
@@ -567,7 +719,9 @@ static void gr_string_old(float sx,
 	vert_def.add_vertex_component(vertex_format_data::POSITION2, sizeof(v4), (int) offsetof(v4, x));
 	vert_def.add_vertex_component(vertex_format_data::TEX_COORD2, sizeof(v4), (int) offsetof(v4, u));
 
-	gr_set_2d_matrix();
+	if (!batching_2d) {
+		gr_set_2d_matrix();
+	}
 
 	// pick out letter coords, draw it, goto next letter and do the same
 	while (s < end) {
@@ -658,6 +812,11 @@ static void gr_string_old(float sx,
 		u1 = (i2fl((u + xd) + wc) / bw);
 		v1 = (i2fl((v + yd) + hc) / bh);
 
+		if (batching_2d) {
+			batch_add_quad(render_mat, x1, y1, u0, v0, x2, y2, u1, v1);
+			continue;
+		}
+
 		if (buffer_offset == MAX_VERTS_PER_DRAW) {
 			gr_render_primitives_immediate(&render_mat,
 										   PRIM_TYPE_TRIS,
@@ -714,7 +873,9 @@ static void gr_string_old(float sx,
 									   sizeof(v4) * buffer_offset);
 	}
 
-	gr_end_2d_matrix();
+	if (!batching_2d) {
+		gr_end_2d_matrix();
+	}
 }
 
 namespace {
@@ -1021,6 +1182,21 @@ void gr_circle(int xc, int yc, int d, int resize_mode) {
 
 	endDrawing(path);
 }
+void gr_circles(const int* centers, int n_circles, int d, int resize_mode) {
+	if (gr_screen.mode == GR_STUB || n_circles <= 0) {
+		return;
+	}
+
+	auto path = beginDrawing(resize_mode);
+
+	for (int i = 0; i < n_circles; ++i) {
+		path->circle(i2fl(centers[2 * i]), i2fl(centers[2 * i + 1]), d / 2.0f);
+	}
+	path->setFillColor(&gr_screen.current_color);
+	path->fill();
+
+	endDrawing(path);
+}
 void gr_unfilled_circle(int xc, int yc, int d, int resize_mode) {
 	if (gr_screen.mode == GR_STUB) {
 		return;
@@ -1184,56 +1360,105 @@ void gr_2d_stop_buffer() {
 	path->endFrame();
 }
 
-gr_buffer_handle gr_immediate_buffer_handle;
-static size_t immediate_buffer_offset = 0;
-static size_t immediate_buffer_size = 0;
-static const int IMMEDIATE_BUFFER_RESIZE_BLOCK_SIZE = 2048;
-
-size_t gr_add_to_immediate_buffer(size_t size, void* data) {
+void gr_2d_start_batch() {
 	if (gr_screen.mode == GR_STUB) {
-		return 0;
+		return;
 	}
 
-	GR_DEBUG_SCOPE("Add data to immediate buffer");
+	Assertion(!batching_2d, "Tried to enable 2D batching but it was already enabled!");
+
+	batching_2d = true;
+
+	FLUSHING_FUNCTIONS(INSTALL_FLUSHING)
+}
 
-	if (!gr_immediate_buffer_handle.isValid()) {
-		gr_immediate_buffer_handle = gr_create_buffer(BufferType::Vertex, BufferUsageHint::Dynamic);
+void gr_2d_stop_batch() {
+	if (gr_screen.mode == GR_STUB) {
+		return;
 	}
 
-	Assert(size > 0 && data != NULL);
+	Assertion(batching_2d, "Tried to stop 2D batching but it was not enabled!");
 
-	if ( immediate_buffer_offset + size > immediate_buffer_size ) {
-		// incoming data won't fit the immediate buffer. time to reallocate.
-		immediate_buffer_offset = 0;
-		immediate_buffer_size += MAX(IMMEDIATE_BUFFER_RESIZE_BLOCK_SIZE, size);
+	batch_flush();
+
+	FLUSHING_FUNCTIONS(UNINSTALL_FLUSHING)
+
+	batching_2d = false;
+}
+
+void gr_2d_flush_batch() {
+	batch_flush();
+}
+
+gr_2d_batch_capture* gr_2d_create_capture() {
+	return new gr_2d_batch_capture();
+}
 
-		gr_update_buffer_data(gr_immediate_buffer_handle, immediate_buffer_size, NULL);
+void gr_2d_delete_capture(gr_2d_batch_capture* capture) {
+	delete capture;
+}
+
+void gr_2d_begin_capture() {
+	Quad_batch.beginCapture();
+}
+
+bool gr_2d_end_capture(gr_2d_batch_capture* capture) {
+	bool complete = Quad_batch.endCapture(capture);
+
+	// Without batching the output went straight to the backend
+	if (!batching_2d) {
+		capture->verts.clear();
+		capture->runs.clear();
+		return false;
 	}
 
-	// only update a section of the immediate vertex buffer
-	gr_update_buffer_data_offset(gr_immediate_buffer_handle, immediate_buffer_offset, size, data);
+	return complete;
+}
+
+void gr_2d_replay_capture(const gr_2d_batch_capture& capture) {
+	Assertion(batching_2d, "Captured 2D output can only be replayed while batching!");
 
-	auto old_offset = immediate_buffer_offset;
+	Quad_batch.replay(capture);
 
-	immediate_buffer_offset += size;
+	Frame_draw_stats.replayed_quads += (int) capture.verts.size() / 6;
+}
 
-	return old_offset;
+const gr_2d_draw_stats& gr_2d_get_draw_stats() {
+	return Last_frame_draw_stats;
 }
-void gr_reset_immediate_buffer() {
+
+void gr_2d_draw_stats_end_frame() {
+	Assertion(!batching_2d, "2D batching is still enabled at the end of the frame!");
+
+	Last_frame_draw_stats = Frame_draw_stats;
+	Frame_draw_stats = gr_2d_draw_stats();
+
+	mon_Num2dDrawCalls = Last_frame_draw_stats.draw_calls;
+	mon_Num2dBatchedQuads = Last_frame_draw_stats.batched_quads;
+}
+
+gr_buffer_handle gr_immediate_buffer_handle;
+static const size_t IMMEDIATE_BUFFER_ALIGNMENT = 16;
+
+size_t gr_add_to_immediate_buffer(size_t size, void* data) {
 	if (gr_screen.mode == GR_STUB) {
-		return;
+		return 0;
 	}
 
-	if (!gr_immediate_buffer_handle.isValid()) {
-		// we haven't used the immediate buffer yet
-		return;
-	}
+	GR_DEBUG_SCOPE("Add data to immediate buffer");
 
-	// orphan the immediate buffer so we can start fresh in a new frame
-	gr_update_buffer_data(gr_immediate_buffer_handle, immediate_buffer_size, NULL);
+	Assert(size > 0 && data != NULL);
+
+	auto& ring = gr_get_vertex_ring_buffer();
+	auto alloc = ring.allocate(size, IMMEDIATE_BUFFER_ALIGNMENT);
+
+	memcpy(alloc.data, data, size);
+	ring.submit(alloc);
+
+	// The ring buffer may have been replaced by a bigger one
+	gr_immediate_buffer_handle = alloc.handle;
 
-	// bring our offset to the beginning of the immediate buffer
-	immediate_buffer_offset = 0;
+	return alloc.offset;
 }
 
 void gr_render_primitives_immediate(material* material_info,
@@ -1246,9 +1471,13 @@ void gr_render_primitives_immediate(material* material_info,
 		return;
 	}
 
+	batch_flush();
+
 	auto offset = gr_add_to_immediate_buffer(size, data);
 
 	gr_render_primitives(material_info, prim_type, layout, 0, n_verts, gr_immediate_buffer_handle, offset);
+
+	++Frame_draw_stats.draw_calls;
 }
 
 void gr_render_primitives_2d_immediate(material* material_info,
@@ -1262,6 +1491,8 @@ void gr_render_primitives_2d_immediate(material* material_info,
 		return;
 	}
 
+	batch_flush();
+
 	gr_set_2d_matrix();
 
 	gr_render_primitives_immediate(material_info, prim_type, layout, n_verts, data, size);
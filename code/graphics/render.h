@@ -136,6 +136,17 @@ void gr_shade(int x, int y, int w, int h, int resize_mode = GR_RESIZE_FULL);
  * @param resize_mode The mode for translating the screen positions
  */
 void gr_circle(int xc, int yc, int d, int resize_mode = GR_RESIZE_FULL);
+/**
+ * @brief Draws several filled circles of the same size with the current color
+ *
+ * All circles are filled as one path so this is much cheaper than calling gr_circle() for each of them.
+ *
+ * @param centers The center positions, the x and y position of each circle one after another
+ * @param n_circles The number of circles
+ * @param d The diameter of the circles
+ * @param resize_mode The mode for translating the screen positions
+ */
+void gr_circles(const int* centers, int n_circles, int d, int resize_mode = GR_RESIZE_FULL);
 /**
  * @brief Draws an unfilled circle with the current color
  * @param xc The center x-position of the circle
@@ -187,7 +198,80 @@ void gr_2d_start_buffer();
 void gr_2d_stop_buffer();
 
 /**
- * @brief The buffer object holding the data for immediate draws
+ * @brief Start batching immediate 2D draws
+ *
+ * While batching, the quads of bitmaps and VFNT strings are queued instead of drawn. Consecutive quads with the same
+ * material (texture, blend mode, color) are merged into one draw and all queued vertices are uploaded at once. The
+ * batch is flushed before any other rendering operation reaches the backend so the drawing order stays the same. This
+ * includes changes of the clip rectangle and the viewport since the queued quads are drawn with the scissor and
+ * viewport which are set when the batch is flushed.
+ */
+void gr_2d_start_batch();
+
+/**
+ * @brief Stop batching immediate 2D draws and draw everything that is still queued
+ */
+void gr_2d_stop_batch();
+
+/**
+ * @brief Draws everything queued by the 2D batch
+ *
+ * Only needed when something bypasses the graphics backend functions, e.g. to read back the screen.
+ */
+void gr_2d_flush_batch();
+
+struct gr_2d_batch_capture;
+
+/**
+ * @brief Creates storage for the batched output of some 2D rendering code so it can be drawn again later
+ */
+gr_2d_batch_capture* gr_2d_create_capture();
+
+void gr_2d_delete_capture(gr_2d_batch_capture* capture);
+
+/**
+ * @brief Start capturing the output of the 2D batch
+ *
+ * Batching has to be enabled. Captures can't be nested.
+ */
+void gr_2d_begin_capture();
+
+/**
+ * @brief Stop capturing the output of the 2D batch
+ *
+ * @param capture The captured output, the previous contents are replaced
+ * @return @c false if something was drawn without going through the batch since gr_2d_begin_capture. The captured
+ * output is incomplete in that case and must not be used.
+ */
+bool gr_2d_end_capture(gr_2d_batch_capture* capture);
+
+/**
+ * @brief Adds previously captured output to the 2D batch
+ *
+ * The output is drawn exactly as it was captured, including its screen positions, so it is only valid as long as
+ * everything it was generated from stays the same.
+ */
+void gr_2d_replay_capture(const gr_2d_batch_capture& capture);
+
+struct gr_2d_draw_stats {
+	int draw_calls = 0;		// Draws issued by the immediate rendering functions, batched or not
+	int batched_quads = 0;	// Quads which went through the 2D batch
+	int batch_uploads = 0;	// Vertex uploads of the 2D batch
+	int replayed_quads = 0;	// Quads of captured output which was drawn again
+};
+
+/**
+ * @brief The 2D draw statistics of the last complete frame
+ */
+const gr_2d_draw_stats& gr_2d_get_draw_stats();
+
+/**
+ * @brief Ends the frame for the 2D draw statistics. Called by gr_flip.
+ */
+void gr_2d_draw_stats_end_frame();
+
+/**
+ * @brief The buffer object holding the data of the last gr_add_to_immediate_buffer call
  */
 extern gr_buffer_handle gr_immediate_buffer_handle;
 
@@ -202,11 +286,6 @@ extern gr_buffer_handle gr_immediate_buffer_handle;
  */
 size_t gr_add_to_immediate_buffer(size_t size, void *data);
 
-/**
- * @brief Resets the immediate buffer for reuse
- */
-void gr_reset_immediate_buffer();
-
 /**
  * @brief Renders some vertex data from an immediate memory buffer
  * @param material_info The material information for rendering the data
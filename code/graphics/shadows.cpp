@@ -19,6 +19,7 @@
 #include "model/modelrender.h"
 #include "options/Option.h"
 #include "render/3d.h"
+#include "tracing/Monitor.h"
 #include "tracing/tracing.h"
 
 extern vec3d check_offsets[8];
@@ -71,6 +72,29 @@ bool shadows_obj_in_frustum(object *objp, matrix *light_orient, vec3d *min, vec3
 	return true;
 }
 
+// All cascades share the light orientation so the object only has to be rotated into light space once
+static bool shadows_obj_in_any_frustum(object *objp, matrix *light_orient)
+{
+	vec3d pos, pos_rot;
+
+	vm_vec_sub(&pos, &objp->pos, &Eye_position);
+	vm_vec_rotate(&pos_rot, &pos, light_orient);
+
+	for ( auto& frustum : Shadow_frustums ) {
+		if ( (pos_rot.xyz.x - objp->radius) > frustum.max.xyz.x 
+			|| (pos_rot.xyz.x + objp->radius) < frustum.min.xyz.x 
+			|| (pos_rot.xyz.y - objp->radius) > frustum.max.xyz.y 
+			|| (pos_rot.xyz.y + objp->radius) < frustum.min.xyz.y 
+			|| (pos_rot.xyz.z - objp->radius) > frustum.max.xyz.z ) {
+			continue;
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
 void shadows_construct_light_proj(light_frustum_info *shadow_data)
 {
 	memset(&shadow_data->proj_matrix, 0, sizeof(matrix4));
@@ -419,6 +443,8 @@ void shadows_end_render()
 	gr_shadow_map_end();
 }
 
+MONITOR(NumShadowObjectsCulled)
+
 void shadows_render_all(float fov, matrix *eye_orient, vec3d *eye_pos)
 {
 	if (gr_screen.mode == GR_STUB) {
@@ -448,19 +474,10 @@ void shadows_render_all(float fov, matrix *eye_orient, vec3d *eye_pos)
 	matrix light_matrix = shadows_start_render(eye_orient, eye_pos, fov, gr_screen.clip_aspect, std::get<0>(Shadow_distances), std::get<1>(Shadow_distances), std::get<2>(Shadow_distances), std::get<3>(Shadow_distances));
 
 	model_draw_list scene;
-	object *objp = Objects;
-
-	for ( int i = 0; i <= Highest_object_index; i++, objp++ ) {
-		bool cull = true;
-
-		for ( int j = 0; j < MAX_SHADOW_CASCADES; ++j ) {
-			if ( shadows_obj_in_frustum(objp, &light_matrix, &Shadow_frustums[j].min, &Shadow_frustums[j].max) ) {
-				cull = false;
-				break;
-			}
-		}
 
-		if ( cull ) {
+	for ( auto objp : list_range(&obj_used_list) ) {
+		if ( !shadows_obj_in_any_frustum(objp, &light_matrix) ) {
+			MONITOR_INC(NumShadowObjectsCulled, 1);
 			continue;
 		}
 
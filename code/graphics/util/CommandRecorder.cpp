@@ -0,0 +1,743 @@
+
+#include "graphics/util/CommandRecorder.h"
+
+#include "debugconsole/console.h"
+#include "graphics/2d.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+using namespace graphics::util;
+
+// Packs four values into 16 bit fields, enough for screen coordinates
+uint64_t pack_rect(int a, int b, int c, int d)
+{
+	return (static_cast<uint64_t>(static_cast<uint16_t>(a)) << 48) |
+	       (static_cast<uint64_t>(static_cast<uint16_t>(b)) << 32) |
+	       (static_cast<uint64_t>(static_cast<uint16_t>(c)) << 16) | static_cast<uint64_t>(static_cast<uint16_t>(d));
+}
+
+int unpack_rect(uint64_t value, int field) { return static_cast<int16_t>((value >> (48 - field * 16)) & 0xFFFF); }
+
+uint64_t pack_float(float value)
+{
+	uint32_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+float unpack_float(uint64_t value)
+{
+	auto bits = static_cast<uint32_t>(value);
+	float result;
+	std::memcpy(&result, &bits, sizeof(result));
+	return result;
+}
+
+uint64_t handle_value(gr_buffer_handle handle) { return static_cast<uint64_t>(static_cast<uint32_t>(handle.value())); }
+
+gr_buffer_handle unpack_handle(uint64_t value) { return gr_buffer_handle(static_cast<int>(value & 0xFFFFFFFF)); }
+
+// The functions of gr_screen are plain function pointers so the wrappers can't carry any state along. Every wrapped
+// member gets its own instantiation which stores the original function and what to record.
+CommandRecorder* Active_recorder = nullptr;
+
+template <typename Func, Func screen::*Member>
+struct wrapped_function;
+
+template <typename Ret, typename... Args, Ret (*screen::*Member)(Args...)>
+struct wrapped_function<Ret (*)(Args...), Member> {
+	static Ret (*original)(Args...);
+	static void (*recorder)(CommandRecorder* self, Args... args);
+
+	static Ret call(Args... args)
+	{
+		recorder(Active_recorder, args...);
+		return original(args...);
+	}
+};
+
+template <typename Ret, typename... Args, Ret (*screen::*Member)(Args...)>
+Ret (*wrapped_function<Ret (*)(Args...), Member>::original)(Args...) = nullptr;
+
+template <typename Ret, typename... Args, Ret (*screen::*Member)(Args...)>
+void (*wrapped_function<Ret (*)(Args...), Member>::recorder)(CommandRecorder* self, Args... args) = nullptr;
+
+template <typename Func, Func screen::*Member, typename Recorder>
+void wrap(SCP_vector<std::function<void()>>& restore, Recorder rec)
+{
+	using wrapper = wrapped_function<Func, Member>;
+
+	auto& target = gr_screen.*Member;
+	if (target == nullptr) {
+		return;
+	}
+
+	wrapper::original = target;
+	wrapper::recorder = rec;
+	restore.push_back([]() { gr_screen.*Member = wrapper::original; });
+
+	target = wrapper::call;
+}
+
+#define WRAP(member, ...) wrap<decltype(screen::member), &screen::member>(_restore, __VA_ARGS__)
+
+// The frame ends after the backend finished the flip
+decltype(screen::gf_flip) Flip_original = nullptr;
+
+void record_flip()
+{
+	auto self = Active_recorder;
+
+	self->record(CommandType::Flip);
+	Flip_original();
+	self->endFrame();
+}
+
+const char* Command_names[] = {
+	"Flip",
+	"Clear",
+	"SetClip",
+	"ResetClip",
+	"ZbufferSet",
+	"StencilSet",
+	"AlphaMaskSet",
+	"SetCull",
+	"SetColorBuffer",
+	"SetClearColor",
+	"SetTextureAddressing",
+	"Zbias",
+	"SetFillMode",
+	"SetLineWidth",
+	"SetViewport",
+	"ClearStates",
+	"BindUniformBuffer",
+	"ZbufferClear",
+	"StencilClear",
+	"DeferredLightingBegin",
+	"DeferredLightingMsaa",
+	"DeferredLightingEnd",
+	"DeferredLightingFinish",
+	"ShadowMapStart",
+	"ShadowMapEnd",
+	"PostProcessBegin",
+	"PostProcessEnd",
+	"SceneTextureBegin",
+	"SceneTextureEnd",
+	"DecalPassStart",
+	"DecalPassStop",
+	"CreateBuffer",
+	"DeleteBuffer",
+	"UpdateBufferData",
+	"UpdateBufferDataOffset",
+	"FlushMappedBuffer",
+	"UpdateTransformBuffer",
+	"UpdateTexture",
+	"RenderModel",
+	"RenderPrimitives",
+	"RenderPrimitivesParticle",
+	"RenderPrimitivesDistortion",
+	"RenderPrimitivesBatched",
+	"RenderMovie",
+	"RenderNanovg",
+	"RenderDecals",
+	"RenderRocketPrimitives",
+	"RenderShieldImpact",
+	"Sphere",
+};
+static_assert(sizeof(Command_names) / sizeof(Command_names[0]) == static_cast<size_t>(CommandType::NUM_VALUES),
+	"Command_names is out of sync with CommandType!");
+
+} // namespace
+
+namespace graphics {
+namespace util {
+
+CommandCategory command_category(CommandType type)
+{
+	switch (type) {
+	case CommandType::Flip:
+	case CommandType::Clear:
+		return CommandCategory::Frame;
+
+	case CommandType::SetClip:
+	case CommandType::ResetClip:
+	case CommandType::ZbufferSet:
+	case CommandType::StencilSet:
+	case CommandType::AlphaMaskSet:
+	case CommandType::SetCull:
+	case CommandType::SetColorBuffer:
+	case CommandType::SetClearColor:
+	case CommandType::SetTextureAddressing:
+	case CommandType::Zbias:
+	case CommandType::SetFillMode:
+	case CommandType::SetLineWidth:
+	case CommandType::SetViewport:
+	case CommandType::ClearStates:
+	case CommandType::BindUniformBuffer:
+		return CommandCategory::State;
+
+	case CommandType::ZbufferClear:
+	case CommandType::StencilClear:
+	case CommandType::DeferredLightingBegin:
+	case CommandType::DeferredLightingMsaa:
+	case CommandType::DeferredLightingEnd:
+	case CommandType::DeferredLightingFinish:
+	case CommandType::ShadowMapStart:
+	case CommandType::ShadowMapEnd:
+	case CommandType::PostProcessBegin:
+	case CommandType::PostProcessEnd:
+	case CommandType::SceneTextureBegin:
+	case CommandType::SceneTextureEnd:
+	case CommandType::DecalPassStart:
+	case CommandType::DecalPassStop:
+		return CommandCategory::Pass;
+
+	case CommandType::CreateBuffer:
+	case CommandType::DeleteBuffer:
+	case CommandType::UpdateBufferData:
+	case CommandType::UpdateBufferDataOffset:
+	case CommandType::FlushMappedBuffer:
+	case CommandType::UpdateTransformBuffer:
+	case CommandType::UpdateTexture:
+		return CommandCategory::Upload;
+
+	case CommandType::RenderModel:
+	case CommandType::RenderPrimitives:
+	case CommandType::RenderPrimitivesParticle:
+	case CommandType::RenderPrimitivesDistortion:
+	case CommandType::RenderPrimitivesBatched:
+	case CommandType::RenderMovie:
+	case CommandType::RenderNanovg:
+	case CommandType::RenderDecals:
+	case CommandType::RenderRocketPrimitives:
+	case CommandType::RenderShieldImpact:
+	case CommandType::Sphere:
+	case CommandType::NUM_VALUES:
+		break;
+	}
+
+	return CommandCategory::Draw;
+}
+
+const char* command_name(CommandType type)
+{
+	Assertion(type < CommandType::NUM_VALUES, "Invalid command type %d!", static_cast<int>(type));
+	return Command_names[static_cast<size_t>(type)];
+}
+
+command_stats& command_stats::operator+=(const command_stats& other)
+{
+	commands += other.commands;
+	draw_calls += other.draw_calls;
+	vertices += other.vertices;
+	state_calls += other.state_calls;
+	state_changes += other.state_changes;
+	passes += other.passes;
+	uploads += other.uploads;
+	bytes_uploaded += other.bytes_uploaded;
+
+	return *this;
+}
+
+command_stats compute_command_stats(const SCP_vector<recorded_command>& commands)
+{
+	command_stats stats;
+
+	bool has_state[static_cast<size_t>(CommandType::NUM_VALUES)] = {};
+	uint64_t last_state[static_cast<size_t>(CommandType::NUM_VALUES)] = {};
+
+	for (const auto& cmd : commands) {
+		++stats.commands;
+
+		switch (command_category(cmd.type)) {
+		case CommandCategory::Frame:
+			break;
+		case CommandCategory::State: {
+			++stats.state_calls;
+
+			auto index = static_cast<size_t>(cmd.type);
+			if (!has_state[index] || last_state[index] != cmd.value) {
+				++stats.state_changes;
+			}
+			has_state[index]  = true;
+			last_state[index] = cmd.value;
+			break;
+		}
+		case CommandCategory::Pass:
+			++stats.passes;
+			break;
+		case CommandCategory::Upload:
+			++stats.uploads;
+			stats.bytes_uploaded += cmd.size;
+			break;
+		case CommandCategory::Draw:
+			++stats.draw_calls;
+			stats.vertices += cmd.size;
+			break;
+		}
+	}
+
+	return stats;
+}
+
+CommandRecorder::~CommandRecorder() { stop(); }
+
+void CommandRecorder::start()
+{
+	if (_recording) {
+		return;
+	}
+
+	Assertion(Active_recorder == nullptr, "Only one command recorder may be active at a time!");
+
+	_current.clear();
+	_last.clear();
+	_total  = command_stats();
+	_frames = 0;
+
+	if (gr_screen.gf_flip != nullptr) {
+		Flip_original     = gr_screen.gf_flip;
+		gr_screen.gf_flip = record_flip;
+		_restore.push_back([]() { gr_screen.gf_flip = Flip_original; });
+	}
+	WRAP(gf_clear, [](CommandRecorder* self) { self->record(CommandType::Clear); });
+
+	WRAP(gf_set_clip, [](CommandRecorder* self, int x, int y, int w, int h, int resize_mode) {
+		self->record(CommandType::SetClip, pack_rect(x, y, w, h), static_cast<size_t>(resize_mode));
+	});
+	WRAP(gf_reset_clip, [](CommandRecorder* self) { self->record(CommandType::ResetClip); });
+	WRAP(gf_zbuffer_set, [](CommandRecorder* self, int mode) { self->record(CommandType::ZbufferSet, mode); });
+	WRAP(gf_stencil_set, [](CommandRecorder* self, int mode) { self->record(CommandType::StencilSet, mode); });
+	WRAP(gf_alpha_mask_set, [](CommandRecorder* self, int mode, float alpha) {
+		self->record(CommandType::AlphaMaskSet, (static_cast<uint64_t>(mode) << 32) | pack_float(alpha));
+	});
+	WRAP(gf_set_cull, [](CommandRecorder* self, int cull) { self->record(CommandType::SetCull, cull); });
+	WRAP(gf_set_color_buffer,
+		[](CommandRecorder* self, int mode) { self->record(CommandType::SetColorBuffer, mode); });
+	WRAP(gf_set_clear_color,
+		[](CommandRecorder* self, int r, int g, int b) {
+			self->record(CommandType::SetClearColor, pack_rect(0, r, g, b));
+		});
+	WRAP(gf_set_texture_addressing,
+		[](CommandRecorder* self, int mode) { self->record(CommandType::SetTextureAddressing, mode); });
+	WRAP(gf_zbias, [](CommandRecorder* self, int bias) { self->record(CommandType::Zbias, static_cast<uint32_t>(bias)); });
+	WRAP(gf_set_fill_mode, [](CommandRecorder* self, int mode) { self->record(CommandType::SetFillMode, mode); });
+	WRAP(gf_set_line_width,
+		[](CommandRecorder* self, float width) { self->record(CommandType::SetLineWidth, pack_float(width)); });
+	WRAP(gf_set_viewport, [](CommandRecorder* self, int x, int y, int width, int height) {
+		self->record(CommandType::SetViewport, pack_rect(x, y, width, height));
+	});
+	WRAP(gf_clear_states, [](CommandRecorder* self) { self->record(CommandType::ClearStates); });
+	WRAP(gf_bind_uniform_buffer,
+		[](CommandRecorder* self, uniform_block_type bind_point, size_t offset, size_t size, gr_buffer_handle buffer) {
+			self->record(CommandType::BindUniformBuffer,
+				(static_cast<uint64_t>(bind_point) << 56) | (static_cast<uint64_t>(offset & 0xFFFFFF) << 32) |
+					handle_value(buffer),
+				size);
+		});
+
+	WRAP(gf_zbuffer_clear,
+		[](CommandRecorder* self, int use_zbuffer) { self->record(CommandType::ZbufferClear, use_zbuffer); });
+	WRAP(gf_stencil_clear, [](CommandRecorder* self) { self->record(CommandType::StencilClear); });
+	WRAP(gf_deferred_lighting_begin, [](CommandRecorder* self, bool clearNonColorBufs) {
+		self->record(CommandType::DeferredLightingBegin, clearNonColorBufs ? 1 : 0);
+	});
+	WRAP(gf_deferred_lighting_msaa, [](CommandRecorder* self) { self->record(CommandType::DeferredLightingMsaa); });
+	WRAP(gf_deferred_lighting_end, [](CommandRecorder* self) { self->record(CommandType::DeferredLightingEnd); });
+	WRAP(gf_deferred_lighting_finish,
+		[](CommandRecorder* self) { self->record(CommandType::DeferredLightingFinish); });
+	WRAP(gf_shadow_map_start,
+		[](CommandRecorder* self, matrix4*, const matrix*, vec3d*) { self->record(CommandType::ShadowMapStart); });
+	WRAP(gf_shadow_map_end, [](CommandRecorder* self) { self->record(CommandType::ShadowMapEnd); });
+	WRAP(gf_post_process_begin, [](CommandRecorder* self) { self->record(CommandType::PostProcessBegin); });
+	WRAP(gf_post_process_end, [](CommandRecorder* self) { self->record(CommandType::PostProcessEnd); });
+	WRAP(gf_scene_texture_begin, [](CommandRecorder* self) { self->record(CommandType::SceneTextureBegin); });
+	WRAP(gf_scene_texture_end, [](CommandRecorder* self) { self->record(CommandType::SceneTextureEnd); });
+	WRAP(gf_start_decal_pass, [](CommandRecorder* self) { self->record(CommandType::DecalPassStart); });
+	WRAP(gf_stop_decal_pass, [](CommandRecorder* self) { self->record(CommandType::DecalPassStop); });
+
+	WRAP(gf_create_buffer,
+		[](CommandRecorder* self, BufferType type, BufferUsageHint) {
+			self->record(CommandType::CreateBuffer, static_cast<uint64_t>(type));
+		});
+	WRAP(gf_delete_buffer,
+		[](CommandRecorder* self, gr_buffer_handle handle) {
+			self->record(CommandType::DeleteBuffer, handle_value(handle));
+		});
+	WRAP(gf_update_buffer_data, [](CommandRecorder* self, gr_buffer_handle handle, size_t size, const void*) {
+		self->record(CommandType::UpdateBufferData, handle_value(handle), size);
+	});
+	WRAP(gf_update_buffer_data_offset,
+		[](CommandRecorder* self, gr_buffer_handle handle, size_t, size_t size, const void*) {
+			self->record(CommandType::UpdateBufferDataOffset, handle_value(handle), size);
+		});
+	WRAP(gf_flush_mapped_buffer, [](CommandRecorder* self, gr_buffer_handle handle, size_t, size_t size) {
+		self->record(CommandType::FlushMappedBuffer, handle_value(handle), size);
+	});
+	WRAP(gf_update_transform_buffer,
+		[](CommandRecorder* self, void*, size_t size) { self->record(CommandType::UpdateTransformBuffer, 0, size); });
+	WRAP(gf_update_texture, [](CommandRecorder* self, int bitmap_handle, int bpp, const ubyte*, int width, int height) {
+		self->record(CommandType::UpdateTexture, static_cast<uint32_t>(bitmap_handle),
+			static_cast<size_t>(width) * height * (bpp / 8));
+	});
+
+	WRAP(gf_render_model,
+		[](CommandRecorder* self, model_material*, indexed_vertex_source* vert_source, vertex_buffer* bufferp,
+			size_t texi) {
+			// the replay does not have any vertex data
+			self->record(CommandType::RenderModel,
+				vert_source != nullptr ? handle_value(vert_source->Vbuffer_handle) : 0,
+				bufferp != nullptr ? bufferp->tex_buf[texi].n_verts : 0);
+		});
+	WRAP(gf_render_primitives,
+		[](CommandRecorder* self, material*, primitive_type, vertex_layout*, int, int n_verts,
+			gr_buffer_handle buffer_handle, size_t) {
+			self->record(CommandType::RenderPrimitives, handle_value(buffer_handle), n_verts);
+		});
+	WRAP(gf_render_primitives_particle,
+		[](CommandRecorder* self, particle_material*, primitive_type, vertex_layout*, int, int n_verts,
+			gr_buffer_handle buffer_handle) {
+			self->record(CommandType::RenderPrimitivesParticle, handle_value(buffer_handle), n_verts);
+		});
+	WRAP(gf_render_primitives_distortion,
+		[](CommandRecorder* self, distortion_material*, primitive_type, vertex_layout*, int, int n_verts,
+			gr_buffer_handle buffer_handle) {
+			self->record(CommandType::RenderPrimitivesDistortion, handle_value(buffer_handle), n_verts);
+		});
+	WRAP(gf_render_primitives_batched,
+		[](CommandRecorder* self, batched_bitmap_material*, primitive_type, vertex_layout*, int, int n_verts,
+			gr_buffer_handle buffer_handle) {
+			self->record(CommandType::RenderPrimitivesBatched, handle_value(buffer_handle), n_verts);
+		});
+	WRAP(gf_render_movie,
+		[](CommandRecorder* self, movie_material*, primitive_type, vertex_layout*, int n_verts,
+			gr_buffer_handle buffer, size_t) {
+			self->record(CommandType::RenderMovie, handle_value(buffer), n_verts);
+		});
+	WRAP(gf_render_nanovg,
+		[](CommandRecorder* self, nanovg_material*, primitive_type, vertex_layout*, int, int n_verts,
+			gr_buffer_handle buffer_handle) {
+			self->record(CommandType::RenderNanovg, handle_value(buffer_handle), n_verts);
+		});
+	WRAP(gf_render_decals,
+		[](CommandRecorder* self, decal_material*, primitive_type, vertex_layout*, int num_elements,
+			const indexed_vertex_source& buffers) {
+			self->record(CommandType::RenderDecals, handle_value(buffers.Vbuffer_handle), num_elements);
+		});
+	WRAP(gf_render_shield_impact,
+		[](CommandRecorder* self, shield_material*, primitive_type, vertex_layout*, gr_buffer_handle buffer_handle,
+			int n_verts) {
+			self->record(CommandType::RenderShieldImpact, handle_value(buffer_handle), n_verts);
+		});
+	WRAP(gf_sphere, [](CommandRecorder* self, material*, float rad) {
+		self->record(CommandType::Sphere, pack_float(rad));
+	});
+
+	WRAP(gf_render_rocket_primitives,
+		[](CommandRecorder* self, interface_material*, primitive_type, vertex_layout*, int n_indices,
+			gr_buffer_handle vertex_buffer, gr_buffer_handle) {
+			self->record(CommandType::RenderRocketPrimitives, handle_value(vertex_buffer), n_indices);
+		});
+
+	Active_recorder = this;
+
+	_recording = true;
+}
+
+void CommandRecorder::stop()
+{
+	if (!_recording) {
+		return;
+	}
+
+	for (auto iter = _restore.rbegin(); iter != _restore.rend(); ++iter) {
+		(*iter)();
+	}
+	_restore.clear();
+
+	Active_recorder = nullptr;
+	Flip_original   = nullptr;
+
+	_recording = false;
+}
+
+bool CommandRecorder::isRecording() const { return _recording; }
+
+const SCP_vector<recorded_command>& CommandRecorder::currentFrame() const { return _current; }
+
+const SCP_vector<recorded_command>& CommandRecorder::lastFrame() const { return _last; }
+
+const command_stats& CommandRecorder::totalStats() const { return _total; }
+
+size_t CommandRecorder::numFrames() const { return _frames; }
+
+void CommandRecorder::record(CommandType type, uint64_t value, size_t size)
+{
+	recorded_command cmd;
+	cmd.type  = type;
+	cmd.size  = static_cast<uint32_t>(std::min(size, static_cast<size_t>(UINT32_MAX)));
+	cmd.value = value;
+
+	_current.push_back(cmd);
+}
+
+void CommandRecorder::endFrame()
+{
+	_total += compute_command_stats(_current);
+	++_frames;
+
+	// keep the allocation of the old frame around for the next one
+	std::swap(_current, _last);
+	_current.clear();
+}
+
+void replay_commands(const SCP_vector<recorded_command>& commands)
+{
+	Assertion(gr_screen.mode == GR_STUB, "Recorded commands can only be replayed into the stub renderer!");
+
+	SCP_vector<ubyte> upload_data;
+	auto upload = [&upload_data](size_t size) -> const void* {
+		if (upload_data.size() < size) {
+			upload_data.resize(size);
+		}
+		return upload_data.data();
+	};
+
+	vertex_layout layout;
+	indexed_vertex_source vert_source;
+	matrix4 shadow_view;
+	vec3d eye_pos = vmd_zero_vector;
+
+	for (const auto& cmd : commands) {
+		switch (cmd.type) {
+		case CommandType::Flip:
+			// Replaying a flip would end the frame of an active recorder
+			break;
+		case CommandType::Clear:
+			gr_screen.gf_clear();
+			break;
+		case CommandType::SetClip:
+			gr_screen.gf_set_clip(unpack_rect(cmd.value, 0), unpack_rect(cmd.value, 1), unpack_rect(cmd.value, 2),
+				unpack_rect(cmd.value, 3), static_cast<int>(cmd.size));
+			break;
+		case CommandType::ResetClip:
+			gr_screen.gf_reset_clip();
+			break;
+		case CommandType::ZbufferSet:
+			gr_screen.gf_zbuffer_set(static_cast<int>(cmd.value));
+			break;
+		case CommandType::StencilSet:
+			gr_screen.gf_stencil_set(static_cast<int>(cmd.value));
+			break;
+		case CommandType::AlphaMaskSet:
+			gr_screen.gf_alpha_mask_set(static_cast<int>(cmd.value >> 32), unpack_float(cmd.value));
+			break;
+		case CommandType::SetCull:
+			gr_screen.gf_set_cull(static_cast<int>(cmd.value));
+			break;
+		case CommandType::SetColorBuffer:
+			gr_screen.gf_set_color_buffer(static_cast<int>(cmd.value));
+			break;
+		case CommandType::SetClearColor:
+			gr_screen.gf_set_clear_color(unpack_rect(cmd.value, 1), unpack_rect(cmd.value, 2),
+				unpack_rect(cmd.value, 3));
+			break;
+		case CommandType::SetTextureAddressing:
+			gr_screen.gf_set_texture_addressing(static_cast<int>(cmd.value));
+			break;
+		case CommandType::Zbias:
+			gr_screen.gf_zbias(static_cast<int>(static_cast<uint32_t>(cmd.value)));
+			break;
+		case CommandType::SetFillMode:
+			gr_screen.gf_set_fill_mode(static_cast<int>(cmd.value));
+			break;
+		case CommandType::SetLineWidth:
+			gr_screen.gf_set_line_width(unpack_float(cmd.value));
+			break;
+		case CommandType::SetViewport:
+			gr_screen.gf_set_viewport(unpack_rect(cmd.value, 0), unpack_rect(cmd.value, 1), unpack_rect(cmd.value, 2),
+				unpack_rect(cmd.value, 3));
+			break;
+		case CommandType::ClearStates:
+			gr_screen.gf_clear_states();
+			break;
+		case CommandType::BindUniformBuffer:
+			gr_screen.gf_bind_uniform_buffer(static_cast<uniform_block_type>(cmd.value >> 56),
+				static_cast<size_t>((cmd.value >> 32) & 0xFFFFFF), cmd.size, unpack_handle(cmd.value));
+			break;
+		case CommandType::ZbufferClear:
+			gr_screen.gf_zbuffer_clear(static_cast<int>(cmd.value));
+			break;
+		case CommandType::StencilClear:
+			gr_screen.gf_stencil_clear();
+			break;
+		case CommandType::DeferredLightingBegin:
+			gr_screen.gf_deferred_lighting_begin(cmd.value != 0);
+			break;
+		case CommandType::DeferredLightingMsaa:
+			gr_screen.gf_deferred_lighting_msaa();
+			break;
+		case CommandType::DeferredLightingEnd:
+			gr_screen.gf_deferred_lighting_end();
+			break;
+		case CommandType::DeferredLightingFinish:
+			gr_screen.gf_deferred_lighting_finish();
+			break;
+		case CommandType::ShadowMapStart:
+			gr_screen.gf_shadow_map_start(&shadow_view, &vmd_identity_matrix, &eye_pos);
+			break;
+		case CommandType::ShadowMapEnd:
+			gr_screen.gf_shadow_map_end();
+			break;
+		case CommandType::PostProcessBegin:
+			gr_screen.gf_post_process_begin();
+			break;
+		case CommandType::PostProcessEnd:
+			gr_screen.gf_post_process_end();
+			break;
+		case CommandType::SceneTextureBegin:
+			gr_screen.gf_scene_texture_begin();
+			break;
+		case CommandType::SceneTextureEnd:
+			gr_screen.gf_scene_texture_end();
+			break;
+		case CommandType::DecalPassStart:
+			if (gr_screen.gf_start_decal_pass) {
+				gr_screen.gf_start_decal_pass();
+			}
+			break;
+		case CommandType::DecalPassStop:
+			if (gr_screen.gf_stop_decal_pass) {
+				gr_screen.gf_stop_decal_pass();
+			}
+			break;
+		case CommandType::CreateBuffer:
+		case CommandType::DeleteBuffer:
+			// Buffers are not owned by the replay
+			break;
+		case CommandType::UpdateBufferData:
+			gr_screen.gf_update_buffer_data(unpack_handle(cmd.value), cmd.size, upload(cmd.size));
+			break;
+		case CommandType::UpdateBufferDataOffset:
+			gr_screen.gf_update_buffer_data_offset(unpack_handle(cmd.value), 0, cmd.size, upload(cmd.size));
+			break;
+		case CommandType::FlushMappedBuffer:
+			gr_screen.gf_flush_mapped_buffer(unpack_handle(cmd.value), 0, cmd.size);
+			break;
+		case CommandType::UpdateTransformBuffer:
+			gr_screen.gf_update_transform_buffer(const_cast<void*>(upload(cmd.size)), cmd.size);
+			break;
+		case CommandType::UpdateTexture:
+			// The size of the texture is not recorded
+			break;
+		case CommandType::RenderModel:
+			gr_screen.gf_render_model(nullptr, &vert_source, nullptr, 0);
+			break;
+		case CommandType::RenderPrimitives:
+			gr_screen.gf_render_primitives(nullptr, PRIM_TYPE_TRIS, &layout, 0, static_cast<int>(cmd.size),
+				unpack_handle(cmd.value), 0);
+			break;
+		case CommandType::RenderPrimitivesParticle:
+			gr_screen.gf_render_primitives_particle(nullptr, PRIM_TYPE_POINTS, &layout, 0, static_cast<int>(cmd.size),
+				unpack_handle(cmd.value));
+			break;
+		case CommandType::RenderPrimitivesDistortion:
+			gr_screen.gf_render_primitives_distortion(nullptr, PRIM_TYPE_TRISTRIP, &layout, 0,
+				static_cast<int>(cmd.size), unpack_handle(cmd.value));
+			break;
+		case CommandType::RenderPrimitivesBatched:
+			gr_screen.gf_render_primitives_batched(nullptr, PRIM_TYPE_TRIS, &layout, 0, static_cast<int>(cmd.size),
+				unpack_handle(cmd.value));
+			break;
+		case CommandType::RenderMovie:
+			gr_screen.gf_render_movie(nullptr, PRIM_TYPE_TRIFAN, &layout, static_cast<int>(cmd.size),
+				unpack_handle(cmd.value), 0);
+			break;
+		case CommandType::RenderNanovg:
+			gr_screen.gf_render_nanovg(nullptr, PRIM_TYPE_TRIS, &layout, 0, static_cast<int>(cmd.size),
+				unpack_handle(cmd.value));
+			break;
+		case CommandType::RenderDecals:
+			if (gr_screen.gf_render_decals) {
+				gr_screen.gf_render_decals(nullptr, PRIM_TYPE_TRIS, &layout, static_cast<int>(cmd.size), vert_source);
+			}
+			break;
+		case CommandType::RenderRocketPrimitives:
+			gr_screen.gf_render_rocket_primitives(nullptr, PRIM_TYPE_TRIS, &layout, static_cast<int>(cmd.size),
+				unpack_handle(cmd.value), gr_buffer_handle());
+			break;
+		case CommandType::RenderShieldImpact:
+			gr_screen.gf_render_shield_impact(nullptr, PRIM_TYPE_TRIS, &layout, unpack_handle(cmd.value),
+				static_cast<int>(cmd.size));
+			break;
+		case CommandType::Sphere:
+			gr_screen.gf_sphere(nullptr, unpack_float(cmd.value));
+			break;
+		case CommandType::NUM_VALUES:
+			UNREACHABLE("Invalid command type!");
+			break;
+		}
+	}
+}
+
+CommandRecorder& command_recorder()
+{
+	static CommandRecorder recorder;
+	return recorder;
+}
+
+} // namespace util
+} // namespace graphics
+
+DCF(gr_record, "Records the calls into the graphics backend")
+{
+	using namespace graphics::util;
+
+	if (dc_optional_string_either("help", "--help")) {
+		dc_printf("Usage: gr_record start|stop|stats|replay\n");
+		dc_printf("start:  Starts recording the graphics calls of every frame\n");
+		dc_printf("stop:   Stops recording and prints the statistics of the recorded frames\n");
+		dc_printf("stats:  Prints the statistics of the recorded frames and the last frame\n");
+		dc_printf("replay: Replays the last frame (stub renderer only)\n");
+		return;
+	}
+
+	auto& recorder = command_recorder();
+
+	auto print_stats = [&recorder]() {
+		auto frames = recorder.numFrames();
+		const auto& total = recorder.totalStats();
+		auto last = compute_command_stats(recorder.lastFrame());
+
+		dc_printf(SIZE_T_ARG " frames recorded\n", frames);
+		if (frames > 0) {
+			dc_printf("Per frame: " SIZE_T_ARG " draws, " SIZE_T_ARG " state changes (" SIZE_T_ARG " calls), " SIZE_T_ARG
+			          " passes, " SIZE_T_ARG " bytes uploaded\n",
+				total.draw_calls / frames, total.state_changes / frames, total.state_calls / frames,
+				total.passes / frames, total.bytes_uploaded / frames);
+		}
+		dc_printf("Last frame: " SIZE_T_ARG " draws, " SIZE_T_ARG " vertices, " SIZE_T_ARG " state changes (" SIZE_T_ARG
+		          " calls), " SIZE_T_ARG " bytes uploaded\n",
+			last.draw_calls, last.vertices, last.state_changes, last.state_calls, last.bytes_uploaded);
+	};
+
+	if (dc_optional_string("start")) {
+		recorder.start();
+		dc_printf("Recording graphics calls\n");
+	} else if (dc_optional_string("stop")) {
+		recorder.stop();
+		print_stats();
+	} else if (dc_optional_string("stats")) {
+		print_stats();
+	} else if (dc_optional_string("replay")) {
+		if (gr_screen.mode != GR_STUB) {
+			dc_printf("Replaying is only supported by the stub renderer\n");
+			return;
+		}
+		replay_commands(recorder.lastFrame());
+	} else {
+		dc_printf("Recording is %s\n", recorder.isRecording() ? "active" : "inactive");
+	}
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "globalincs/pstypes.h"
+
+#include <cstdint>
+#include <functional>
+
+namespace graphics {
+namespace util {
+
+enum class CommandType : ubyte {
+	Flip,
+	Clear,
+
+	// Render state
+	SetClip,
+	ResetClip,
+	ZbufferSet,
+	StencilSet,
+	AlphaMaskSet,
+	SetCull,
+	SetColorBuffer,
+	SetClearColor,
+	SetTextureAddressing,
+	Zbias,
+	SetFillMode,
+	SetLineWidth,
+	SetViewport,
+	ClearStates,
+	BindUniformBuffer,
+
+	// Render passes
+	ZbufferClear,
+	StencilClear,
+	DeferredLightingBegin,
+	DeferredLightingMsaa,
+	DeferredLightingEnd,
+	DeferredLightingFinish,
+	ShadowMapStart,
+	ShadowMapEnd,
+	PostProcessBegin,
+	PostProcessEnd,
+	SceneTextureBegin,
+	SceneTextureEnd,
+	DecalPassStart,
+	DecalPassStop,
+
+	// Resources and uploads
+	CreateBuffer,
+	DeleteBuffer,
+	UpdateBufferData,
+	UpdateBufferDataOffset,
+	FlushMappedBuffer,
+	UpdateTransformBuffer,
+	UpdateTexture,
+
+	// Draws
+	RenderModel,
+	RenderPrimitives,
+	RenderPrimitivesParticle,
+	RenderPrimitivesDistortion,
+	RenderPrimitivesBatched,
+	RenderMovie,
+	RenderNanovg,
+	RenderDecals,
+	RenderRocketPrimitives,
+	RenderShieldImpact,
+	Sphere,
+
+	NUM_VALUES
+};
+
+enum class CommandCategory { Frame, State, Pass, Upload, Draw };
+
+CommandCategory command_category(CommandType type);
+
+const char* command_name(CommandType type);
+
+/**
+ * @brief One recorded call into the graphics backend
+ *
+ * The arguments are reduced to what is needed to detect redundant state changes and to replay the stream into the stub
+ * renderer. Pointers to materials and vertex data are not recorded.
+ */
+struct recorded_command {
+	CommandType type;
+	uint32_t size;  //!< Bytes uploaded by upload commands, vertices or elements drawn by draw commands
+	uint64_t value; //!< The packed arguments of state commands or the buffer handle of buffer commands
+};
+
+struct command_stats {
+	size_t commands       = 0;
+	size_t draw_calls     = 0;
+	size_t vertices       = 0;
+	size_t state_calls    = 0;
+	size_t state_changes  = 0; //!< State calls which actually changed the value of their state
+	size_t passes         = 0;
+	size_t uploads        = 0;
+	size_t bytes_uploaded = 0;
+
+	command_stats& operator+=(const command_stats& other);
+};
+
+/**
+ * @brief Computes the statistics of a command stream
+ *
+ * State calls are compared with the previous call of the same type in the stream so the first call of every type always
+ * counts as a change.
+ */
+command_stats compute_command_stats(const SCP_vector<recorded_command>& commands);
+
+/**
+ * @brief Records every call into the graphics backend
+ *
+ * While recording, the entry points of gr_screen are wrapped so that every call is appended to the command stream of
+ * the current frame before it is passed on to the backend. A frame ends with gr_flip(). This is intended for profiling
+ * the CPU side of rendering with the stub renderer but works with any backend.
+ *
+ * @note Only one recorder may be active at a time and the backend must not be changed while recording.
+ */
+class CommandRecorder {
+  public:
+	CommandRecorder() = default;
+	~CommandRecorder();
+
+	CommandRecorder(const CommandRecorder&) = delete;
+	CommandRecorder& operator=(const CommandRecorder&) = delete;
+
+	/**
+	 * @brief Wraps the functions of gr_screen and starts a new frame
+	 */
+	void start();
+
+	/**
+	 * @brief Restores the original functions of gr_screen
+	 *
+	 * The commands of the current, unfinished frame stay available through currentFrame().
+	 */
+	void stop();
+
+	bool isRecording() const;
+
+	/**
+	 * @brief The commands of the frame which is currently being recorded
+	 */
+	const SCP_vector<recorded_command>& currentFrame() const;
+
+	/**
+	 * @brief The commands of the last finished frame
+	 */
+	const SCP_vector<recorded_command>& lastFrame() const;
+
+	/**
+	 * @brief The sum of the statistics of all finished frames since start()
+	 */
+	const command_stats& totalStats() const;
+
+	size_t numFrames() const;
+
+	void record(CommandType type, uint64_t value = 0, size_t size = 0);
+
+	/**
+	 * @brief Finishes the current frame, called by the wrapped gr_flip()
+	 */
+	void endFrame();
+
+  private:
+
+	bool _recording = false;
+
+	SCP_vector<recorded_command> _current;
+	SCP_vector<recorded_command> _last;
+
+	command_stats _total;
+	size_t _frames = 0;
+
+	SCP_vector<std::function<void()>> _restore;
+};
+
+/**
+ * @brief Issues a recorded command stream to the stub renderer
+ *
+ * State commands and uploads are replayed with their recorded values (uploads use zeroed data of the recorded size).
+ * Draws are issued without materials or vertex data which only the stub renderer accepts.
+ */
+void replay_commands(const SCP_vector<recorded_command>& commands);
+
+/**
+ * @brief The recorder used by the gr_record debug command
+ */
+CommandRecorder& command_recorder();
+
+} // namespace util
+} // namespace graphics
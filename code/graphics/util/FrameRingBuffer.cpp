@@ -0,0 +1,177 @@
+
+#include "FrameRingBuffer.h"
+
+#include <algorithm>
+
+namespace {
+
+size_t align_offset(size_t offset, size_t alignment)
+{
+	if (alignment <= 1) {
+		return offset;
+	}
+	return ((offset + alignment - 1) / alignment) * alignment;
+}
+
+} // namespace
+
+namespace graphics {
+namespace util {
+
+FrameRingBuffer::FrameRingBuffer(BufferType type, size_t frame_size, WriteMode mode) : _type(type), _mode(mode)
+{
+	Assertion(frame_size > 0, "The frame size of a ring buffer must not be zero!");
+
+	_use_persistent_mapping = gr_is_capable(CAPABILITY_PERSISTENT_BUFFER_MAPPING);
+
+	_frame_fences.fill(nullptr);
+	changeFrameSize(frame_size);
+}
+FrameRingBuffer::~FrameRingBuffer()
+{
+	if (_buffer.isValid()) {
+		gr_delete_buffer(_buffer);
+		_buffer = gr_buffer_handle();
+	}
+	for (auto& fence : _frame_fences) {
+		if (fence != nullptr) {
+			gr_sync_delete(fence);
+			fence = nullptr;
+		}
+	}
+
+	for (auto& buffer : _retired_buffers) {
+		gr_sync_delete(std::get<0>(buffer));
+		if (std::get<1>(buffer).isValid()) {
+			gr_delete_buffer(std::get<1>(buffer));
+		}
+	}
+	_retired_buffers.clear();
+}
+FrameRingBuffer::allocation FrameRingBuffer::allocate(size_t size, size_t alignment)
+{
+	auto frame_start = _frame_size * _frame;
+	auto offset      = align_offset(frame_start + _frame_offset, alignment);
+
+	if (offset + size > frame_start + _frame_size) {
+		// This frame needs more memory than its segment has so all segments are too small. The segments of the new
+		// buffer can hold everything this frame allocated so far. The old buffer stays alive until the GPU is done.
+		changeFrameSize(std::max(_frame_size * 2, _frame_offset + size + alignment));
+
+		return allocate(size, alignment);
+	}
+
+	_frame_offset = offset + size - frame_start;
+
+	allocation alloc;
+	alloc.handle = _buffer;
+	alloc.offset = offset;
+	alloc.size   = size;
+
+	if (_mapped_ptr != nullptr) {
+		alloc.mapped = _mapped_ptr + offset;
+	}
+	if (_staging) {
+		// The staging memory only covers the segment of one frame
+		alloc.data = _staging.get() + (offset - frame_start);
+	} else {
+		alloc.data = alloc.mapped;
+	}
+
+	return alloc;
+}
+void FrameRingBuffer::submit(const allocation& alloc, size_t size)
+{
+	Assertion(size <= alloc.size, "Submitted more data than was allocated!");
+
+	if (size == 0) {
+		return;
+	}
+
+	if (alloc.mapped != nullptr) {
+		if (alloc.data != alloc.mapped) {
+			memcpy(alloc.mapped, alloc.data, size);
+		}
+		gr_flush_mapped_buffer(alloc.handle, alloc.offset, size);
+	} else if (alloc.handle.isValid()) {
+		gr_update_buffer_data_offset(alloc.handle, alloc.offset, size, alloc.data);
+	}
+}
+void FrameRingBuffer::onFrameEnd()
+{
+	GR_DEBUG_SCOPE("Performing ring buffer frame end operations");
+
+	_frame_fences[_frame] = gr_sync_fence();
+
+	_frame        = (_frame + 1) % NUM_FRAMES;
+	_frame_offset = 0;
+
+	// Now we need to wait until the segment is available again. In most cases this should succeed immediately.
+	if (_frame_fences[_frame] != nullptr) {
+		int i = 0;
+		while (i < 10 && !gr_sync_wait(_frame_fences[_frame], 500000000)) {
+			mprintf(("Missed ring buffer fence deadline!!\n"));
+			++i;
+		}
+		gr_sync_delete(_frame_fences[_frame]);
+		_frame_fences[_frame] = nullptr;
+
+		if (i == 10) {
+			Error(LOCATION, "Failed to wait until ring buffer range is available! Get a coder.");
+		}
+	}
+
+	while (!_retired_buffers.empty()) {
+		if (gr_sync_wait(std::get<0>(_retired_buffers.front()), 0)) {
+			// Fence was signaled => buffer is not in use anymore
+			gr_sync_delete(std::get<0>(_retired_buffers.front()));
+			if (std::get<1>(_retired_buffers.front()).isValid()) {
+				gr_delete_buffer(std::get<1>(_retired_buffers.front()));
+			}
+
+			_retired_buffers.erase(_retired_buffers.begin());
+		} else {
+			// The first fence element was not signaled yet so all the other fences also haven't been signaled yet
+			break;
+		}
+	}
+}
+void FrameRingBuffer::changeFrameSize(size_t new_size)
+{
+	if (_buffer.isValid() || _staging) {
+		_retired_buffers.emplace_back(gr_sync_fence(), _buffer, std::move(_staging));
+	}
+
+	// The fences of the old buffer do not apply to the new one
+	for (auto& fence : _frame_fences) {
+		if (fence != nullptr) {
+			gr_sync_delete(fence);
+			fence = nullptr;
+		}
+	}
+
+	_frame_size   = new_size;
+	_frame        = 0;
+	_frame_offset = 0;
+
+	_buffer = gr_create_buffer(_type,
+		_use_persistent_mapping ? BufferUsageHint::PersistentMapping : BufferUsageHint::Dynamic);
+	gr_update_buffer_data(_buffer, _frame_size * NUM_FRAMES, nullptr);
+
+	_mapped_ptr = nullptr;
+	if (_use_persistent_mapping) {
+		_mapped_ptr = reinterpret_cast<uint8_t*>(gr_map_buffer(_buffer));
+	}
+
+	if (_mapped_ptr == nullptr || _mode == WriteMode::Staged) {
+		_staging.reset(new uint8_t[_frame_size]);
+	}
+}
+gr_buffer_handle FrameRingBuffer::bufferHandle() const { return _buffer; }
+bool FrameRingBuffer::usesPersistentMapping() const { return _mapped_ptr != nullptr; }
+size_t FrameRingBuffer::getBufferSize() const { return _frame_size * NUM_FRAMES; }
+size_t FrameRingBuffer::getFrameSize() const { return _frame_size; }
+size_t FrameRingBuffer::getCurrentlyUsedSize() const { return _frame_offset; }
+
+} // namespace util
+} // namespace graphics
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "graphics/2d.h"
+
+#include <array>
+#include <memory>
+#include <tuple>
+
+namespace graphics {
+namespace util {
+
+/**
+ * @brief A GPU buffer for data which is only used in the frame it was written in
+ *
+ * The buffer is split into one segment per frame which may be in flight. Data is allocated linearly from the segment
+ * of the current frame and at the end of the frame a fence is placed so the segment is only reused once the GPU is
+ * done with it. If a frame needs more memory than its segment has, a bigger buffer is created and the old one is
+ * deleted once the GPU no longer uses it.
+ *
+ * If the backend supports persistent mapping, allocations point directly into the mapped buffer memory. Otherwise the
+ * data is written into CPU memory and uploaded with a single buffer update when it is submitted.
+ */
+class FrameRingBuffer {
+  public:
+	// The number of frames which may use the buffer at the same time
+	static const size_t NUM_FRAMES = 3;
+
+	enum class WriteMode {
+		Direct, //!< Write directly into the mapped buffer if the backend supports persistent mapping
+		Staged, //!< Always write into CPU memory which is copied into the buffer on submit
+	};
+
+	/**
+	 * @brief A range of the buffer which can be written to until it is submitted
+	 */
+	struct allocation {
+		gr_buffer_handle handle; //!< The buffer the range is in, pass this to the rendering functions
+		size_t offset = 0;       //!< The offset of the range in bytes from the start of the buffer
+		size_t size   = 0;
+
+		void* data   = nullptr; //!< The memory the data should be written to
+		void* mapped = nullptr; //!< The mapped buffer memory of the range or nullptr if it has to be uploaded
+	};
+
+	/**
+	 * @brief Creates the buffer
+	 *
+	 * @param type The type of the buffer object
+	 * @param frame_size The initial number of bytes available to every frame
+	 * @param mode How the data should be written, see WriteMode
+	 */
+	FrameRingBuffer(BufferType type, size_t frame_size, WriteMode mode = WriteMode::Direct);
+	~FrameRingBuffer();
+
+	FrameRingBuffer(const FrameRingBuffer&) = delete;
+	FrameRingBuffer& operator=(const FrameRingBuffer&) = delete;
+
+	/**
+	 * @brief Allocates a range of the buffer for the current frame
+	 *
+	 * @warning The memory is not initialized and may contain the data of an older frame.
+	 *
+	 * @param size The size of the range in bytes
+	 * @param alignment The alignment of the offset in the buffer. This does not need to be a power of two so the size
+	 * of a vertex can be used for getting an offset which is a multiple of the vertex size.
+	 * @return The allocated range
+	 */
+	allocation allocate(size_t size, size_t alignment = 1);
+
+	/**
+	 * @brief Makes the data written to the allocation available to the GPU
+	 *
+	 * @param alloc The allocation returned by allocate() in this frame
+	 * @param size The number of bytes which were written, starting at the beginning of the allocation
+	 */
+	void submit(const allocation& alloc, size_t size);
+
+	inline void submit(const allocation& alloc) { submit(alloc, alloc.size); }
+
+	/**
+	 * @brief Fences the segment of the current frame and waits until the segment of the next frame is available
+	 */
+	void onFrameEnd();
+
+	/**
+	 * @brief Gets the buffer used by allocations of the current frame
+	 */
+	gr_buffer_handle bufferHandle() const;
+
+	bool usesPersistentMapping() const;
+
+	/**
+	 * @brief Gets the size in bytes of the entire buffer
+	 */
+	size_t getBufferSize() const;
+
+	/**
+	 * @brief Gets the number of bytes available to every frame
+	 */
+	size_t getFrameSize() const;
+
+	/**
+	 * @brief Gets the number of bytes allocated in the current frame
+	 */
+	size_t getCurrentlyUsedSize() const;
+
+  private:
+	void changeFrameSize(size_t new_size);
+
+	BufferType _type;
+	WriteMode _mode;
+	bool _use_persistent_mapping = false;
+
+	gr_buffer_handle _buffer;
+	uint8_t* _mapped_ptr = nullptr;
+
+	// Written data is kept here until it is submitted if the buffer is not mapped directly
+	std::unique_ptr<uint8_t[]> _staging;
+
+	std::array<gr_sync, NUM_FRAMES> _frame_fences;
+
+	size_t _frame_size   = 0;
+	size_t _frame        = 0;
+	size_t _frame_offset = 0; // Offset of the next allocation relative to the start of the segment of the frame
+
+	/**
+	 * @brief Buffers which were replaced by a bigger one but might still be in use by the GPU
+	 *
+	 * The staging memory is kept with the buffer since allocations made before the resize may still be submitted.
+	 */
+	SCP_vector<std::tuple<gr_sync, gr_buffer_handle, std::unique_ptr<uint8_t[]>>> _retired_buffers;
+};
+
+} // namespace util
+} // namespace graphics
@@ -0,0 +1,111 @@
+#include "graphics/util/QuadBatch.h"
+
+namespace graphics {
+namespace util {
+
+void QuadBatch::addQuad(const material& mat,
+	float x1,
+	float y1,
+	float u1,
+	float v1,
+	float x2,
+	float y2,
+	float u2,
+	float v2)
+{
+	// Only consecutive quads are merged, anything else would break the drawing order
+	if (_runs.empty() || _split || _runs.back().mat != mat) {
+		_runs.push_back({mat, (int)_verts.size(), 0});
+		_split = false;
+	}
+
+	_verts.push_back({x1, y1, u1, v1});
+	_verts.push_back({x1, y2, u1, v2});
+	_verts.push_back({x2, y1, u2, v1});
+	_verts.push_back({x1, y2, u1, v2});
+	_verts.push_back({x2, y1, u2, v1});
+	_verts.push_back({x2, y2, u2, v2});
+
+	_runs.back().n_verts += 6;
+}
+
+void QuadBatch::clear()
+{
+	// The positions of a running capture would point past the queue
+	if (_capturing && !_verts.empty()) {
+		_capture_broken = true;
+	}
+
+	_verts.clear();
+	_runs.clear();
+}
+
+bool QuadBatch::empty() const { return _runs.empty(); }
+
+const SCP_vector<quad_batch_vertex>& QuadBatch::vertices() const { return _verts; }
+
+const SCP_vector<quad_batch_run>& QuadBatch::runs() const { return _runs; }
+
+void QuadBatch::markBreak()
+{
+	if (_capturing) {
+		_capture_broken = true;
+	}
+}
+
+void QuadBatch::beginCapture()
+{
+	Assertion(!_capturing, "Tried to start a 2D capture but one was already running!");
+
+	_capturing      = true;
+	_capture_broken = false;
+	_split          = true;
+
+	_capture_first_run  = _runs.size();
+	_capture_first_vert = _verts.size();
+}
+
+bool QuadBatch::endCapture(quad_batch_capture* capture)
+{
+	Assertion(_capturing, "Tried to end a 2D capture but none was running!");
+
+	_capturing = false;
+	_split     = false;
+
+	capture->verts.clear();
+	capture->runs.clear();
+
+	if (_capture_broken) {
+		return false;
+	}
+
+	capture->verts.assign(_verts.begin() + _capture_first_vert, _verts.end());
+	capture->runs.assign(_runs.begin() + _capture_first_run, _runs.end());
+
+	for (auto& run : capture->runs) {
+		run.first_vert -= (int)_capture_first_vert;
+	}
+
+	return true;
+}
+
+bool QuadBatch::isCapturing() const { return _capturing; }
+
+void QuadBatch::replay(const quad_batch_capture& capture)
+{
+	auto vert_offset = (int)_verts.size();
+	_verts.insert(_verts.end(), capture.verts.begin(), capture.verts.end());
+
+	for (auto& run : capture.runs) {
+		// Merging into the run before works the same as when the quads are added one by one
+		if (!_runs.empty() && !_split && _runs.back().mat == run.mat) {
+			_runs.back().n_verts += run.n_verts;
+		} else {
+			_runs.push_back({run.mat, run.first_vert + vert_offset, run.n_verts});
+			_split = false;
+		}
+	}
+}
+
+} // namespace util
+} // namespace graphics
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "globalincs/pstypes.h"
+#include "graphics/material.h"
+
+namespace graphics {
+namespace util {
+
+struct quad_batch_vertex {
+	float x, y, u, v;
+};
+
+// A range of queued vertices which is drawn with one material
+struct quad_batch_run {
+	material mat;
+	int first_vert;
+	int n_verts;
+};
+
+/**
+ * @brief Queued quads of a QuadBatch which can be added to a batch again later
+ */
+struct quad_batch_capture {
+	SCP_vector<quad_batch_vertex> verts;
+	SCP_vector<quad_batch_run> runs; //!< first_vert is relative to the start of verts
+};
+
+/**
+ * @brief The queue of the immediate 2D batch
+ *
+ * Quads are queued as two triangles each. Consecutive quads with the same material are merged into one run so every run
+ * can be drawn with a single draw call. Drawing the queue is up to the owner, this only keeps track of what is queued
+ * and of the captures.
+ */
+class QuadBatch {
+  public:
+	void addQuad(const material& mat, float x1, float y1, float u1, float v1, float x2, float y2, float u2, float v2);
+
+	/**
+	 * @brief Empties the queue once it has been drawn
+	 */
+	void clear();
+
+	bool empty() const;
+
+	const SCP_vector<quad_batch_vertex>& vertices() const;
+
+	const SCP_vector<quad_batch_run>& runs() const;
+
+	/**
+	 * @brief Marks that the queue had to be drawn for something else than the batch itself
+	 *
+	 * Anything drawn outside of the batch would be missing from the running capture so it can't be completed anymore.
+	 */
+	void markBreak();
+
+	/**
+	 * @brief Starts recording the quads queued from now on
+	 *
+	 * The captured quads start a run of their own so they can be added again without the quads queued before them.
+	 * Captures can't be nested.
+	 */
+	void beginCapture();
+
+	/**
+	 * @brief Stops recording
+	 *
+	 * @param capture Filled with the quads queued since beginCapture(), the previous contents are replaced
+	 * @return @c false if there was a break since beginCapture(). The capture is left empty in that case.
+	 */
+	bool endCapture(quad_batch_capture* capture);
+
+	bool isCapturing() const;
+
+	/**
+	 * @brief Queues the quads of a capture, merging them with the queue the same way addQuad() would
+	 */
+	void replay(const quad_batch_capture& capture);
+
+  private:
+	SCP_vector<quad_batch_vertex> _verts;
+	SCP_vector<quad_batch_run> _runs;
+
+	// The next quad must not be merged with the ones before it
+	bool _split = false;
+
+	bool _capturing      = false;
+	bool _capture_broken = false;
+	size_t _capture_first_run  = 0;
+	size_t _capture_first_vert = 0;
+};
+
+} // namespace util
+} // namespace graphics
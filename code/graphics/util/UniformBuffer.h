@@ -2,6 +2,7 @@
 
 
 #include "graphics/2d.h"
+#include "FrameRingBuffer.h"
 #include "UniformAligner.h"
 
 namespace graphics {
@@ -18,16 +19,15 @@ class UniformBufferManager;
  */
 class UniformBuffer {
 	UniformBufferManager* _parent = nullptr;
-	size_t _parent_offset         = 0;
 
-	gr_buffer_handle _buffer_handle;
+	FrameRingBuffer::allocation _allocation;
 
 	UniformAligner _aligner;
 
   public:
 	UniformBuffer();
-	UniformBuffer(UniformBufferManager* parent, size_t parent_offset, void* data_buffer, size_t buffer_size,
-	              size_t element_size, size_t header_size, size_t element_alignment);
+	UniformBuffer(UniformBufferManager* parent, const FrameRingBuffer::allocation& allocation, size_t element_size,
+	              size_t header_size, size_t element_alignment);
 	~UniformBuffer();
 
 	UniformBuffer(const UniformBuffer&) = delete;
@@ -17,6 +17,7 @@
 #include "gamesnd/gamesnd.h"
 #include "globalincs/alphacolors.h"
 #include "globalincs/linklist.h"
+#include "graphics/render.h"
 #include "hud/hud.h"
 #include "hud/hudconfig.h"
 #include "hud/hudescort.h"
@@ -40,6 +41,7 @@
 #include "mission/missionparse.h"
 #include "mission/missiontraining.h"
 #include "missionui/redalert.h"
+#include "mod_table/mod_table.h"
 #include "model/model.h"
 #include "network/multi_pmsg.h"
 #include "network/multi_voice.h"
@@ -360,6 +362,62 @@ textoffset_y(txtoffset_y), texture_target(-1), canvas_w(-1), canvas_h(-1), targe
 
 HudGauge::~HudGauge() {};
 
+void hud_gauge_state::clear()
+{
+	values.clear();
+}
+
+void hud_gauge_state::add(int value)
+{
+	values.push_back(value);
+}
+
+void hud_gauge_state::add(float value)
+{
+	int bits;
+	memcpy(&bits, &value, sizeof(bits));
+	values.push_back(bits);
+}
+
+void hud_gauge_state::add(const char* str)
+{
+	// the length goes first so consecutive strings can't run into each other
+	auto len = strlen(str);
+	values.push_back((int)len);
+
+	for (size_t i = 0; i < len; i += sizeof(int)) {
+		int packed = 0;
+		memcpy(&packed, str + i, std::min(sizeof(int), len - i));
+		values.push_back(packed);
+	}
+}
+
+void hud_gauge_state::add(const color& clr)
+{
+	values.push_back((int)((static_cast<uint>(clr.red) << 24) | (static_cast<uint>(clr.green) << 16) | (static_cast<uint>(clr.blue) << 8) | clr.alpha));
+	values.push_back(clr.ac_type);
+}
+
+bool hud_gauge_state::operator==(const hud_gauge_state& other) const
+{
+	return values == other.values;
+}
+
+hud_retained_output::hud_retained_output() = default;
+
+hud_retained_output::~hud_retained_output()
+{
+	reset();
+}
+
+void hud_retained_output::reset()
+{
+	state.clear();
+	gr_2d_delete_capture(capture);
+	capture = nullptr;
+	disabled = false;
+}
+
 void HudGauge::initPosition(int x, int y)
 {
 	position[0] = x;
@@ -710,6 +768,108 @@ void HudGauge::onFrame(float  /*frametime*/)
 	
 }
 
+bool HudGauge::getRenderState(hud_gauge_state* state)
+{
+	// only the plain custom gauges are handled here, everything else has to opt in
+	if (!custom_gauge) {
+		return false;
+	}
+
+	state->add(custom_text.c_str());
+	state->add(custom_frame.first_frame + custom_frame_offset);
+
+	return true;
+}
+
+/**
+ * Adds the state every gauge depends on through the rendering functions of HudGauge
+ */
+bool HudGauge::getCommonRenderState(hud_gauge_state* state)
+{
+	// the EMP effect jitters and scrambles the gauges every frame
+	if (emp_active_local()) {
+		return false;
+	}
+
+	// flashing from the sexp toggles inside of render()
+	if (!flashExpiredSexp()) {
+		return false;
+	}
+
+	state->add(position[0]);
+	state->add(position[1]);
+	state->add(gauge_color);
+	state->add(font_num);
+	state->add(HUD_contrast);
+	state->add(HUD_shadows ? 1 : 0);
+
+	state->add(gr_screen.max_w);
+	state->add(gr_screen.max_h);
+	state->add(gr_screen.rendering_to_texture);
+
+	// set up by resetClip(), this includes the HUD offsets
+	state->add(gr_screen.offset_x);
+	state->add(gr_screen.offset_y);
+	state->add(gr_screen.clip_width);
+	state->add(gr_screen.clip_height);
+
+	if (reticle_follow) {
+		state->add(HUD_nose_x);
+		state->add(HUD_nose_y);
+	}
+
+	return true;
+}
+
+void HudGauge::renderRetained(float frametime)
+{
+	if (!Retained_hud_gauges || (retained.output && retained.output->disabled)) {
+		render(frametime);
+		return;
+	}
+
+	if (!retained.output) {
+		retained.output.reset(new hud_retained_output());
+	}
+	auto& retained_output = *retained.output;
+
+	auto& next_state = retained_output.next_state;
+	next_state.clear();
+
+	if (!getRenderState(&next_state) || !getCommonRenderState(&next_state)) {
+		// the output has to be generated again once it can be retained
+		retained_output.state.clear();
+		render(frametime);
+		return;
+	}
+
+	if (retained_output.capture != nullptr && retained_output.state == next_state) {
+		gr_2d_replay_capture(*retained_output.capture);
+		return;
+	}
+
+	if (retained_output.capture == nullptr) {
+		retained_output.capture = gr_2d_create_capture();
+	}
+
+	gr_2d_begin_capture();
+	render(frametime);
+
+	if (gr_2d_end_capture(retained_output.capture)) {
+		std::swap(retained_output.state, next_state);
+	} else {
+		// something was drawn outside of the 2D batch, e.g. lines or TrueType text
+		retained_output.reset();
+		retained_output.disabled = true;
+	}
+}
+
+// The captured output refers to bitmaps which may be gone after the mission
+void HudGauge::resetRetainedOutput()
+{
+	retained.output.reset();
+}
+
 void HudGauge::render(float  /*frametime*/)
 {
 	if(!custom_gauge) {
@@ -1031,6 +1191,37 @@ void HudGauge::renderCircle(int x, int y, int diameter, bool filled)
 	gr_reset_screen_scale();
 }
 
+void HudGauge::renderCircles(const int* centers, int n_circles, int diameter)
+{
+	static SCP_vector<int> offset_centers;
+	int nx = 0, ny = 0;
+
+	if ( gr_screen.rendering_to_texture != -1 ) {
+		gr_set_screen_scale(canvas_w, canvas_h, -1, -1, target_w, target_h, target_w, target_h, true);
+	} else {
+		if ( reticle_follow ) {
+			nx = HUD_nose_x;
+			ny = HUD_nose_y;
+
+			gr_resize_screen_pos(&nx, &ny);
+			gr_set_screen_scale(base_w, base_h);
+			gr_unsize_screen_pos(&nx, &ny);
+		} else {
+			gr_set_screen_scale(base_w, base_h);
+		}
+	}
+
+	offset_centers.resize(2 * n_circles);
+	for (int i = 0; i < n_circles; ++i) {
+		offset_centers[2 * i] = centers[2 * i] + nx;
+		offset_centers[2 * i + 1] = centers[2 * i + 1] + ny;
+	}
+
+	gr_circles(offset_centers.data(), n_circles, diameter);
+
+	gr_reset_screen_scale();
+}
+
 void HudGauge::setClip(int x, int y, int w, int h)
 {
 	int hx = fl2i(HUD_offset_x);
@@ -1315,6 +1506,7 @@ void HUD_init()
 			for(j = 0; j < num_gauges; j++) {
 				it->hud_gauges[j]->initialize();
 				it->hud_gauges[j]->resetTimers();
+				it->hud_gauges[j]->resetRetainedOutput();
 				it->hud_gauges[j]->updateSexpOverride(false);
 			}
 		}
@@ -1325,6 +1517,7 @@ void HUD_init()
 	for(j = 0; j < num_gauges; j++) {
 		default_hud_gauges[j]->initialize();
 		default_hud_gauges[j]->resetTimers();
+		default_hud_gauges[j]->resetRetainedOutput();
 		default_hud_gauges[j]->updateSexpOverride(false);
 	}
 
@@ -1772,6 +1965,15 @@ void HudGaugeMissionTime::pageIn()
 	bm_page_in_aabitmap(time_gauge.first_frame, time_gauge.num_frames );
 }
 
+bool HudGaugeMissionTime::getRenderState(hud_gauge_state* state)
+{
+	// only whole seconds are shown
+	state->add((int)f2fl(Missiontime));
+	state->add(f2fl(Game_time_compression));
+
+	return true;
+}
+
 void HudGaugeMissionTime::render(float  /*frametime*/)
 {
 	float mission_time, time_comp;
@@ -1867,6 +2069,9 @@ void hud_render_gauges(int cockpit_display_num)
 		}
 	}
 
+	// Merge the draws of all gauges, most of them are bitmaps and text in the same few colors
+	gr_2d_start_batch();
+
 	// Check if this ship has its own HUD gauges. 
 	if ( sip->hud_enabled ) {
 		num_gauges = sip->hud_gauges.size();
@@ -1893,7 +2098,7 @@ void hud_render_gauges(int cockpit_display_num)
 
 			sip->hud_gauges[j]->resetClip();
 			sip->hud_gauges[j]->setFont();
-			sip->hud_gauges[j]->render(flFrametime);
+			sip->hud_gauges[j]->renderRetained(flFrametime);
 		}
 	} else {
 		num_gauges = default_hud_gauges.size();
@@ -1913,10 +2118,12 @@ void hud_render_gauges(int cockpit_display_num)
 
 			default_hud_gauges[j]->resetClip();
 			default_hud_gauges[j]->setFont();
-			default_hud_gauges[j]->render(flFrametime);
+			default_hud_gauges[j]->renderRetained(flFrametime);
 		}
 	}
 
+	gr_2d_stop_batch();
+
 	if ( cockpit_display_num >= 0 ) {
 		ship_end_render_cockpit_display(cockpit_display_num);
 
@@ -2585,6 +2792,18 @@ void HudGaugeKills::pageIn()
 	bm_page_in_aabitmap(Kills_gauge.first_frame, Kills_gauge.num_frames);
 }
 
+// the kill count is the only thing which changes
+bool HudGaugeKills::getRenderState(hud_gauge_state* state)
+{
+	if ( !Player ) {
+		return false;
+	}
+
+	state->add(Player->stats.m_kill_count_ok);
+
+	return true;
+}
+
 /**
  * @brief Display the kills gauge on the HUD
  */
@@ -18,6 +18,7 @@
 
 class object;
 struct cockpit_display;
+struct gr_2d_batch_capture;
 
 typedef struct hud_anim {
 	char filename[MAX_FILENAME_LEN];
@@ -211,6 +212,49 @@ void hud_toggle_contrast();
 void hud_set_contrast(int high);
 void hud_toggle_shadows();
 
+/**
+ * @brief The values the output of a HUD gauge depends on
+ *
+ * The values are compared exactly so two states are only equal if every value that went into them is the same.
+ */
+class hud_gauge_state
+{
+	SCP_vector<int> values;
+
+  public:
+	void clear();
+
+	void add(int value);
+	void add(float value);
+	void add(const char* str);
+	void add(const color& clr);
+
+	bool operator==(const hud_gauge_state& other) const;
+	bool operator!=(const hud_gauge_state& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief The last output of a HUD gauge together with the state it was generated from
+ *
+ * The output belongs to the gauge it was rendered by so this can't be copied.
+ */
+class hud_retained_output
+{
+  public:
+	hud_gauge_state state;
+	hud_gauge_state next_state;
+	gr_2d_batch_capture* capture = nullptr; // nullptr if there is no valid output
+	bool disabled = false; // set if the output of the gauge could not be captured
+
+	hud_retained_output();
+	~hud_retained_output();
+
+	hud_retained_output(const hud_retained_output&) = delete;
+	hud_retained_output& operator=(const hud_retained_output&) = delete;
+
+	void reset();
+};
+
 class HudGauge 
 {
 protected:
@@ -263,6 +307,22 @@ protected:
 	int target_w, target_h;
 	int target_x, target_y;
 	int display_offset_x, display_offset_y;
+
+	// Only created once the gauge renders with retained output enabled. Gauges are copied when they are set up for each
+	// ship class, the copies start without any output.
+	struct retained_output_slot {
+		std::unique_ptr<hud_retained_output> output;
+
+		retained_output_slot() = default;
+		retained_output_slot(const retained_output_slot&) {}
+		retained_output_slot& operator=(const retained_output_slot&)
+		{
+			output.reset();
+			return *this;
+		}
+	} retained;
+
+	bool getCommonRenderState(hud_gauge_state* state);
 public:
 	// constructors
 	HudGauge();
@@ -329,6 +389,20 @@ public:
 	virtual void initialize();
 	virtual void onFrame(float frametime);
 
+	/**
+	 * @brief Adds everything the output of render() depends on to the state
+	 *
+	 * Gauges which implement this must not have any side effects in render() since the previous output is reused instead
+	 * of calling render() while the state stays the same.
+	 *
+	 * @return @c false if the output can't be reused, which is the default
+	 */
+	virtual bool getRenderState(hud_gauge_state* state);
+
+	// Calls render() or reuses the previous output if the gauge and Retained_hud_gauges allow it
+	void renderRetained(float frametime);
+	void resetRetainedOutput();
+
 	bool setupRenderCanvas(int render_target = -1);
 	void setCockpitTarget(const cockpit_display *display);
 	void resetCockpitTarget();
@@ -353,6 +427,7 @@ public:
 	void renderGradientLine(int x1, int y1, int x2, int y2);
 	void renderRect(int x, int y, int w, int h);
 	void renderCircle(int x, int y, int diameter, bool filled = true);
+	void renderCircles(const int* centers, int n_circles, int diameter);
 
 	void unsize(int *x, int *y);
 	void unsize(float *x, float *y);
@@ -375,6 +450,7 @@ public:
 	void initValueOffsets(int x, int y);
 	void render(float frametime) override;
 	void pageIn() override;
+	bool getRenderState(hud_gauge_state* state) override;
 };
 
 class HudGaugeTextWarnings: public HudGauge // HUD_TEXT_FLASH
@@ -401,6 +477,7 @@ public:
 	void initTextValueOffsets(int x, int y);
 	void render(float frametime) override;
 	void pageIn() override;
+	bool getRenderState(hud_gauge_state* state) override;
 };
 
 class HudGaugeLag: public HudGauge
@@ -70,6 +70,51 @@ static SCP_list<escort_info>::iterator get_escort_entry_from_index(int index)
 	return it;
 }
 
+// original behavior replaced with similar logic to hudtargetbox.cpp, except
+// if the name is hidden, it's replaced with the class name.
+static void escort_get_ship_name(char *buf, ship *sp)
+{
+	if (((Iff_info[sp->team].flags & IFFF_WING_NAME_HIDDEN) && (sp->wingnum != -1)) || (sp->flags[Ship::Ship_Flags::Hide_ship_name]))
+	{
+		// If we're hiding the ship name, we probably shouldn't append the callsign either
+		hud_stuff_ship_class(buf, sp);
+	}
+	else
+	{
+		hud_stuff_ship_name(buf, sp);
+
+		// maybe concatenate the callsign
+		if (*buf)
+		{
+			char callsign[NAME_LENGTH];
+
+			hud_stuff_ship_callsign(callsign, sp);
+			if (*callsign)
+				sprintf(&buf[strlen(buf)], " (%s)", callsign);
+		}
+		// maybe substitute the callsign
+		else
+		{
+			hud_stuff_ship_callsign(buf, sp);
+		}
+	}
+}
+
+// the hull integrity in percent as shown on the gauge
+static int escort_get_screen_integrity(object *objp)
+{
+	float shields, integrity;
+
+	hud_get_target_strength(objp, &shields, &integrity);
+
+	int screen_integrity = (int)std::lround(integrity * 100);
+	if ( (screen_integrity == 0) && (integrity > 0) ) {
+		screen_integrity = 1;
+	}
+
+	return screen_integrity;
+}
+
 HudGaugeEscort::HudGaugeEscort():
 HudGauge(HUD_OBJECT_ESCORT, HUD_ESCORT_VIEW, false, false, (VM_EXTERNAL | VM_DEAD_VIEW | VM_WARP_CHASE | VM_PADLOCK_ANY | VM_OTHER_SHIP), 255, 255, 255)
 {
@@ -288,6 +333,49 @@ void HudGaugeEscort::render(float  /*frametime*/)
 	renderIcon(x, y, i);
 }
 
+bool HudGaugeEscort::getRenderState(hud_gauge_state* state)
+{
+	// the multiplayer entries are looked up through the net players
+	if (Game_mode & GM_MULTIPLAYER) {
+		return false;
+	}
+
+	state->add(Show_escort_view);
+
+	int num_escort_ships = std::min(hud_escort_num_ships_on_list(), Max_escort_ships);
+	state->add(num_escort_ships);
+
+	int seen_from_team = (Player_ship != nullptr) ? Player_ship->team : -1;
+	char buf[255];
+
+	for (int i = 0; i < num_escort_ships; i++) {
+		auto eship = get_escort_entry_from_index(i);
+
+		if (eship == Escort_ships.end() || eship->objnum < 0) {
+			state->add(-1);
+			continue;
+		}
+
+		object *objp = &Objects[eship->objnum];
+		ship *sp = &Ships[objp->instance];
+
+		state->add(objp->signature);
+
+		// same as setGaugeColorEscort()
+		int is_bright = (!timestamp_elapsed(eship->escort_hit_timer) && eship->escort_show_bright) ? 1 : 0;
+		state->add(*iff_get_color_by_team_and_object(sp->team, seen_from_team, is_bright, objp));
+
+		state->add(((sp->flags[Ship::Ship_Flags::Disabled]) || (ship_subsys_disrupted(sp, SUBSYSTEM_ENGINE))) ? 1 : 0);
+
+		escort_get_ship_name(buf, sp);
+		state->add(buf);
+
+		state->add(escort_get_screen_integrity(objp));
+	}
+
+	return true;
+}
+
 // draw the shield icon and integrity for the escort ship
 void HudGaugeEscort::renderIcon(int x, int y, int index)
 {
@@ -297,7 +385,6 @@ void HudGaugeEscort::renderIcon(int x, int y, int index)
 		return;
 	}
 
-	float	shields, integrity;
 	int		screen_integrity, offset, objnum = -1;
 	char	buf[255];
 
@@ -348,32 +435,7 @@ void HudGaugeEscort::renderIcon(int x, int y, int index)
 	}
 
 	// print out ship name
-	// original behavior replaced with similar logic to hudtargetbox.cpp, except
-	// if the name is hidden, it's replaced with the class name.
-	if (((Iff_info[sp->team].flags & IFFF_WING_NAME_HIDDEN) && (sp->wingnum != -1)) || (sp->flags[Ship::Ship_Flags::Hide_ship_name]))
-	{
-		// If we're hiding the ship name, we probably shouldn't append the callsign either
-		hud_stuff_ship_class(buf, sp);
-	}
-	else
-	{
-		hud_stuff_ship_name(buf, sp);
-
-		// maybe concatenate the callsign
-		if (*buf)
-		{
-			char callsign[NAME_LENGTH];
-
-			hud_stuff_ship_callsign(callsign, sp);
-			if (*callsign)
-				sprintf(&buf[strlen(buf)], " (%s)", callsign);
-		}
-		// maybe substitute the callsign
-		else
-		{
-			hud_stuff_ship_callsign(buf, sp);
-		}
-	}
+	escort_get_ship_name(buf, sp);
 
 	const int w = font::force_fit_string(buf, 255, ship_name_max_width);
 	
@@ -384,17 +446,8 @@ void HudGaugeEscort::renderIcon(int x, int y, int index)
 	}
 
 	// show ship integrity
-	hud_get_target_strength(objp, &shields, &integrity);
-	screen_integrity = (int)std::lround(integrity * 100);
-	offset = 0;
-	if ( screen_integrity < 100 ) {
-		offset = 2;
-		if ( screen_integrity == 0 ) {
-			if ( integrity > 0 ) {
-				screen_integrity = 1;
-			}
-		}
-	}
+	screen_integrity = escort_get_screen_integrity(objp);
+	offset = (screen_integrity < 100) ? 2 : 0;
 	renderPrintf( x+ship_integrity_offsets[0] + offset, y+ship_integrity_offsets[1], EG_NULL, "%d", screen_integrity);
 
 	//Let's be nice.
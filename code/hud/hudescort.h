@@ -70,6 +70,7 @@ public:
 	int setGaugeColorEscort(int index, int team);
 	void render(float frametime) override;
 	void pageIn() override;
+	bool getRenderState(hud_gauge_state* state) override;
 	void renderIcon(int x, int y, int index);
 	void renderIconDogfight(int x, int y, int index);
 };
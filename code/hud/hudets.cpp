@@ -883,6 +883,24 @@ void HudGaugeEts::pageIn()
 	bm_page_in_aabitmap( Ets_bar.first_frame, Ets_bar.num_frames );
 }
 
+/**
+ * The bars only change with the energy distribution of the player ship
+ */
+bool HudGaugeEts::getRenderState(hud_gauge_state* state)
+{
+	ship* ship_p = &Ships[Player_obj->instance];
+
+	state->add(ship_has_energy_weapons(ship_p) ? 1 : 0);
+	state->add(Player_obj->flags[Object::Object_Flags::No_shields] ? 1 : 0);
+	state->add(ship_has_engine_power(ship_p) ? 1 : 0);
+
+	state->add(ship_p->weapon_recharge_index);
+	state->add(ship_p->shield_recharge_index);
+	state->add(ship_p->engine_recharge_index);
+
+	return true;
+}
+
 /**
  * Draw one ETS bar to screen
  */
@@ -82,6 +82,7 @@ public:
 	void blitGauge(int index);
 	void render(float frametime) override;
 	void pageIn() override;
+	bool getRenderState(hud_gauge_state* state) override;
 };
 
 class HudGaugeEtsWeapons: public HudGaugeEts
@@ -1486,7 +1486,7 @@ void hud_target_missile(object *source_obj, int next_flag)
 			continue;
 
 		Assert(A->type == OBJ_WEAPON);
-		Assert((A->instance >= 0) && (A->instance < MAX_WEAPONS));
+		Assert((A->instance >= 0) && (A->instance < Weapons.capacity()));
 		wp = &Weapons[A->instance];
 		wip = &Weapon_info[wp->weapon_info_index];
 
@@ -3094,7 +3094,7 @@ void hud_process_homing_missiles()
 		if (A->flags[Object::Object_Flags::Should_be_dead])
 			continue;
 
-		Assert((A->instance >= 0) && (A->instance < MAX_WEAPONS));
+		Assert((A->instance >= 0) && (A->instance < Weapons.capacity()));
 		wp = &Weapons[A->instance];
 
 		if (wp->homing_object == Player_obj) {
@@ -3160,7 +3160,7 @@ void HudGaugeMissileTriangles::render(float  /*frametime*/)
 		if (A->flags[Object::Object_Flags::Should_be_dead])
 			continue;
 
-		Assert((A->instance >= 0) && (A->instance < MAX_WEAPONS));
+		Assert((A->instance >= 0) && (A->instance < Weapons.capacity()));
 		wp = &Weapons[A->instance];
 
 		if (wp->homing_object == Player_obj) {
@@ -11,8 +11,14 @@
 
 #include <cstdio>
 #include <numeric>
-#if _M_IX86_FP >= 1
+
+// The batch functions below work on four vectors at once if the instruction set we are built for allows it
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+	#define VM_SIMD_SSE
 	#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#define VM_SIMD_NEON
+	#include <arm_neon.h>
 #endif
 
 #include "math/vecmat.h"
@@ -923,6 +929,77 @@ vec3d *vm_vec_unrotate(vec3d *dest, const vec3d *src, const matrix *m)
 	return dest;
 }
 
+// The rows of m are the axes the vectors are projected on, so this is vm_vec_rotate() for every vector. The operations are
+// done in the same order as in vm_vec_dot() so every SIMD path gives the same result as the scalar one.
+static void vm_vec_rotate_batch_internal(vec3d *dest, const vec3d *src, size_t count, const matrix *m, const vec3d *offset)
+{
+	static_assert(sizeof(vec3d) == 3 * sizeof(float), "The batch functions require vec3d to be tightly packed!");
+
+	const vec3d add = (offset != nullptr) ? *offset : vmd_zero_vector;
+	size_t i = 0;
+
+#if defined(VM_SIMD_SSE)
+	const __m128 rx = _mm_set1_ps(m->vec.rvec.xyz.x), ry = _mm_set1_ps(m->vec.rvec.xyz.y), rz = _mm_set1_ps(m->vec.rvec.xyz.z);
+	const __m128 ux = _mm_set1_ps(m->vec.uvec.xyz.x), uy = _mm_set1_ps(m->vec.uvec.xyz.y), uz = _mm_set1_ps(m->vec.uvec.xyz.z);
+	const __m128 fx = _mm_set1_ps(m->vec.fvec.xyz.x), fy = _mm_set1_ps(m->vec.fvec.xyz.y), fz = _mm_set1_ps(m->vec.fvec.xyz.z);
+	const __m128 ox = _mm_set1_ps(add.xyz.x), oy = _mm_set1_ps(add.xyz.y), oz = _mm_set1_ps(add.xyz.z);
+
+	for (; i + 4 <= count; i += 4) {
+		float *out = &dest[i].xyz.x;
+		const float *in = &src[i].xyz.x;
+
+		// x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+		const __m128 a = _mm_loadu_ps(in);
+		const __m128 b = _mm_loadu_ps(in + 4);
+		const __m128 c = _mm_loadu_ps(in + 8);
+
+		// deinterleave into x0 x1 x2 x3 | y0 y1 y2 y3 | z0 z1 z2 z3
+		const __m128 x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(0, 1, 0, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+		const __m128 y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+
+		const __m128 rx_out = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, rx), _mm_mul_ps(y, ry)), _mm_mul_ps(z, rz)), ox);
+		const __m128 ry_out = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, ux), _mm_mul_ps(y, uy)), _mm_mul_ps(z, uz)), oy);
+		const __m128 rz_out = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, fx), _mm_mul_ps(y, fy)), _mm_mul_ps(z, fz)), oz);
+
+		// and interleave again
+		_mm_storeu_ps(out, _mm_shuffle_ps(_mm_shuffle_ps(rx_out, ry_out, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(rz_out, rx_out, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+		_mm_storeu_ps(out + 4, _mm_shuffle_ps(_mm_shuffle_ps(ry_out, rz_out, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(rx_out, ry_out, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+		_mm_storeu_ps(out + 8, _mm_shuffle_ps(_mm_shuffle_ps(rz_out, rx_out, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(ry_out, rz_out, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+	}
+#elif defined(VM_SIMD_NEON)
+	for (; i + 4 <= count; i += 4) {
+		const float32x4x3_t in = vld3q_f32(&src[i].xyz.x);
+		float32x4x3_t out;
+
+		out.val[0] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(in.val[0], m->vec.rvec.xyz.x), vmulq_n_f32(in.val[1], m->vec.rvec.xyz.y)), vmulq_n_f32(in.val[2], m->vec.rvec.xyz.z)), vdupq_n_f32(add.xyz.x));
+		out.val[1] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(in.val[0], m->vec.uvec.xyz.x), vmulq_n_f32(in.val[1], m->vec.uvec.xyz.y)), vmulq_n_f32(in.val[2], m->vec.uvec.xyz.z)), vdupq_n_f32(add.xyz.y));
+		out.val[2] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(in.val[0], m->vec.fvec.xyz.x), vmulq_n_f32(in.val[1], m->vec.fvec.xyz.y)), vmulq_n_f32(in.val[2], m->vec.fvec.xyz.z)), vdupq_n_f32(add.xyz.z));
+
+		vst3q_f32(&dest[i].xyz.x, out);
+	}
+#endif
+
+	// whatever is left over, or everything if there is no SIMD path
+	for (; i < count; ++i) {
+		dest[i] = (*m) * src[i];
+		vm_vec_add2(&dest[i], &add);
+	}
+}
+
+void vm_vec_rotate_batch(vec3d *dest, const vec3d *src, size_t count, const matrix *m)
+{
+	vm_vec_rotate_batch_internal(dest, src, count, m, nullptr);
+}
+
+void vm_vec_unrotate_batch(vec3d *dest, const vec3d *src, size_t count, const matrix *m, const vec3d *offset)
+{
+	matrix mt;
+
+	vm_copy_transpose(&mt, m);
+	vm_vec_rotate_batch_internal(dest, src, count, &mt, offset);
+}
+
 //transpose a matrix in place. returns ptr to matrix
 matrix *vm_transpose(matrix *m)
 {
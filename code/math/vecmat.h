@@ -330,6 +330,33 @@ vec3d *vm_vec_rotate(vec3d *dest, const vec3d *src, const matrix *m);
 // vm_vec_transpose() / vm_vec_rotate() technique.
 vec3d *vm_vec_unrotate(vec3d *dest, const vec3d *src, const matrix *m);
 
+/**
+ * @brief Rotates an array of vectors through a matrix, the same as calling vm_vec_rotate() for each of them
+ *
+ * @param[out] dest Array of count vectors for the results, may be the same as src
+ * @param[in] src Array of count vectors
+ * @param[in] count Number of vectors
+ * @param[in] m The matrix
+ *
+ * @note Uses SIMD instructions if they are available on the platform this is built for
+ */
+void vm_vec_rotate_batch(vec3d *dest, const vec3d *src, size_t count, const matrix *m);
+
+/**
+ * @brief Rotates an array of vectors through the transpose of a matrix, the same as calling vm_vec_unrotate() for each
+ * of them. If offset is given it is added to every result afterwards, which converts points local to an object at
+ * position offset with orientation m to world space.
+ *
+ * @param[out] dest Array of count vectors for the results, may be the same as src
+ * @param[in] src Array of count vectors
+ * @param[in] count Number of vectors
+ * @param[in] m The matrix
+ * @param[in] offset Added to every result if not nullptr
+ *
+ * @note Uses SIMD instructions if they are available on the platform this is built for
+ */
+void vm_vec_unrotate_batch(vec3d *dest, const vec3d *src, size_t count, const matrix *m, const vec3d *offset = nullptr);
+
 //transpose a matrix in place. returns ptr to matrix
 matrix *vm_transpose(matrix *m);
 
@@ -0,0 +1,274 @@
+#include "mission/missioncue.h"
+
+#include "debugconsole/console.h"
+#include "globalincs/systemvars.h"
+#include "parse/sexp.h"
+
+#include <array>
+
+bool Mission_cue_verify = false;
+
+bool Mission_cue_tracking = true;
+
+namespace {
+
+enum class CueMode {
+	Unclassified,
+	Tracked,
+	Polled,
+};
+
+using fact_versions = std::array<uint, static_cast<size_t>(CueFact::NUM_VALUES)>;
+
+struct cue_state {
+	CueMode mode     = CueMode::Unclassified;
+	int dependencies = 0;
+
+	bool valid   = false;
+	bool polling = false;
+	int result   = SEXP_FALSE;
+	fix wakeup   = -1;
+	fact_versions versions;
+};
+
+struct cue_stats {
+	uint evaluated = 0;
+	uint skipped   = 0;
+	uint polled    = 0;
+};
+
+// Indexed by the root node of the cue
+SCP_vector<cue_state> Cue_states;
+
+fact_versions Fact_versions{};
+
+// Collects the time dependencies of the cue which is currently being evaluated
+bool Cue_evaluating = false;
+fix Cue_wakeup      = -1;
+bool Cue_polling    = false;
+
+cue_stats Cue_stats;
+
+int fact_bit(CueFact fact) { return 1 << static_cast<int>(fact); }
+
+bool classify_node(int node, int& dependencies)
+{
+	if (node < 0) {
+		return true;
+	}
+
+	// a list evaluates to its first element
+	if (Sexp_nodes[node].first != -1) {
+		if (Sexp_nodes[node].subtype == SEXP_ATOM_CONTAINER_DATA) {
+			return false;
+		}
+		return classify_node(CAR(node), dependencies);
+	}
+
+	if (Sexp_nodes[node].subtype != SEXP_ATOM_OPERATOR) {
+		// variables and containers may change at any time
+		return !(Sexp_nodes[node].type & SEXP_FLAG_VARIABLE) &&
+		       Sexp_nodes[node].subtype != SEXP_ATOM_CONTAINER_NAME &&
+		       Sexp_nodes[node].subtype != SEXP_ATOM_CONTAINER_DATA;
+	}
+
+	switch (get_operator_const(node)) {
+	case OP_TRUE:
+	case OP_FALSE:
+	case OP_AND:
+	case OP_OR:
+	case OP_NOT:
+	case OP_XOR:
+	case OP_HAS_TIME_ELAPSED:
+		break;
+
+	case OP_GOAL_INCOMPLETE:
+	case OP_GOAL_TRUE_DELAY:
+	case OP_GOAL_FALSE_DELAY:
+	case OP_IS_DESTROYED_DELAY:
+	case OP_IS_SUBSYSTEM_DESTROYED_DELAY:
+	case OP_IS_DISABLED_DELAY:
+	case OP_IS_DISARMED_DELAY:
+	case OP_HAS_ARRIVED_DELAY:
+	case OP_HAS_DEPARTED_DELAY:
+	case OP_HAS_DOCKED_DELAY:
+	case OP_HAS_UNDOCKED_DELAY:
+	case OP_WAYPOINTS_DONE_DELAY:
+		dependencies |= fact_bit(CueFact::MissionLog);
+		break;
+
+	case OP_EVENT_INCOMPLETE:
+	case OP_EVENT_TRUE_DELAY:
+	case OP_EVENT_FALSE_DELAY:
+	case OP_EVENT_TRUE_MSECS_DELAY:
+	case OP_EVENT_FALSE_MSECS_DELAY:
+		dependencies |= fact_bit(CueFact::Events);
+		break;
+
+	default:
+		return false;
+	}
+
+	for (int arg = CDR(node); arg != -1; arg = CDR(arg)) {
+		if (!classify_node(arg, dependencies)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void classify_cue(int node, cue_state& state)
+{
+	state.dependencies = 0;
+
+	if (special_argument_appears_in_sexp_tree(node) || !classify_node(node, state.dependencies)) {
+		state.mode = CueMode::Polled;
+	} else {
+		state.mode = CueMode::Tracked;
+	}
+}
+
+bool is_up_to_date(const cue_state& state)
+{
+	if (!state.valid || state.polling) {
+		return false;
+	}
+
+	if (state.wakeup >= 0 && Missiontime >= state.wakeup) {
+		return false;
+	}
+
+	for (size_t i = 0; i < Fact_versions.size(); ++i) {
+		if ((state.dependencies & (1 << i)) && state.versions[i] != Fact_versions[i]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+} // namespace
+
+int mission_cue_eval(int node)
+{
+	if (node < 0 || !Mission_cue_tracking) {
+		return eval_sexp(node);
+	}
+
+	if (node >= static_cast<int>(Cue_states.size())) {
+		Cue_states.resize(node + 1);
+	}
+	auto& state = Cue_states[node];
+
+	if (state.mode == CueMode::Unclassified) {
+		classify_cue(node, state);
+	}
+
+	if (state.mode == CueMode::Polled) {
+		++Cue_stats.polled;
+		return eval_sexp(node);
+	}
+
+	const auto up_to_date = is_up_to_date(state);
+	if (up_to_date && !Mission_cue_verify) {
+		++Cue_stats.skipped;
+		return state.result;
+	}
+
+	Assertion(!Cue_evaluating, "Cues may not be evaluated recursively!");
+	Cue_evaluating = true;
+	Cue_wakeup     = -1;
+	Cue_polling    = false;
+
+	const auto result = eval_sexp(node);
+
+	Cue_evaluating = false;
+
+	if (up_to_date) {
+		// verification mode: the evaluation should not have been necessary
+		if (result != state.result) {
+			Warning(LOCATION,
+				"The tracked result of the cue starting at sexp node %d (%s) is out of date: tracked %d, evaluated %d.\n"
+				"Some game state the cue depends on was changed without notifying the cue tracker.",
+				node, CTEXT(Sexp_nodes[node].first != -1 ? CAR(node) : node), state.result, result);
+		}
+		++Cue_stats.skipped;
+	} else {
+		++Cue_stats.evaluated;
+	}
+
+	state.valid    = true;
+	state.result   = result;
+	state.wakeup   = Cue_wakeup;
+	state.polling  = Cue_polling;
+	state.versions = Fact_versions;
+
+	return result;
+}
+
+void mission_cue_fact_changed(CueFact fact) { ++Fact_versions[static_cast<size_t>(fact)]; }
+
+void mission_cue_note_wakeup(fix mission_time)
+{
+	if (!Cue_evaluating) {
+		return;
+	}
+
+	if (Cue_wakeup < 0 || mission_time < Cue_wakeup) {
+		Cue_wakeup = mission_time;
+	}
+}
+
+void mission_cue_note_polling()
+{
+	if (Cue_evaluating) {
+		Cue_polling = true;
+	}
+}
+
+void mission_cue_forget(int node)
+{
+	if (node >= 0 && node < static_cast<int>(Cue_states.size())) {
+		Cue_states[node] = cue_state();
+	}
+}
+
+void mission_cue_reset()
+{
+	Cue_states.clear();
+	Cue_stats = cue_stats();
+}
+
+DCF_BOOL2(cue_tracking, Mission_cue_tracking, "Only evaluates arrival and departure cues if their inputs changed",
+	"Usage: cue_tracking [bool]\nOnly evaluates arrival and departure cues if their inputs changed.\n");
+
+DCF_BOOL2(cue_verify, Mission_cue_verify, "Checks tracked arrival and departure cues against a full evaluation",
+	"Usage: cue_verify [bool]\nEvaluates every tracked cue and warns if the result differs from the tracked one.\n");
+
+DCF(cue_stats, "Displays how many arrival and departure cues were evaluated")
+{
+	if (dc_optional_string_either("help", "--help")) {
+		dc_printf("Usage: cue_stats [reset]\nDisplays how many cue evaluations were skipped since the mission started.\n");
+		return;
+	}
+
+	if (dc_optional_string("reset")) {
+		Cue_stats = cue_stats();
+		return;
+	}
+
+	size_t tracked = 0;
+	size_t polled  = 0;
+	for (const auto& state : Cue_states) {
+		if (state.mode == CueMode::Tracked) {
+			++tracked;
+		} else if (state.mode == CueMode::Polled) {
+			++polled;
+		}
+	}
+
+	dc_printf("Cues: " SIZE_T_ARG " tracked, " SIZE_T_ARG " polled\n", tracked, polled);
+	dc_printf("Evaluations: %u evaluated, %u skipped, %u polled\n", Cue_stats.evaluated, Cue_stats.skipped,
+		Cue_stats.polled);
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "globalincs/pstypes.h"
+
+/**
+ * @brief The kinds of game state the arrival and departure cues read
+ *
+ * A cue is only re-evaluated if one of the kinds of state it depends on changed since its last evaluation. The
+ * granularity is intentionally coarse: these change a few times per minute in a typical mission while the cues are
+ * checked every frame.
+ */
+enum class CueFact {
+	MissionLog, //!< Mission log entries, the arrival status of ships and the status of wings
+	Events,     //!< The result, formula and timestamp of mission events
+
+	NUM_VALUES
+};
+
+/**
+ * @brief Enables skipping the evaluation of cues whose inputs did not change
+ */
+extern bool Mission_cue_tracking;
+
+/**
+ * @brief Evaluates every tracked cue anyway and reports any result which differs from the tracked one
+ */
+extern bool Mission_cue_verify;
+
+/**
+ * @brief Evaluates an arrival or departure cue
+ *
+ * Cues which only consist of operators with known inputs are only evaluated if one of those inputs changed or a delay
+ * they are waiting for elapsed. All other cues are evaluated every time.
+ *
+ * @param node The root node of the cue
+ * @return The result eval_sexp() would have returned
+ */
+int mission_cue_eval(int node);
+
+/**
+ * @brief Signals that game state read by cues has changed
+ */
+void mission_cue_fact_changed(CueFact fact);
+
+/**
+ * @brief Called by the cue operators if their result depends on the mission time
+ *
+ * @param mission_time The mission time at which the result of the operator may change
+ */
+void mission_cue_note_wakeup(fix mission_time);
+
+/**
+ * @brief Called by the cue operators if their result depends on the time in a way which can't be expressed as a
+ * mission time
+ *
+ * The current cue will then be evaluated every time until its inputs change again.
+ */
+void mission_cue_note_polling();
+
+/**
+ * @brief Discards the tracked state of a sexp node since it was freed or its cached values were flushed
+ */
+void mission_cue_forget(int node);
+
+/**
+ * @brief Discards all tracked cues
+ */
+void mission_cue_reset();
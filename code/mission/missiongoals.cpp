@@ -21,6 +21,7 @@
 #include "io/key.h"
 #include "io/timer.h"
 #include "localization/localize.h"
+#include "mission/missioncue.h"
 #include "mission/missiongoals.h"
 #include "mission/missionlog.h"
 #include "missionui/missionscreencommon.h"
@@ -851,12 +852,22 @@ void mission_event_set_completion_sound_timestamp()
 }
 
 // function which evaluates and processes the given event
+// the arrival and departure cues only have to be evaluated again if the state they read from an event changed
+static void maybe_notify_cues(int event, int store_flags, int store_formula, int store_result, TIMESTAMP store_timestamp)
+{
+	auto& mev = Mission_events[event];
+	if ((store_flags != mev.flags) || (store_formula != mev.formula) || (store_result != mev.result) || (store_timestamp != mev.timestamp)) {
+		mission_cue_fact_changed(CueFact::Events);
+	}
+}
+
 void mission_process_event( int event )
 {
 	int store_flags = Mission_events[event].flags;
 	int store_formula = Mission_events[event].formula;
 	int store_result = Mission_events[event].result;
 	int store_count = Mission_events[event].count;
+	TIMESTAMP store_timestamp = Mission_events[event].timestamp;
 
 	int result, sindex;
 	bool bump_timestamp = false; 
@@ -987,6 +998,8 @@ void mission_process_event( int event )
 		Mission_events[event].repeat_count = 0;
 		Mission_events[event].formula = -1;
 
+		maybe_notify_cues(event, store_flags, store_formula, store_result, store_timestamp);
+
 		// Also send an update, if necessary.
 		if(MULTIPLAYER_MASTER && ((store_flags != Mission_events[event].flags) || (sindex != Mission_events[event].formula) || (store_formula != Mission_events[event].formula) || (store_result != Mission_events[event].result) || (store_count != Mission_events[event].count)) ){
 			send_event_update_packet(event);
@@ -1045,6 +1058,8 @@ void mission_process_event( int event )
 		}
 	}
 
+	maybe_notify_cues(event, store_flags, store_formula, store_result, store_timestamp);
+
 	// see if anything has changed	
 	if(MULTIPLAYER_MASTER && ((store_flags != Mission_events[event].flags) || (store_formula != Mission_events[event].formula) || (store_result != Mission_events[event].result) || (store_count != Mission_events[event].count)) ){
 		send_event_update_packet(event);
@@ -1262,6 +1277,8 @@ void mission_goal_fail_incomplete()
 			Mission_events[i].result = 0;
 		}
 	}
+
+	mission_cue_fact_changed(CueFact::Events);
 }
 
 // small function used to mark all objectives as true.  Used as a debug function and as a way
@@ -1284,6 +1301,8 @@ void mission_goal_mark_events_complete()
 		Mission_events[i].result = 1;
 		Mission_events[i].formula = -1;
 	}
+
+	mission_cue_fact_changed(CueFact::Events);
 }
 
 // some debug console functions to help list and change the status of mission goals
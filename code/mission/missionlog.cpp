@@ -14,6 +14,7 @@
 #include "graphics/font.h"
 #include "iff_defs/iff_defs.h"
 #include "localization/localize.h"
+#include "mission/missioncue.h"
 #include "mission/missiongoals.h"
 #include "mission/missionlog.h"
 #include "mission/missionparse.h"
@@ -57,6 +58,8 @@ void mission_log_init()
 
 	// zero out all the memory so we don't get bogus information when playing across missions!
 	log_entries.fill({});
+
+	mission_cue_fact_changed(CueFact::MissionLog);
 }
 
 // function to clean up the mission log removing obsolete entries.  Entries might get marked obsolete
@@ -76,6 +79,8 @@ void mission_log_cull_obsolete_entries()
 	if ( i == last_entry )
 		return;
 
+	mission_cue_fact_changed(CueFact::MissionLog);
+
 	// compact the log array, removing the obsolete entries.
 	index = i;						// index is the first obsolete entry
 
@@ -168,6 +173,9 @@ void mission_log_add_entry(LogType type, const char *pname, const char *sname, i
 		return;
 	}
 
+	// the arrival and departure cues need to know that the log has changed
+	mission_cue_fact_changed(CueFact::MissionLog);
+
 	last_entry_save = last_entry;
 
 	// mark any entries as obsolete.  Part of the pruning is done based on the type (and name) passed
@@ -443,6 +451,8 @@ void mission_log_add_entry_multi( LogType type, const char *pname, const char *s
 	Assert ( Game_mode & GM_MULTIPLAYER );
 	Assert ( !(Net_player->flags & NETINFO_FLAG_AM_MASTER) );
 
+	mission_cue_fact_changed(CueFact::MissionLog);
+
 	// mark any entries as obsolete.  Part of the pruning is done based on the type (and name) passed
 	// for a new entry
 	mission_log_obsolete_entries(type, pname);
@@ -1063,7 +1063,8 @@ void message_load_wave(int index, const char *filename)
 
 	game_snd_entry tmp_gse;
 	strcpy_s(tmp_gse.filename, filename);
-	Message_waves[index].num = snd_load(&tmp_gse, nullptr, 0);
+	// Messages are usually loaded in bulk during mission load so let the decoding happen in the background
+	Message_waves[index].num = snd_load_async(&tmp_gse, nullptr, 0);
 
 	if (!Message_waves[index].num.isValid())
 		nprintf(("messaging", "Cannot load message wave: %s.  Will not play\n", Message_waves[index].name));
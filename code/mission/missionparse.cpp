@@ -38,6 +38,7 @@
 #include "math/staticrand.h"
 #include "mission/missionbriefcommon.h"
 #include "mission/missioncampaign.h"
+#include "mission/missioncue.h"
 #include "mission/missiongoals.h"
 #include "mission/missionhotkey.h"
 #include "mission/missionlog.h"
@@ -132,6 +133,11 @@ int Mission_callsign_count = 0;
 // list could also include ships that are part of wings!
 p_object Ship_arrival_list;	// for linked list of ships to arrive later
 
+// Lookup tables for the ship arrival list.  Each key maps to all objects on the list with that key, in list order, so
+// that lookups find the same object as a walk of the list would.  Net signatures are only unique in multiplayer.
+static SCP_unordered_map<SCP_string, SCP_vector<p_object*>, SCP_string_lcase_hash, SCP_string_lcase_equal_to> Arrival_ship_names;
+static SCP_unordered_map<ushort, SCP_vector<p_object*>> Arrival_ship_signatures;
+
 // all the ships that we parse
 SCP_vector<p_object> Parse_objects;
 
@@ -1846,7 +1852,7 @@ void parse_create_docked_object_helper(p_object *pobjp, p_dock_function_info *in
 
 		// if it's on the list, remove it
 		if (parse_object_on_arrival_list(pobjp))
-			list_remove(&Ship_arrival_list, pobjp);
+			mission_parse_remove_arrival_ship(pobjp);
 	}
 }
 
@@ -3548,7 +3554,7 @@ void mission_parse_maybe_create_parse_object(p_object *pobjp)
 		Assert (pobjp->destroy_before_mission_time < 0);
 
 		// add to arrival list
-		list_append(&Ship_arrival_list, pobjp);
+		mission_parse_add_arrival_ship(pobjp);
 
 		// we need to deal with replacement textures now, so that texture page-in will work properly
 		mission_parse_handle_late_arrivals(pobjp);
@@ -3584,6 +3590,7 @@ void mission_parse_maybe_create_parse_object(p_object *pobjp)
 				entry->objp = nullptr;
 				entry->shipp = nullptr;
 				entry->cleanup_mode = SHIP_DESTROYED;
+				mission_cue_fact_changed(CueFact::MissionLog);
 
 				// once the ship is exploded, find the debris pieces belonging to this object, mark them
 				// as not to expire, and move them forward in time N seconds
@@ -4051,7 +4058,7 @@ int parse_wing_create_ships( wing *wingp, int num_to_create, bool force_create,
 		// 2) multiplayer and I am the host of the game
 		// can't create any ships if the arrival cue is false or the timestamp has not elapsed.
 
-		if ( !force_arrival && !eval_sexp(wingp->arrival_cue) )
+		if ( !force_arrival && !mission_cue_eval(wingp->arrival_cue) )
 			return 0;
 
 		// once the sexpressions becomes true, then check the arrival delay on the wing.  The first time, the
@@ -4088,6 +4095,7 @@ int parse_wing_create_ships( wing *wingp, int num_to_create, bool force_create,
 
 				// set the gone flag
                 wingp->flags.set(Ship::Wing_Flags::Gone);
+				mission_cue_fact_changed(CueFact::MissionLog);
 
 				// mark the number of waves and number of ships destroyed equal to the last wave and the number
 				// of ships yet to arrive
@@ -4245,7 +4253,9 @@ int parse_wing_create_ships( wing *wingp, int num_to_create, bool force_create,
 		if (wingp->num_waves > 1)
 		{
 			bool needs_display_name;
-			wing_bash_ship_name(p_objp->name, wingp->name, wingp->total_arrived_count + wingp->red_alert_skipped_ships, &needs_display_name);
+			char ship_name[NAME_LENGTH];
+			wing_bash_ship_name(ship_name, wingp->name, wingp->total_arrived_count + wingp->red_alert_skipped_ships, &needs_display_name);
+			mission_parse_set_name(p_objp, ship_name);
 
 			// set up display name if we need to
 			// (In the unlikely edge case where the ship already has a display name for some reason, it will be overwritten.
@@ -4276,7 +4286,7 @@ int parse_wing_create_ships( wing *wingp, int num_to_create, bool force_create,
 		{
 			// Cyborg -- Also, then we need to subtract the original wave's number of fighters 
 			// and also subtract 1 to use the wing's starting signature
-			p_objp->net_signature = (ushort) (wingp->net_signature + wingp->total_arrived_count - (wingp->wave_count + 1));
+			mission_parse_set_net_signature(p_objp, (ushort) (wingp->net_signature + wingp->total_arrived_count - (wingp->wave_count + 1)));
 		}
 
 
@@ -4321,7 +4331,7 @@ int parse_wing_create_ships( wing *wingp, int num_to_create, bool force_create,
 				if (wingp->num_waves == wingp->current_wave)
 				{
 					// remove p_objp from the list
-					list_remove(&Ship_arrival_list, p_objp);
+					mission_parse_remove_arrival_ship(p_objp);
 					
 					// free up sexp nodes for reuse
 					if (p_objp->ai_goals != -1)
@@ -6570,7 +6580,7 @@ void mission_init(mission *pm)
 	Total_initially_docked = 0;
 
 	Parse_objects.clear();
-	list_init(&Ship_arrival_list);	// init list for arrival ships
+	mission_parse_reset_arrival_list();	// init list for arrival ships
 
 	Subsys_index = 0;
 	Subsys_status_size = 0;
@@ -6689,7 +6699,10 @@ void mission_parse_close()
 	}
 
 	// the destructor for each p_object will clear its dock list
+	mission_parse_reset_arrival_list();
 	Parse_objects.clear();
+
+	mission_cue_reset();
 }
 
 /**
@@ -7122,20 +7135,14 @@ int mission_parse_get_multi_mission_info( const char *filename )
  */
 p_object *mission_parse_get_arrival_ship(const char *name)
 {
-	p_object *p_objp;
-
 	if (name == nullptr)
 		return nullptr;
 
-	for (p_objp = GET_FIRST(&Ship_arrival_list); p_objp != END_OF_LIST(&Ship_arrival_list); p_objp = GET_NEXT(p_objp))
-	{
-		if (!stricmp(p_objp->name, name)) 
-		{
-			return p_objp;	// still on the arrival list
-		}
-	}
+	auto it = Arrival_ship_names.find(name);
+	if (it == Arrival_ship_names.end())
+		return nullptr;
 
-	return nullptr;
+	return it->second.front();	// still on the arrival list
 }
 
 /**
@@ -7148,17 +7155,112 @@ p_object *mission_parse_get_arrival_ship(const char *name)
  */
 p_object *mission_parse_get_arrival_ship(ushort net_signature)
 {
-	p_object *p_objp;
+	auto it = Arrival_ship_signatures.find(net_signature);
+	if (it == Arrival_ship_signatures.end())
+		return nullptr;
+
+	return it->second.front();	// still on the arrival list
+}
+
+template <typename Map, typename Key>
+static void arrival_index_remove(Map &index, const Key &key, p_object *p_objp)
+{
+	auto it = index.find(key);
+	Assertion(it != index.end(), "Parse object %s is missing from the arrival list index!", p_objp->name);
+	if (it == index.end())
+		return;
+
+	auto &objects = it->second;
+	objects.erase(std::remove(objects.begin(), objects.end(), p_objp), objects.end());
 
-	for (p_objp = GET_FIRST(&Ship_arrival_list); p_objp !=END_OF_LIST(&Ship_arrival_list); p_objp = GET_NEXT(p_objp))
+	if (objects.empty())
+		index.erase(it);
+}
+
+// Re-adds an object which is already on the arrival list to an index, keeping the list order of objects with the same key
+template <typename Map, typename Key>
+static void arrival_index_insert(Map &index, const Key &key, p_object *p_objp)
+{
+	auto &objects = index[key];
+	auto pos = objects.begin();
+	for (p_object *other = GET_FIRST(&Ship_arrival_list); other != p_objp; other = GET_NEXT(other))
 	{
-		if (p_objp->net_signature == net_signature) 
-		{
-			return p_objp;	// still on the arrival list
-		}
+		if (pos != objects.end() && *pos == other)
+			++pos;
 	}
+	objects.insert(pos, p_objp);
+}
 
-	return NULL;
+/**
+ * @brief Appends a parse object to the ship arrival list
+ */
+void mission_parse_add_arrival_ship(p_object *p_objp)
+{
+	list_append(&Ship_arrival_list, p_objp);
+
+	Arrival_ship_names[p_objp->name].push_back(p_objp);
+	Arrival_ship_signatures[p_objp->net_signature].push_back(p_objp);
+}
+
+/**
+ * @brief Removes a parse object from the ship arrival list
+ */
+void mission_parse_remove_arrival_ship(p_object *p_objp)
+{
+	Assert(parse_object_on_arrival_list(p_objp));
+
+	arrival_index_remove(Arrival_ship_names, SCP_string(p_objp->name), p_objp);
+	arrival_index_remove(Arrival_ship_signatures, p_objp->net_signature, p_objp);
+
+	list_remove(&Ship_arrival_list, p_objp);
+}
+
+/**
+ * @brief Empties the ship arrival list
+ */
+void mission_parse_reset_arrival_list()
+{
+	list_init(&Ship_arrival_list);
+
+	Arrival_ship_names.clear();
+	Arrival_ship_signatures.clear();
+}
+
+/**
+ * @brief Changes the net signature of a parse object.  This must be used instead of setting the signature directly since
+ * the object may be on the arrival list.
+ */
+void mission_parse_set_net_signature(p_object *p_objp, ushort net_signature)
+{
+	if (p_objp->net_signature == net_signature)
+		return;
+
+	if (!parse_object_on_arrival_list(p_objp))
+	{
+		p_objp->net_signature = net_signature;
+		return;
+	}
+
+	arrival_index_remove(Arrival_ship_signatures, p_objp->net_signature, p_objp);
+	p_objp->net_signature = net_signature;
+	arrival_index_insert(Arrival_ship_signatures, net_signature, p_objp);
+}
+
+/**
+ * @brief Renames a parse object.  This must be used instead of writing the name directly since the object may be on the
+ * arrival list.
+ */
+void mission_parse_set_name(p_object *p_objp, const char *name)
+{
+	if (!parse_object_on_arrival_list(p_objp))
+	{
+		strcpy_s(p_objp->name, name);
+		return;
+	}
+
+	arrival_index_remove(Arrival_ship_names, SCP_string(p_objp->name), p_objp);
+	strcpy_s(p_objp->name, name);
+	arrival_index_insert(Arrival_ship_names, SCP_string(p_objp->name), p_objp);
 }
 
 /**
@@ -7348,7 +7450,7 @@ void mission_parse_mark_reinforcement_available(char *name)
 int mission_did_ship_arrive(p_object *objp, bool force_arrival)
 {
 	// find out if the arrival cue became true
-	bool should_arrive = force_arrival || eval_sexp(objp->arrival_cue);
+	bool should_arrive = force_arrival || mission_cue_eval(objp->arrival_cue);
 
 	// we must first check to see if this ship is a reinforcement or not.  If so, then don't
 	// process
@@ -7460,7 +7562,7 @@ bool mission_maybe_make_ship_arrive(p_object *p_objp, bool force_arrival)
 	if (p_objp == Arriving_support_ship)
 		mission_parse_support_arrived(objnum);		// support ships have some unique housekeeping and are never on the arrival list
 	else if (parse_object_on_arrival_list(p_objp))
-		list_remove(&Ship_arrival_list, p_objp);	// remove from arrival list
+		mission_parse_remove_arrival_ship(p_objp);	// remove from arrival list
 
 	return true;
 }
@@ -7618,7 +7720,7 @@ bool mission_maybe_make_wing_arrive(int wingnum, bool force_arrival)
 	{
 		// check to see in the wings arrival cue is true, and if so, then mark the reinforcement
 		// as available
-		if (force_arrival || eval_sexp(wingp->arrival_cue))
+		if (force_arrival || mission_cue_eval(wingp->arrival_cue))
 			mission_parse_mark_reinforcement_available(wingp->name);
 
 		// if we're forcing the arrival, then "use" the reinforcement; otherwise don't process anything else
@@ -7914,7 +8016,7 @@ void mission_eval_departures()
 			// when the departure cue becomes true, set off the departure delay timer.  We store the
 			// timer as -seconds in FreeSpace which indicates that the timer has not been set.  If the timer
 			// is not set, then turn it into a valid timer and keep evaluating the timer until it is elapsed
-			if ( eval_sexp(shipp->departure_cue) ) {
+			if ( mission_cue_eval(shipp->departure_cue) ) {
 				if ( shipp->departure_delay <= 0 )
 					shipp->departure_delay = timestamp(-shipp->departure_delay * 1000 );
 				if ( timestamp_elapsed(shipp->departure_delay) )
@@ -7940,7 +8042,7 @@ void mission_eval_departures()
 		// that have not yet arrived as departed if they never arrive -- this may be bad, but for some reason
 		// seems like the right thing to do).
 
-		if ( eval_sexp(wingp->departure_cue) ) {
+		if ( mission_cue_eval(wingp->departure_cue) ) {
 			// if we haven't set up the departure timer yet (would be <= 0) setup the timer to pop N seconds
 			// later
 			if ( wingp->departure_delay <= 0 )
@@ -451,6 +451,11 @@ void mission_init(mission *pm);
 bool parse_main(const char *mission_name, int flags = 0);
 p_object *mission_parse_get_arrival_ship(ushort net_signature);
 p_object *mission_parse_get_arrival_ship(const char *name);
+void mission_parse_add_arrival_ship(p_object *p_objp);
+void mission_parse_remove_arrival_ship(p_object *p_objp);
+void mission_parse_reset_arrival_list();
+void mission_parse_set_net_signature(p_object *p_objp, ushort net_signature);
+void mission_parse_set_name(p_object *p_objp, const char *name);
 bool mission_check_ship_yet_to_arrive(const char *name);
 p_object *mission_parse_get_parse_object(ushort net_signature);
 p_object *mission_parse_get_parse_object(const char *name);
@@ -2527,7 +2527,7 @@ commit_pressed_status create_wings(bool API_Access)
 				case WING_SLOT_EMPTY:	
 					// delete ship that is not going to be used by the wing
 					if ( wb->is_late ) {
-						list_remove( &Ship_arrival_list, &Parse_objects[ws->sa_index]);
+						mission_parse_remove_arrival_ship(&Parse_objects[ws->sa_index]);
 						wp->wave_count--;
 						Assert(wp->wave_count >= 0);
 					}
@@ -23,6 +23,7 @@
 #include "io/timer.h"
 #include "mission/missionbriefcommon.h"
 #include "mission/missioncampaign.h"
+#include "mission/missioncue.h"
 #include "mission/missiongoals.h"
 #include "missionui/missionscreencommon.h"
 #include "missionui/missionweaponchoice.h"
@@ -1118,8 +1119,10 @@ void red_alert_bash_wingman_status()
 			wingp->current_wave++;
 
 			bool waves_spent = wingp->current_wave >= wingp->num_waves;
-            if (waves_spent)
-                wingp->flags.set(Ship::Wing_Flags::Gone);
+			if (waves_spent) {
+				wingp->flags.set(Ship::Wing_Flags::Gone);
+				mission_cue_fact_changed(CueFact::MissionLog);
+			}
 
 			// look through all ships yet to arrive...
 			for (p_object *pobjp = GET_FIRST(&Ship_arrival_list); pobjp != END_OF_LIST(&Ship_arrival_list); pobjp = GET_NEXT(pobjp))
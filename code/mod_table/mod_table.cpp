@@ -144,6 +144,8 @@ bool Countermeasures_use_capacity;
 bool Play_thruster_sounds_for_player;
 std::array<std::tuple<float, float>, 6> Fred_spacemouse_nonlinearity;
 bool Randomize_particle_rotation;
+bool Asteroid_field_rocks;
+bool Retained_hud_gauges;
 
 static auto DiscordOption __UNUSED = options::OptionBuilder<bool>("Other.Discord", "Discord Presence", "Toggle Discord Rich Presence")
 							 .category("Other")
@@ -400,6 +402,13 @@ void parse_mod_table(const char *filename)
 			stuff_boolean(&HUD_shadows);
 		}
 
+		if (optional_string("$Retain HUD gauge output:")) {
+			stuff_boolean(&Retained_hud_gauges);
+			if (Retained_hud_gauges) {
+				mprintf(("Game Settings Table: HUD gauges which support it are only redrawn when their state changes\n"));
+			}
+		}
+
 		optional_string("#SEXP SETTINGS");
 
 		if (optional_string("$Loop SEXPs Then Arguments:")) {
@@ -1280,6 +1289,13 @@ void parse_mod_table(const char *filename)
 			stuff_boolean(&Countermeasures_use_capacity);
 		}
 
+		if (optional_string("$Use field rocks for passive asteroid fields:")) {
+			stuff_boolean(&Asteroid_field_rocks);
+			if (Asteroid_field_rocks) {
+				mprintf(("Game Settings Table: Passive asteroid fields only create objects near ships and weapons\n"));
+			}
+		}
+
 		required_string("#END");
 	}
 	catch (const parse::ParseException& e)
@@ -1456,6 +1472,8 @@ void mod_table_reset()
 			std::tuple<float, float>{ 1.0f, 1.0f }
 		}};
 	Randomize_particle_rotation = false;
+	Asteroid_field_rocks = false;
+	Retained_hud_gauges = false;
 }
 
 void mod_table_set_version_flags()
@@ -140,6 +140,8 @@ extern bool Countermeasures_use_capacity;
 extern bool Play_thruster_sounds_for_player;
 extern std::array<std::tuple<float, float>, 6> Fred_spacemouse_nonlinearity;
 extern bool Randomize_particle_rotation;
+extern bool Asteroid_field_rocks;
+extern bool Retained_hud_gauges;
 
 void mod_table_init();
 void mod_table_post_process();
@@ -414,6 +414,7 @@ public:
 	vec3d	min;						// The min point of this object's geometry
 	vec3d	max;						// The max point of this object's geometry
 	vec3d	bounding_box[8];		// calculated fron min/max
+	float	cull_radius = 0.0f;		// radius around the pivot point which contains the bounding box, used for view culling
 
 	int		my_replacement;		// If not -1 this subobject is what should get rendered instead of this one
 	int		i_replace;				// If this is not -1, then this subobject will replace i_replace when it is damaged
@@ -972,6 +973,26 @@ int model_load(ship_info* sip, bool prefer_tech_model);
 // Loads a model from disk and returns the model number it loaded into.
 int model_load(const char *filename, int n_subsystems, model_subsystem *subsystems, int ferror = 1, int duplicate = 0);
 
+// During level load, the collision trees and vertex buffers of loaded models are generated in parallel once all models
+// of the mission are known. This generates them right away for every model which is still waiting. Rendering, collision
+// detection and everything else which reads the collision trees call this so that they never see a model without
+// geometry.
+void model_finish_pending_loads();
+
+// While this exists, model_load() leaves generating the geometry to model_finish_pending_loads(). Whatever is still
+// pending when the last one goes away is generated then, so an aborted level load can't leave loading deferred.
+class model_geometry_deferral {
+  public:
+	model_geometry_deferral();
+	~model_geometry_deferral();
+
+	model_geometry_deferral(const model_geometry_deferral&) = delete;
+	model_geometry_deferral& operator=(const model_geometry_deferral&) = delete;
+
+  private:
+	bool _previous;
+};
+
 int model_create_instance(int objnum, int model_num);
 void model_delete_instance(int model_instance_num);
 
@@ -1422,6 +1443,7 @@ void model_draw_paths_htl( int model_num, uint flags );
 
 void model_draw_bay_paths_htl(int model_num);
 
+void model_interp_set_buffer_layout(vertex_layout *layout);
 bool model_interp_config_buffer(indexed_vertex_source *vert_src, vertex_buffer *vb, bool update_ibuffer_only);
 bool model_interp_pack_buffer(indexed_vertex_source *vert_src, vertex_buffer *vb);
 void model_interp_submit_buffers(indexed_vertex_source *vert_src, size_t vertex_stride);
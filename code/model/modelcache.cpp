@@ -0,0 +1,501 @@
+/*
+ * Precooked model data cache
+ *
+ * Turning the BSP data of a POF into collision trees and interleaved vertex and index buffers is the most expensive
+ * part of loading a model. If enabled with -model_cache, the results of that processing are stored in the cache
+ * directory and are read back with a single read the next time the same POF is loaded.
+ */
+
+#include "model/modelcache.h"
+
+#include "bmpman/bmpman.h"
+#include "cfile/cfile.h"
+#include "cmdline/cmdline.h"
+#include "globalincs/version.h"
+#include "model/model.h"
+#include "parse/parselo.h"
+#include "tracing/tracing.h"
+
+namespace {
+
+const uint MODEL_CACHE_MAGIC  = 0x434D5046; // "FPMC"
+const int MODEL_CACHE_VERSION = 1;
+
+class cache_writer {
+	SCP_vector<ubyte>& _out;
+
+  public:
+	explicit cache_writer(SCP_vector<ubyte>& out) : _out(out) {}
+
+	void put_bytes(const void* data, size_t size)
+	{
+		auto bytes = static_cast<const ubyte*>(data);
+		_out.insert(_out.end(), bytes, bytes + size);
+	}
+
+	template <typename T>
+	void put(const T& value)
+	{
+		put_bytes(&value, sizeof(T));
+	}
+
+	template <typename T>
+	void put_array(const T* values, size_t count)
+	{
+		put<uint>(static_cast<uint>(count));
+		if (count > 0) {
+			put_bytes(values, sizeof(T) * count);
+		}
+	}
+
+	void put_string(const SCP_string& str) { put_array(str.data(), str.size()); }
+};
+
+class cache_reader {
+	const ubyte* _data;
+	size_t _size;
+	size_t _pos = 0;
+	bool _valid = true;
+
+  public:
+	cache_reader(const ubyte* data, size_t size) : _data(data), _size(size) {}
+
+	bool valid() const { return _valid; }
+
+	const ubyte* get_bytes(size_t size)
+	{
+		if (!_valid || size > _size - _pos) {
+			_valid = false;
+			return nullptr;
+		}
+
+		auto ptr = _data + _pos;
+		_pos += size;
+		return ptr;
+	}
+
+	template <typename T>
+	T get()
+	{
+		T value{};
+		auto ptr = get_bytes(sizeof(T));
+		if (ptr != nullptr) {
+			memcpy(&value, ptr, sizeof(T));
+		}
+		return value;
+	}
+
+	// Returns a pointer to count elements of T. The data may not be aligned so it must be copied before use.
+	const ubyte* get_array(size_t& count, size_t element_size)
+	{
+		count = get<uint>();
+		if (count == 0) {
+			return nullptr;
+		}
+		if (count > (_size - _pos) / element_size) {
+			_valid = false;
+			return nullptr;
+		}
+		return get_bytes(count * element_size);
+	}
+
+	template <typename T>
+	T* get_malloc_array(size_t& count)
+	{
+		auto src = get_array(count, sizeof(T));
+		if (src == nullptr) {
+			return nullptr;
+		}
+
+		auto dest = static_cast<T*>(vm_malloc(sizeof(T) * count));
+		memcpy(dest, src, sizeof(T) * count);
+		return dest;
+	}
+
+	template <typename T>
+	void get_vector(SCP_vector<T>& out)
+	{
+		size_t count;
+		auto src = get_array(count, sizeof(T));
+
+		out.resize(count);
+		if (src != nullptr) {
+			memcpy(out.data(), src, sizeof(T) * count);
+		}
+	}
+
+	SCP_string get_string()
+	{
+		size_t count;
+		auto src = get_array(count, 1);
+		return src != nullptr ? SCP_string(reinterpret_cast<const char*>(src), count) : SCP_string();
+	}
+};
+
+// The collision tree does not store the size of its vertex list so it has to be reconstructed from the leaves
+size_t collision_tree_num_tmap_verts(const bsp_collision_tree* tree)
+{
+	size_t num_verts = 0;
+	for (int i = 0; i < tree->n_leaves; ++i) {
+		const auto& leaf = tree->leaf_list[i];
+		num_verts = std::max(num_verts, static_cast<size_t>(leaf.vert_start) + leaf.num_verts);
+	}
+	return num_verts;
+}
+
+void write_collision_tree(cache_writer& writer, const bsp_collision_tree* tree)
+{
+	writer.put_array(tree->point_list, static_cast<size_t>(tree->n_verts));
+	writer.put_array(tree->node_list, static_cast<size_t>(tree->n_nodes));
+	writer.put_array(tree->leaf_list, static_cast<size_t>(tree->n_leaves));
+	writer.put_array(tree->vert_list, collision_tree_num_tmap_verts(tree));
+	writer.put_array(tree->poly_centers.data(), tree->poly_centers.size());
+}
+
+void read_collision_tree(cache_reader& reader, bsp_collision_tree* tree)
+{
+	size_t count;
+
+	tree->point_list = reader.get_malloc_array<vec3d>(count);
+	tree->n_verts    = static_cast<int>(count);
+
+	tree->node_list = reader.get_malloc_array<bsp_collision_node>(count);
+	tree->n_nodes   = static_cast<int>(count);
+
+	tree->leaf_list = reader.get_malloc_array<bsp_collision_leaf>(count);
+	tree->n_leaves  = static_cast<int>(count);
+
+	tree->vert_list = reader.get_malloc_array<model_tmap_vert>(count);
+
+	reader.get_vector(tree->poly_centers);
+}
+
+// Only the parts that are still needed after the buffers have been submitted are stored. The index data is part of the
+// index list of the model.
+void write_vertex_buffer(cache_writer& writer, const vertex_buffer& vb)
+{
+	writer.put<int>(vb.flags);
+	writer.put<uint64_t>(vb.stride);
+	writer.put<uint64_t>(vb.vertex_offset);
+	writer.put<uint64_t>(vb.vertex_num_offset);
+	writer.put<ubyte>(vb.layout.get_num_vertex_components() > 0 ? 1 : 0);
+
+	writer.put<uint>(static_cast<uint>(vb.tex_buf.size()));
+	for (const auto& buffer : vb.tex_buf) {
+		writer.put<int>(buffer.flags);
+		writer.put<int>(buffer.texture);
+		writer.put<uint64_t>(buffer.n_verts);
+		writer.put<uint64_t>(buffer.index_offset);
+		writer.put<uint>(buffer.i_first);
+		writer.put<uint>(buffer.i_last);
+	}
+}
+
+void read_vertex_buffer(cache_reader& reader, vertex_buffer& vb)
+{
+	vb.clear();
+
+	vb.flags             = reader.get<int>();
+	vb.stride            = static_cast<size_t>(reader.get<uint64_t>());
+	vb.vertex_offset     = static_cast<size_t>(reader.get<uint64_t>());
+	vb.vertex_num_offset = static_cast<size_t>(reader.get<uint64_t>());
+
+	if (reader.get<ubyte>() != 0 && vb.layout.get_num_vertex_components() == 0) {
+		model_interp_set_buffer_layout(&vb.layout);
+	}
+
+	auto num_buffers = reader.get<uint>();
+	for (uint i = 0; i < num_buffers && reader.valid(); ++i) {
+		buffer_data buffer;
+		buffer.flags        = reader.get<int>();
+		buffer.texture      = reader.get<int>();
+		buffer.n_verts      = static_cast<size_t>(reader.get<uint64_t>());
+		buffer.index_offset = static_cast<size_t>(reader.get<uint64_t>());
+		buffer.i_first      = reader.get<uint>();
+		buffer.i_last       = reader.get<uint>();
+
+		vb.tex_buf.push_back(buffer);
+	}
+}
+
+void write_key(cache_writer& writer, const model_cache_key& key)
+{
+	writer.put<uint>(key.pof_checksum);
+	writer.put<int>(key.pof_size);
+	writer.put<uint>(key.texture_signature);
+	writer.put<ubyte>(key.tangents ? 1 : 0);
+	writer.put<ubyte>(key.vertex_buffers ? 1 : 0);
+}
+
+bool read_key_matches(cache_reader& reader, const model_cache_key& key)
+{
+	auto pof_checksum      = reader.get<uint>();
+	auto pof_size          = reader.get<int>();
+	auto texture_signature = reader.get<uint>();
+	auto tangents          = reader.get<ubyte>() != 0;
+	auto vertex_buffers    = reader.get<ubyte>() != 0;
+
+	return reader.valid() && pof_checksum == key.pof_checksum && pof_size == key.pof_size &&
+	       texture_signature == key.texture_signature && tangents == key.tangents &&
+	       vertex_buffers == key.vertex_buffers;
+}
+
+// The sizes of the structures which are stored verbatim. If any of them changes, the cache is invalid.
+void write_layout_signature(cache_writer& writer)
+{
+	writer.put<uint>(static_cast<uint>(sizeof(vec3d)));
+	writer.put<uint>(static_cast<uint>(sizeof(vertex)));
+	writer.put<uint>(static_cast<uint>(sizeof(bsp_collision_node)));
+	writer.put<uint>(static_cast<uint>(sizeof(bsp_collision_leaf)));
+	writer.put<uint>(static_cast<uint>(sizeof(model_tmap_vert)));
+}
+
+bool read_layout_signature_matches(cache_reader& reader)
+{
+	SCP_vector<ubyte> expected;
+	cache_writer writer(expected);
+	write_layout_signature(writer);
+
+	auto actual = reader.get_bytes(expected.size());
+	return actual != nullptr && memcmp(actual, expected.data(), expected.size()) == 0;
+}
+
+void discard_cached_data(polymodel* pm)
+{
+	for (int i = 0; i < pm->n_models; ++i) {
+		auto& sm = pm->submodel[i];
+
+		if (sm.collision_tree_index >= 0) {
+			model_remove_bsp_collision_tree(sm.collision_tree_index);
+			sm.collision_tree_index = -1;
+		}
+
+		sm.buffer.clear();
+		sm.trans_buffer.clear();
+
+		if (sm.outline_buffer != nullptr) {
+			vm_free(sm.outline_buffer);
+			sm.outline_buffer = nullptr;
+		}
+		sm.n_verts_outline = 0;
+	}
+
+	for (int i = 0; i < pm->n_detail_levels; ++i) {
+		pm->detail_buffers[i].clear();
+	}
+
+	pm->flags &= ~(PM_FLAG_BATCHED | PM_FLAG_TRANS_BUFFER);
+
+	if (pm->vert_source.Vertex_list != nullptr) {
+		vm_free(pm->vert_source.Vertex_list);
+		pm->vert_source.Vertex_list = nullptr;
+	}
+	if (pm->vert_source.Index_list != nullptr) {
+		vm_free(pm->vert_source.Index_list);
+		pm->vert_source.Index_list = nullptr;
+	}
+	pm->vert_source.Vertex_list_size = 0;
+	pm->vert_source.Index_list_size  = 0;
+}
+
+SCP_string model_cache_name(const polymodel* pm, const model_cache_key& key)
+{
+	char base[MAX_FILENAME_LEN];
+	strcpy_s(base, pm->filename);
+
+	auto ext = strrchr(base, '.');
+	if (ext != nullptr) {
+		*ext = '\0';
+	}
+
+	SCP_string name;
+	sprintf(name, "%s-%08x-%x.pmc", base, key.pof_checksum, static_cast<uint>(key.pof_size));
+	SCP_tolower(name);
+	return name;
+}
+
+} // namespace
+
+bool model_cache_make_key(polymodel* pm, const char* filename, model_cache_key& key)
+{
+	auto fp = cfopen(filename, "rb", CFILE_NORMAL, CF_TYPE_MODELS);
+	if (fp == nullptr) {
+		return false;
+	}
+
+	key.pof_size = cfilelength(fp);
+	auto ok      = cf_chksum_long(fp, &key.pof_checksum) != 0;
+	cfclose(fp);
+
+	if (!ok) {
+		return false;
+	}
+
+	// Only textures with an alpha channel affect the generated data
+	uint signature = 0;
+	for (int i = 0; i < pm->n_textures; ++i) {
+		auto handle = pm->maps[i].textures[TM_BASE_TYPE].GetTexture();
+		if (handle < 0 || !bm_has_alpha_channel(handle)) {
+			continue;
+		}
+
+		int w, h;
+		bm_get_info(handle, &w, &h);
+
+		SCP_string texture;
+		sprintf(texture, "%d:%s:%dx%d;", i, bm_get_filename(handle), w, h);
+		signature = cf_add_chksum_long(signature, reinterpret_cast<ubyte*>(&texture[0]), texture.size());
+	}
+
+	key.texture_signature = signature;
+	key.tangents          = Cmdline_normal != 0;
+	key.vertex_buffers    = !Is_standalone;
+
+	return true;
+}
+
+void model_cache_write(const polymodel* pm, const model_cache_key& key, size_t vertex_stride, SCP_vector<ubyte>& out)
+{
+	cache_writer writer(out);
+
+	writer.put<uint>(MODEL_CACHE_MAGIC);
+	writer.put<int>(MODEL_CACHE_VERSION);
+	writer.put_string(gameversion::get_version_string());
+	write_layout_signature(writer);
+	write_key(writer, key);
+
+	writer.put<int>(pm->n_models);
+	for (int i = 0; i < pm->n_models; ++i) {
+		const auto& sm = pm->submodel[i];
+
+		write_collision_tree(writer, model_get_bsp_collision_tree(sm.collision_tree_index));
+
+		if (key.vertex_buffers) {
+			write_vertex_buffer(writer, sm.buffer);
+			write_vertex_buffer(writer, sm.trans_buffer);
+			writer.put_array(sm.outline_buffer, sm.n_verts_outline);
+		}
+	}
+
+	if (key.vertex_buffers) {
+		writer.put<int>(pm->n_detail_levels);
+		for (int i = 0; i < pm->n_detail_levels; ++i) {
+			write_vertex_buffer(writer, pm->detail_buffers[i]);
+		}
+
+		writer.put<int>(pm->flags & (PM_FLAG_BATCHED | PM_FLAG_TRANS_BUFFER));
+		writer.put<uint64_t>(vertex_stride);
+
+		writer.put_array(static_cast<const ubyte*>(pm->vert_source.Vertex_list),
+			pm->vert_source.Vertex_list != nullptr ? pm->vert_source.Vertex_list_size : 0);
+		writer.put_array(static_cast<const ubyte*>(pm->vert_source.Index_list),
+			pm->vert_source.Index_list != nullptr ? pm->vert_source.Index_list_size : 0);
+	}
+}
+
+bool model_cache_read(polymodel* pm, const model_cache_key& key, const ubyte* data, size_t size, size_t& vertex_stride)
+{
+	cache_reader reader(data, size);
+
+	if (reader.get<uint>() != MODEL_CACHE_MAGIC || reader.get<int>() != MODEL_CACHE_VERSION) {
+		return false;
+	}
+	if (reader.get_string() != gameversion::get_version_string() || !read_layout_signature_matches(reader)) {
+		// Written by a different build
+		return false;
+	}
+	if (!read_key_matches(reader, key) || reader.get<int>() != pm->n_models) {
+		return false;
+	}
+
+	for (int i = 0; i < pm->n_models && reader.valid(); ++i) {
+		auto& sm = pm->submodel[i];
+
+		sm.collision_tree_index = model_create_bsp_collision_tree();
+		read_collision_tree(reader, model_get_bsp_collision_tree(sm.collision_tree_index));
+
+		if (key.vertex_buffers) {
+			read_vertex_buffer(reader, sm.buffer);
+			read_vertex_buffer(reader, sm.trans_buffer);
+
+			size_t num_outline_verts;
+			sm.outline_buffer  = reader.get_malloc_array<vertex>(num_outline_verts);
+			sm.n_verts_outline = static_cast<uint>(num_outline_verts);
+		}
+	}
+
+	if (key.vertex_buffers) {
+		if (reader.get<int>() != pm->n_detail_levels) {
+			discard_cached_data(pm);
+			return false;
+		}
+		for (int i = 0; i < pm->n_detail_levels; ++i) {
+			read_vertex_buffer(reader, pm->detail_buffers[i]);
+		}
+
+		pm->flags |= reader.get<int>();
+		vertex_stride = static_cast<size_t>(reader.get<uint64_t>());
+
+		size_t count;
+		pm->vert_source.Vertex_list      = reader.get_malloc_array<ubyte>(count);
+		pm->vert_source.Vertex_list_size = static_cast<uint>(count);
+		pm->vert_source.Index_list       = reader.get_malloc_array<ubyte>(count);
+		pm->vert_source.Index_list_size  = static_cast<uint>(count);
+	}
+
+	if (!reader.valid()) {
+		// The header was valid so the file is truncated or corrupt. Undo everything so the model can be processed
+		// normally.
+		discard_cached_data(pm);
+		return false;
+	}
+
+	return true;
+}
+
+bool model_cache_load(polymodel* pm, const model_cache_key& key, size_t& vertex_stride)
+{
+	TRACE_SCOPE(tracing::ModelCacheLoad);
+
+	auto cache_name = model_cache_name(pm, key);
+	auto cfp = cfopen(cache_name.c_str(), "rb", CFILE_NORMAL, CF_TYPE_CACHE, false,
+	                  CF_LOCATION_ROOT_USER | CF_LOCATION_ROOT_GAME | CF_LOCATION_TYPE_ROOT);
+	if (cfp == nullptr) {
+		return false;
+	}
+
+	auto start = timer_get_microseconds();
+
+	SCP_vector<ubyte> data(static_cast<size_t>(cfilelength(cfp)));
+	auto read = data.empty() ? 0 : cfread(data.data(), 1, static_cast<int>(data.size()), cfp);
+	cfclose(cfp);
+
+	if (read != static_cast<int>(data.size()) || !model_cache_read(pm, key, data.data(), data.size(), vertex_stride)) {
+		nprintf(("Model", "Ignoring stale or invalid model cache file '%s'\n", cache_name.c_str()));
+		return false;
+	}
+
+	nprintf(("Model", "Loaded precooked data of '%s' in " SIZE_T_ARG " us\n", pm->filename,
+		static_cast<size_t>(timer_get_microseconds() - start)));
+
+	return true;
+}
+
+void model_cache_store(const polymodel* pm, const model_cache_key& key, size_t vertex_stride)
+{
+	TRACE_SCOPE(tracing::ModelCacheStore);
+
+	SCP_vector<ubyte> data;
+	model_cache_write(pm, key, vertex_stride, data);
+
+	auto cache_name = model_cache_name(pm, key);
+	auto cfp = cfopen(cache_name.c_str(), "wb", CFILE_NORMAL, CF_TYPE_CACHE, false,
+	                  CF_LOCATION_ROOT_USER | CF_LOCATION_ROOT_GAME | CF_LOCATION_TYPE_ROOT);
+	if (cfp == nullptr) {
+		mprintf(("Could not open model cache file '%s'!\n", cache_name.c_str()));
+		return;
+	}
+
+	cfwrite(data.data(), 1, static_cast<int>(data.size()), cfp);
+	cfclose(cfp);
+}
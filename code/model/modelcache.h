@@ -0,0 +1,60 @@
+#pragma once
+
+#include "globalincs/pstypes.h"
+
+class polymodel;
+
+/**
+ * @brief Identifies the inputs the precooked data of a model was generated from
+ *
+ * Besides the POF file itself, the transparency index buffers depend on the alpha channels of the textures and the
+ * vertex format depends on whether tangents are generated so those have to be part of the key.
+ */
+struct model_cache_key {
+	uint pof_checksum      = 0;
+	int pof_size           = 0;
+	uint texture_signature = 0;
+	bool tangents          = false;
+	bool vertex_buffers    = false;
+};
+
+/**
+ * @brief Builds the cache key for a model whose POF file has been read and whose textures have been loaded
+ *
+ * @param pm The model
+ * @param filename The POF file the model was read from
+ * @param[out] key The key
+ * @return @c true if the key could be built, @c false if the POF file could not be opened
+ */
+bool model_cache_make_key(polymodel* pm, const char* filename, model_cache_key& key);
+
+/**
+ * @brief Serializes the collision trees and vertex buffers of a model
+ *
+ * This must be called after the vertex buffers have been created but before they are submitted to the GPU since that
+ * frees the CPU side copies of the vertex and index data.
+ */
+void model_cache_write(const polymodel* pm, const model_cache_key& key, size_t vertex_stride, SCP_vector<ubyte>& out);
+
+/**
+ * @brief Restores the collision trees and vertex buffers of a model from serialized data
+ *
+ * @param pm The model. The POF data must already be read.
+ * @param key The key of the current model. If it does not match the key of the data, nothing is restored.
+ * @param data The serialized data
+ * @param size The size of the serialized data
+ * @param[out] vertex_stride The stride of the vertex data
+ * @return @c true if the data was restored, @c false if the data is stale or invalid
+ */
+bool model_cache_read(polymodel* pm, const model_cache_key& key, const ubyte* data, size_t size, size_t& vertex_stride);
+
+/**
+ * @brief Loads the precooked data of a model from the cache directory
+ * @return @c true if the precooked data was used, @c false if the model needs to be processed normally
+ */
+bool model_cache_load(polymodel* pm, const model_cache_key& key, size_t& vertex_stride);
+
+/**
+ * @brief Stores the precooked data of a model in the cache directory
+ */
+void model_cache_store(const polymodel* pm, const model_cache_key& key, size_t vertex_stride);
@@ -46,35 +46,9 @@ static vec3d		Mc_p1;			// The ray end rotated into the current submodel's frame
 static float		Mc_mag;			// The length of the ray
 static vec3d		Mc_direction;	// A vector from the ray's origin to its end, in the current submodel's frame of reference
 
-static vec3d 		**Mc_point_list = NULL;		// A pointer to the current submodel's vertex list
-
 static float		Mc_edge_time;
 
 
-void model_collide_free_point_list()
-{
-	if (Mc_point_list != NULL) {
-		vm_free(Mc_point_list);
-		Mc_point_list = NULL;
-	}
-}
-
-// allocate the point list
-// NOTE: SHOULD ONLY EVER BE CALLED FROM model_allocate_interp_data()!!!
-void model_collide_allocate_point_list(int n_points)
-{
-	Assert( n_points > 0 );
-
-	if (Mc_point_list != NULL) {
-		vm_free(Mc_point_list);
-		Mc_point_list = NULL;
-	}
-
-	Mc_point_list = (vec3d**) vm_malloc( sizeof(vec3d *) * n_points );
-
-	Verify( Mc_point_list != NULL );
-}
-
 // Returns non-zero if vector from p0 to pdir 
 // intersects the bounding box.
 // hitpos could be NULL, so don't fill it if it is.
@@ -359,7 +333,7 @@ static void mc_check_sphereline_face( int nv, vec3d ** verts, vec3d * plane_pnt,
 	}
 }
 
-int model_collide_parse_bsp_defpoints(ubyte * p)
+int model_collide_parse_bsp_defpoints(ubyte * p, SCP_vector<vec3d*>& point_list)
 {
 	uint n;
 	uint nverts = uw(p+8);	
@@ -368,12 +342,10 @@ int model_collide_parse_bsp_defpoints(ubyte * p)
 	ubyte * normcount = p+20;
 	vec3d *src = vp(p+offset);
 
-	model_collide_allocate_point_list(nverts);
-
-	Assert( Mc_point_list != NULL );
+	point_list.resize(nverts);
 
 	for (n=0; n<nverts; n++ ) {
-		Mc_point_list[n] = src;
+		point_list[n] = src;
 
 		src += normcount[n]+1;
 	} 
@@ -589,7 +561,9 @@ void model_collide_parse_bsp(bsp_collision_tree *tree, void *model_ptr, int vers
 
 	Assert(chunk_type == OP_DEFPOINTS);
 
-	int n_verts = model_collide_parse_bsp_defpoints(p);
+	// Only uses local state so that trees can be built on worker threads
+	SCP_vector<vec3d*> point_list;
+	int n_verts = model_collide_parse_bsp_defpoints(p, point_list);
 
 	if ( n_verts <= 0) {
 		tree->point_list = NULL;
@@ -746,7 +720,7 @@ void model_collide_parse_bsp(bsp_collision_tree *tree, void *model_ptr, int vers
 					// add another polygon center
 					vec3d center = vmd_zero_vector;
 					for (int j = 0; j < new_leaf.num_verts; j++) {
-						center += *Mc_point_list[vert_buffer[new_leaf.vert_start + j].vertnum];
+						center += *point_list[vert_buffer[new_leaf.vert_start + j].vertnum];
 					}
 					tree->poly_centers.push_back(center / (float)new_leaf.num_verts);
 
@@ -782,7 +756,7 @@ void model_collide_parse_bsp(bsp_collision_tree *tree, void *model_ptr, int vers
 			// add another polygon center
 			vec3d center = vmd_zero_vector;
 			for (int j = 0; j < new_leaf.num_verts; j++) {
-				center += *Mc_point_list[vert_buffer[new_leaf.vert_start + j].vertnum];				
+				center += *point_list[vert_buffer[new_leaf.vert_start + j].vertnum];				
 			}
 			tree->poly_centers.push_back(center / (float)new_leaf.num_verts);
 
@@ -801,7 +775,7 @@ void model_collide_parse_bsp(bsp_collision_tree *tree, void *model_ptr, int vers
 	tree->point_list = (vec3d*)vm_malloc(sizeof(vec3d) * n_verts);
 
 	for ( i = 0; i < (size_t)n_verts; ++i ) {
-		tree->point_list[i] = *Mc_point_list[i];
+		tree->point_list[i] = *point_list[i];
 	}
 
 	tree->n_verts = n_verts;
@@ -1113,6 +1087,8 @@ MONITOR(NumFVI)
 // this uses while reading the help.   
 int model_collide(mc_info *mc_info_obj)
 {
+	model_finish_pending_loads();
+
 	Mc = mc_info_obj;
 
 	MONITOR_INC(NumFVI,1);
@@ -1234,11 +1210,10 @@ int model_collide(mc_info *mc_info_obj)
 		
 		// do the same for the list of hitpoints, if necessary
 		if (Mc->flags & MC_COLLIDE_ALL) {
-			for (size_t i = 0; i < Mc->hit_points_all.size(); i++) {
-				if (Mc->flags & MC_SUBMODEL) {
-					vm_vec_unrotate(&Mc->hit_points_all[i], &Mc->hit_points_all[i], Mc->orient);
-					vm_vec_add2(&Mc->hit_points_all[i], Mc->pos);
-				} else {
+			if (Mc->flags & MC_SUBMODEL) {
+				vm_vec_unrotate_batch(Mc->hit_points_all.data(), Mc->hit_points_all.data(), Mc->hit_points_all.size(), Mc->orient, Mc->pos);
+			} else {
+				for (size_t i = 0; i < Mc->hit_points_all.size(); i++) {
 					if (Mc_pmi) {
 						model_instance_local_to_global_point(&Mc->hit_points_all[i], &Mc->hit_points_all[i], Mc_pm, Mc_pmi, Mc->hit_submodels_all[i], Mc->orient, Mc->pos);
 					}
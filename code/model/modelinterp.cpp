@@ -247,16 +247,12 @@ void model_deallocate_interp_data()
 	Num_interp_norms_allocated = 0;
 }
 
-extern void model_collide_allocate_point_list(int n_points);
-extern void model_collide_free_point_list();
-
 void model_allocate_interp_data(uint n_verts, uint n_norms)
 {
 	static ubyte dealloc = 0;
 
 	if (!dealloc) {
 		atexit(model_deallocate_interp_data);
-		atexit(model_collide_free_point_list);
 		dealloc = 1;
 	}
 
@@ -275,9 +271,6 @@ void model_allocate_interp_data(uint n_verts, uint n_norms)
 		Interp_splode_verts = (vec3d*) vm_realloc( Interp_splode_verts, n_verts * sizeof(vec3d) );
 
 		Num_interp_verts_allocated = n_verts;
-
-		// model collide needs a similar size to resize it based on this new value
-		model_collide_allocate_point_list( n_verts );
 	}
 
 	if (n_norms > Num_interp_norms_allocated) {
@@ -1157,6 +1150,8 @@ void moldel_calc_facing_pts( vec3d *top, vec3d *bot, vec3d *fvec, vec3d *pos, fl
 
 vec3d submodel_get_random_point(int model_num, int submodel_num, int seed)
 {
+	model_finish_pending_loads();
+
 	polymodel *pm = model_get(model_num);
 
 	if (pm != NULL) {
@@ -1188,6 +1183,8 @@ vec3d submodel_get_random_point(int model_num, int submodel_num, int seed)
 
 void submodel_get_cross_sectional_avg_pos(int model_num, int submodel_num, float z_slice_pos, vec3d* pos)
 {
+	model_finish_pending_loads();
+
 	polymodel* pm = model_get(model_num);
 
 	if (pm != nullptr) {
@@ -1225,6 +1222,8 @@ void submodel_get_cross_sectional_avg_pos(int model_num, int submodel_num, float
 
 void submodel_get_cross_sectional_random_pos(int model_num, int submodel_num, float z_slice_pos, vec3d* pos)
 {
+	model_finish_pending_loads();
+
 	polymodel* pm = model_get(model_num);
 
 	if (pm != nullptr) {
@@ -2163,25 +2162,21 @@ bool model_interp_config_buffer(indexed_vertex_source *vert_src, vertex_buffer *
 	return true;
 }
 
-void interp_configure_vertex_buffers(polymodel *pm, int mn, const model_read_deferred_tasks& deferredTasks)
+// Generates the vertex data and the per texture index buffers of a submodel. This only touches the submodel itself so it
+// may be called on worker threads for different submodels at the same time.
+void interp_generate_vertex_buffers(polymodel *pm, int mn, const model_read_deferred_tasks& deferredTasks)
 {
-	TRACE_SCOPE(tracing::ModelConfigureVertexBuffers);
+	TRACE_SCOPE(tracing::ModelGenerateVertexBuffers);
 
 	int i, j, first_index;
 	uint total_verts = 0;
 	SCP_vector<int> vertex_list;
+	poly_list polygon_list[MAX_MODEL_TEXTURES];
 
 	Assert( (mn >= 0) && (mn < pm->n_models) );
 
 	bsp_info *model = &pm->submodel[mn];
 
-	for (i = 0; i < MAX_MODEL_TEXTURES; i++) {
-		polygon_list[i].n_verts = 0;
-		tri_count[i] = 0;
-	}
-
-	int milliseconds = timer_get_milliseconds();
-
 	bsp_polygon_data *bsp_polies = new bsp_polygon_data(model->bsp_data);
 
 	auto textureReplace = deferredTasks.texture_replacements.find(mn);
@@ -2190,7 +2185,6 @@ void interp_configure_vertex_buffers(polymodel *pm, int mn, const model_read_def
 
 	for (i = 0; i < MAX_MODEL_TEXTURES; i++) {
 		int vert_count = bsp_polies->get_num_triangles(i) * 3;
-		tri_count[i] = vert_count / 3;
 		total_verts += vert_count;
 
 		polygon_list[i].allocate(vert_count);
@@ -2222,10 +2216,6 @@ void interp_configure_vertex_buffers(polymodel *pm, int mn, const model_read_def
 	// done with the bsp now that we have the vertex data
 	delete bsp_polies;
 
-	int time_elapsed = timer_get_milliseconds() - milliseconds;
-
-	nprintf(("Model", "BSP Parse took %d milliseconds.\n", time_elapsed));
-
 	if (total_verts < 1) {
 		return;
 	}
@@ -2305,6 +2295,20 @@ void interp_configure_vertex_buffers(polymodel *pm, int mn, const model_read_def
 
 		model->buffer.tex_buf.push_back( new_buffer );
 	}
+}
+
+// Assigns the location of the buffers of a submodel in the vertex and index data of the model. This needs to be called
+// for the submodels in order after interp_generate_vertex_buffers.
+void interp_configure_vertex_buffers(polymodel *pm, int mn)
+{
+	TRACE_SCOPE(tracing::ModelConfigureVertexBuffers);
+
+	bsp_info *model = &pm->submodel[mn];
+
+	if ( model->buffer.model_list == nullptr ) {
+		// this submodel has no geometry
+		return;
+	}
 
 	bool rval = model_interp_config_buffer(&pm->vert_source, &model->buffer, false);
 
@@ -23,6 +23,7 @@
 #include "bmpman/bmpman.h"
 #include "cfile/cfile.h"
 #include "cmdline/cmdline.h"
+#include "executor/WorkerPool.h"
 #include "freespace.h"		// For flFrameTime
 #include "gamesnd/gamesnd.h"
 #include "globalincs/linklist.h"
@@ -31,6 +32,7 @@
 #include "math/fvi.h"
 #include "math/vecmat.h"
 #include "model/model.h"
+#include "model/modelcache.h"
 #include "model/modelreplace.h"
 #include "model/modelsinc.h"
 #include "parse/parselo.h"
@@ -107,7 +109,22 @@ static bool ss_warning_shown_mismatch = false;	// ditto but for a different warn
 
 static int Model_signature = 0;
 
-void interp_configure_vertex_buffers(polymodel*, int, const model_read_deferred_tasks& deferredTasks);
+namespace {
+struct pending_model_geometry {
+	polymodel* pm = nullptr;
+	SCP_string filename;
+	modelread_status status = modelread_status::FAIL;
+	model_read_deferred_tasks deferredTasks;
+};
+
+// Models whose collision trees and vertex buffers have not been generated yet. During level load, the geometry of all
+// models is generated at once so that the work can be spread over all cores.
+SCP_vector<std::unique_ptr<pending_model_geometry>> Model_pending_geometry;
+bool Model_defer_geometry = false;
+} // namespace
+
+void interp_generate_vertex_buffers(polymodel*, int, const model_read_deferred_tasks& deferredTasks);
+void interp_configure_vertex_buffers(polymodel* pm, int mn);
 void interp_pack_vertex_buffers(polymodel* pm, int mn);
 void interp_create_detail_index_buffer(polymodel *pm, int detail);
 void interp_create_transparency_index_buffer(polymodel *pm, int detail_num);
@@ -182,6 +199,12 @@ SCP_unordered_map<int, intrinsic_motion> Intrinsic_motions;
 void model_free(polymodel* pm)
 {
 	int i, j;
+
+	// The model may be freed before its geometry was generated
+	Model_pending_geometry.erase(std::remove_if(Model_pending_geometry.begin(), Model_pending_geometry.end(),
+		[pm](const std::unique_ptr<pending_model_geometry>& pending) { return pending->pm == pm; }),
+		Model_pending_geometry.end());
+
 	safe_kill(pm->ship_bay);
 
 	if (pm->paths) {
@@ -449,6 +472,9 @@ void model_page_in_stop()
 
 	mprintf(( "Stopping model page in...\n" ));
 
+	// Generate the geometry of all models which were loaded for the mission at once, see model_geometry_deferral
+	model_finish_pending_loads();
+
 	for (i=0; i<MAX_POLYGON_MODELS; i++) {
 		if (Polygon_models[i] == NULL)
 			continue;
@@ -1167,10 +1193,12 @@ void create_family_tree(polymodel *obj)
 	}
 }
 
-void create_vertex_buffer(polymodel *pm, const model_read_deferred_tasks& deferredTasks)
+// Assembles the buffers of the model from the generated submodel buffers. Returns the vertex stride of the model. The
+// buffers still need to be submitted with model_interp_submit_buffers.
+size_t create_vertex_buffer(polymodel *pm)
 {
 	if (Is_standalone) {
-		return;
+		return 0;
 	}
 
 	TRACE_SCOPE(tracing::ModelCreateVertexBuffers);
@@ -1179,9 +1207,8 @@ void create_vertex_buffer(polymodel *pm, const model_read_deferred_tasks& deferr
 
 	// determine the size and configuration of each buffer segment
 	for (i = 0; i < pm->n_models; i++) {
-		interp_configure_vertex_buffers(pm, i, deferredTasks);
+		interp_configure_vertex_buffers(pm, i);
 	}
-
 	// figure out which vertices are transparent
 	for ( i = 0; i < pm->n_models; i++ ) {
 		if ( !pm->submodel[i].flags[Model::Submodel_flags::Is_thruster] ) {
@@ -1230,12 +1257,167 @@ void create_vertex_buffer(polymodel *pm, const model_read_deferred_tasks& deferr
 
 	pm->flags |= PM_FLAG_BATCHED;
 
+	return stride;
+}
+
+namespace {
+
+// Only touches the submodel itself and its collision tree so this can run on a worker thread
+void generate_submodel_geometry(polymodel* pm, int mn, const model_read_deferred_tasks& deferredTasks)
+{
+	auto sm = &pm->submodel[mn];
+
+	if (!Is_standalone) {
+		interp_generate_vertex_buffers(pm, mn, deferredTasks);
+	}
+
+	model_collide_parse_bsp(model_get_bsp_collision_tree(sm->collision_tree_index), sm->bsp_data, pm->version);
+}
+
+void submit_model_geometry(polymodel* pm, size_t stride)
+{
+	if (Is_standalone) {
+		return;
+	}
+
 	// ... and then finalize buffer
 	model_interp_submit_buffers(&pm->vert_source, stride);
 
 	model_interp_process_shield_mesh(pm);
 }
 
+// Generates the collision trees and vertex buffers of the specified models or reads them from the model cache
+void generate_model_geometry(const SCP_vector<pending_model_geometry*>& models)
+{
+	struct submodel_work {
+		pending_model_geometry* model;
+		int submodel;
+	};
+
+	struct generated_model {
+		pending_model_geometry* model;
+		bool use_cache;
+		model_cache_key cache_key;
+	};
+
+	SCP_vector<generated_model> generated;
+	SCP_vector<submodel_work> work;
+
+	for (auto model : models) {
+		auto pm = model->pm;
+
+		// Virtual models are assembled from other files so the key of the POF file does not describe them
+		model_cache_key key;
+		bool use_cache = Cmdline_model_cache && model->status == modelread_status::SUCCESS_REAL &&
+		                 model_cache_make_key(pm, model->filename.c_str(), key);
+
+		size_t stride = 0;
+		if (use_cache && model_cache_load(pm, key, stride)) {
+			submit_model_geometry(pm, stride);
+			continue;
+		}
+
+		generated.push_back({model, use_cache, key});
+
+		// The tree list is shared by all models so the slots have to be assigned here
+		for (int i = 0; i < pm->n_models; ++i) {
+			pm->submodel[i].collision_tree_index = model_create_bsp_collision_tree();
+			work.push_back({model, i});
+		}
+	}
+
+	if (work.empty()) {
+		return;
+	}
+
+	// Start with the biggest submodels so that the workers finish at roughly the same time
+	std::stable_sort(work.begin(), work.end(), [](const submodel_work& lhs, const submodel_work& rhs) {
+		return lhs.model->pm->submodel[lhs.submodel].bsp_data_size >
+		       rhs.model->pm->submodel[rhs.submodel].bsp_data_size;
+	});
+
+	auto start = timer_get_microseconds();
+
+	{
+		TRACE_SCOPE(tracing::ModelParseAllBSPTrees);
+
+		executor::workerPool().parallel_for(work.size(), [&work](size_t i) {
+			generate_submodel_geometry(work[i].model->pm, work[i].submodel, work[i].model->deferredTasks);
+		});
+	}
+
+	nprintf(("Model", "Generating the geometry of " SIZE_T_ARG " models (" SIZE_T_ARG " submodels) took " SIZE_T_ARG
+	                  " us using " SIZE_T_ARG " worker threads\n",
+		generated.size(), work.size(), static_cast<size_t>(timer_get_microseconds() - start),
+		executor::workerPool().numThreads()));
+
+	// Everything else modifies shared state so it happens in load order to keep the result deterministic
+	for (const auto& model : generated) {
+		auto pm = model.model->pm;
+
+		auto stride = create_vertex_buffer(pm);
+
+		if (model.use_cache) {
+			model_cache_store(pm, model.cache_key, stride);
+		}
+
+		submit_model_geometry(pm, stride);
+	}
+}
+
+void process_model_geometry(polymodel* pm, const char* filename, modelread_status status,
+	model_read_deferred_tasks&& deferredTasks)
+{
+	std::unique_ptr<pending_model_geometry> model(new pending_model_geometry());
+	model->pm            = pm;
+	model->filename      = filename;
+	model->status        = status;
+	model->deferredTasks = std::move(deferredTasks);
+
+	if (Model_defer_geometry) {
+		Model_pending_geometry.push_back(std::move(model));
+		return;
+	}
+
+	generate_model_geometry({model.get()});
+}
+
+} // namespace
+
+model_geometry_deferral::model_geometry_deferral() : _previous(Model_defer_geometry)
+{
+	Model_defer_geometry = true;
+}
+
+model_geometry_deferral::~model_geometry_deferral()
+{
+	Model_defer_geometry = _previous;
+
+	if (!Model_defer_geometry) {
+		model_finish_pending_loads();
+	}
+}
+
+void model_finish_pending_loads()
+{
+	if (Model_pending_geometry.empty()) {
+		return;
+	}
+
+	TRACE_SCOPE(tracing::ModelFinishPendingLoads);
+
+	// Take ownership first so that the list is consistent if a model is freed while its geometry is generated
+	auto pending = std::move(Model_pending_geometry);
+	Model_pending_geometry.clear();
+
+	SCP_vector<pending_model_geometry*> models;
+	for (const auto& model : pending) {
+		models.push_back(model.get());
+	}
+
+	generate_model_geometry(models);
+}
+
 // Goober5000
 bool maybe_swap_mins_maxs(vec3d *mins, vec3d *maxs)
 {
@@ -1883,6 +2065,12 @@ modelread_status read_model_file_no_subsys(polymodel * pm, const char* filename,
 				}
 				model_calc_bound_box(sm->bounding_box, &sm->min, &sm->max);
 
+				// the submodel only rotates around its pivot point so this contains its geometry in every orientation
+				sm->cull_radius = 0.0f;
+				for (auto& corner : sm->bounding_box) {
+					sm->cull_radius = MAX(sm->cull_radius, vm_vec_mag(&corner));
+				}
+
 				// ---------- submodel movement ----------
 
 				sm->rotation_type = cfread_int(fp);
@@ -3314,7 +3502,8 @@ int model_load(const  char* filename, int n_subsystems, model_subsystem* subsyst
 
 	model_read_deferred_tasks deferredTasks;
 
-	if (read_and_process_model_file(pm, filename, n_subsystems, subsystems, ferror, deferredTasks) == modelread_status::FAIL)	{
+	auto status = read_and_process_model_file(pm, filename, n_subsystems, subsystems, ferror, deferredTasks);
+	if (status == modelread_status::FAIL)	{
 		if (pm != NULL) {
 			delete pm;
 		}
@@ -3382,7 +3571,7 @@ int model_load(const  char* filename, int n_subsystems, model_subsystem* subsyst
 	}
 
 	// maybe generate vertex buffers
-	create_vertex_buffer(pm, deferredTasks);
+	process_model_geometry(pm, filename, status, std::move(deferredTasks));
 
 	//==============================
 	// Find all the lower detail versions of the hires model
@@ -3475,14 +3664,6 @@ int model_load(const  char* filename, int n_subsystems, model_subsystem* subsyst
 
 	}
 
-	TRACE_SCOPE(tracing::ModelParseAllBSPTrees);
-
-	for (i = 0; i < pm->n_models; ++i) {
-		pm->submodel[i].collision_tree_index = model_create_bsp_collision_tree();
-		bsp_collision_tree* tree             = model_get_bsp_collision_tree(pm->submodel[i].collision_tree_index);
-		model_collide_parse_bsp(tree, pm->submodel[i].bsp_data, pm->version);
-	}
-
 	// Find the core_radius... the minimum of 
 	float rx, ry, rz;
 	rx = fl_abs( pm->submodel[pm->detail[0]].max.xyz.x - pm->submodel[pm->detail[0]].min.xyz.x );
@@ -30,7 +30,9 @@
 #include "ship/ship.h"
 #include "ship/shipfx.h"
 #include "starfield/starfield.h"
+#include "tracing/Monitor.h"
 #include "tracing/tracing.h"
+#include "utils/radix_sort.h"
 #include "weapon/weapon.h"
 
 #include <algorithm>
@@ -417,6 +419,9 @@ void model_draw_list::reset()
 {
 	Render_elements.clear();
 	Render_keys.clear();
+	Render_materials.clear();
+	Shader_ids.clear();
+	Texture_ids.clear();
 
 	Transformations.clear();
 
@@ -429,8 +434,32 @@ void model_draw_list::reset()
 
 void model_draw_list::sort_draws()
 {
-	std::sort(Render_keys.begin(), Render_keys.end(),
-			  [this](const int a, const int b) { return model_draw_list::sort_draw_pair(this, a, b); });
+	util::radix_sort(Render_keys, Render_keys_scratch, [](const queued_draw_key& key) { return key.key; });
+}
+
+uint model_draw_list::get_shader_id(uint sdr_flags)
+{
+	// there are only a handful of different shaders per frame
+	for (size_t i = 0; i < Shader_ids.size(); ++i) {
+		if (Shader_ids[i] == sdr_flags) {
+			return static_cast<uint>(i);
+		}
+	}
+
+	Shader_ids.push_back(sdr_flags);
+	return static_cast<uint>(Shader_ids.size() - 1);
+}
+
+uint model_draw_list::get_texture_id(int texture)
+{
+	auto iter = Texture_ids.find(texture);
+	if (iter != Texture_ids.end()) {
+		return iter->second;
+	}
+
+	auto id = static_cast<uint>(Texture_ids.size());
+	Texture_ids.emplace(texture, id);
+	return id;
 }
 
 void model_draw_list::start_model_batch(int n_models)
@@ -479,25 +508,25 @@ void model_draw_list::set_light_filter(vec3d *pos, float rad)
 void model_draw_list::add_buffer_draw(model_material *render_material, indexed_vertex_source *vert_src, vertex_buffer *buffer, size_t texi, uint tmap_flags)
 {
 	queued_buffer_draw draw_data;
-	draw_data.render_material = *render_material;
+	model_material draw_material = *render_material;
 
 	if (Rendering_to_shadow_map) {
-		draw_data.render_material.set_shadow_casting(true);
+		draw_material.set_shadow_casting(true);
 	} else {
 		// If the zbuffer type is FULL then this buffer may be drawn in the deferred lighting part otherwise we need to
 		// make sure that the deferred flag is disabled or else some parts of the rendered colors go missing
 		// TODO: This should really be handled somewhere else. This feels like a crude hack...
-		auto possibly_deferred = draw_data.render_material.get_depth_mode() == ZBUFFER_TYPE_FULL
+		auto possibly_deferred = draw_material.get_depth_mode() == ZBUFFER_TYPE_FULL
 			&& gr_is_capable(CAPABILITY_DEFERRED_LIGHTING) && !Cmdline_no_deferred_lighting;
 
 		if (possibly_deferred) {
 			// Fog is handled differently in deferred shader situations
-			draw_data.render_material.set_fog();
+			draw_material.set_fog();
 		}
 
-		draw_data.render_material.set_deferred_lighting(possibly_deferred ? Deferred_lighting : false);
-		draw_data.render_material.set_high_dynamic_range(High_dynamic_range);
-		draw_data.render_material.set_shadow_receiving(Shadow_quality != ShadowQuality::Disabled);
+		draw_material.set_deferred_lighting(possibly_deferred ? Deferred_lighting : false);
+		draw_material.set_high_dynamic_range(High_dynamic_range);
+		draw_material.set_shadow_receiving(Shadow_quality != ShadowQuality::Disabled);
 	}
 
 	if (tmap_flags & TMAP_FLAG_BATCH_TRANSFORMS && buffer->flags & VB_FLAG_MODEL_ID) {
@@ -509,15 +538,15 @@ void model_draw_list::add_buffer_draw(model_material *render_material, indexed_v
 
 		draw_data.transform_buffer_offset = TransformBufferHandler.get_buffer_offset();
 
-		draw_data.render_material.set_batching(true);
+		draw_material.set_batching(true);
 	} else {
 		draw_data.transform = Transformations.get_transform();
 		draw_data.scale = Current_scale;
 		draw_data.transform_buffer_offset = INVALID_SIZE;
-		draw_data.render_material.set_batching(false);
+		draw_material.set_batching(false);
 	}
 
-	draw_data.sdr_flags = draw_data.render_material.get_shader_flags();
+	draw_data.material_index = Render_materials.add(draw_material);
 
 	draw_data.vert_src = vert_src;
 	draw_data.buffer = buffer;
@@ -526,7 +555,14 @@ void model_draw_list::add_buffer_draw(model_material *render_material, indexed_v
 	draw_data.lights = Current_lights_set;
 
 	Render_elements.push_back(draw_data);
-	Render_keys.push_back((int) (Render_elements.size() - 1));
+
+	// encode the sort order now so that sorting does not need to look at the draws again
+	queued_draw_key key;
+	key.key = model_draw_sort_key(draw_material.get_depth_mode(), get_shader_id(draw_material.get_shader_flags()),
+		vert_src->Vbuffer_handle.value(), get_texture_id(draw_material.get_texture_map(TM_BASE_TYPE)),
+		static_cast<uint>(draw_data.material_index));
+	key.index = static_cast<int>(Render_elements.size() - 1);
+	Render_keys.push_back(key);
 }
 
 void model_draw_list::render_buffer(queued_buffer_draw &render_elements)
@@ -537,7 +573,7 @@ void model_draw_list::render_buffer(queued_buffer_draw &render_elements)
 	gr_bind_uniform_buffer(uniform_block_type::ModelData, render_elements.uniform_buffer_offset,
 	                       sizeof(graphics::model_uniform_data), _dataBuffer.bufferHandle());
 
-	gr_render_model(&render_elements.render_material, render_elements.vert_src, render_elements.buffer, render_elements.texi);
+	gr_render_model(&Render_materials.get(render_elements.material_index), render_elements.vert_src, render_elements.buffer, render_elements.texi);
 }
 
 vec3d model_draw_list::get_view_position()
@@ -562,6 +598,22 @@ vec3d model_draw_list::get_view_position()
 	return return_val;
 }
 
+// Checks if a sphere around the origin of the current local space may be visible
+bool model_draw_list::is_sphere_in_view(float radius)
+{
+	// the transforms are only relative to the world outside of 3d instances and shadow maps use a different view
+	if ( Rendering_to_shadow_map || G3_count != 1 || instance_depth > 0 ) {
+		return true;
+	}
+
+	matrix4 transform_mat = Transformations.get_transform();
+	vec3d pos;
+
+	vm_matrix4_get_offset(&pos, &transform_mat);
+
+	return obj_sphere_in_view_cone(&pos, radius) != 0;
+}
+
 void model_draw_list::push_transform(vec3d *pos, matrix *orient)
 {
 	Transformations.push(pos, orient);
@@ -620,10 +672,10 @@ void model_draw_list::render_all(gr_zbuffer_type depth_mode)
 	Scene_light_handler.resetLightState();
 
 	for ( size_t i = 0; i < Render_keys.size(); ++i ) {
-		int render_index = Render_keys[i];
+		auto& draw = Render_elements[Render_keys[i].index];
 
-		if ( depth_mode == ZBUFFER_TYPE_DEFAULT || Render_elements[render_index].render_material.get_depth_mode() == depth_mode ) {
-			render_buffer(Render_elements[render_index]);
+		if ( depth_mode == ZBUFFER_TYPE_DEFAULT || Render_materials.get(draw.material_index).get_depth_mode() == depth_mode ) {
+			render_buffer(draw);
 		}
 	}
 
@@ -731,57 +783,60 @@ void model_draw_list::render_outline(outline_draw &outline_info)
 	g3_done_instance(true);
 }
 
-bool model_draw_list::sort_draw_pair(model_draw_list* target, const int a, const int b)
+int model_material_table::add(const model_material& mat)
 {
-	queued_buffer_draw *draw_call_a = &target->Render_elements[a];
-	queued_buffer_draw *draw_call_b = &target->Render_elements[b];
-
-	if ( draw_call_a->sdr_flags != draw_call_b->sdr_flags ) {
-		return draw_call_a->sdr_flags < draw_call_b->sdr_flags;
-	}
-
-	if ( draw_call_a->vert_src->Vbuffer_handle != draw_call_b->vert_src->Vbuffer_handle ) {
-		return draw_call_a->vert_src->Vbuffer_handle.value() < draw_call_b->vert_src->Vbuffer_handle.value();
-	}
+	// cheap to compute and already different for most materials
+	auto signature = (static_cast<std::uint64_t>(static_cast<uint>(mat.get_texture_map(TM_BASE_TYPE))) << 32)
+		| (static_cast<std::uint64_t>(static_cast<uint>(mat.get_texture_map(TM_GLOW_TYPE))) << 8)
+		| static_cast<std::uint64_t>(mat.get_depth_mode());
 
-	if ( draw_call_a->vert_src->Ibuffer_handle != draw_call_b->vert_src->Ibuffer_handle ) {
-		return draw_call_a->vert_src->Ibuffer_handle.value() < draw_call_b->vert_src->Ibuffer_handle.value();
+	auto iter = First_with_signature.find(signature);
+	if (iter == First_with_signature.end()) {
+		iter = First_with_signature.emplace(signature, -1).first;
 	}
 
-	if ( draw_call_a->render_material.get_texture_map(TM_BASE_TYPE) != draw_call_b->render_material.get_texture_map(TM_BASE_TYPE) ) {
-		return draw_call_a->render_material.get_texture_map(TM_BASE_TYPE) < draw_call_b->render_material.get_texture_map(TM_BASE_TYPE);
+	int last = -1;
+	for (int index = iter->second; index >= 0; index = Next_with_signature[index]) {
+		if (Materials[index] == mat) {
+			return index;
+		}
+		last = index;
 	}
 
-	if ( draw_call_a->render_material.get_texture_map(TM_SPECULAR_TYPE) != draw_call_b->render_material.get_texture_map(TM_SPECULAR_TYPE) ) {
-		return draw_call_a->render_material.get_texture_map(TM_SPECULAR_TYPE) < draw_call_b->render_material.get_texture_map(TM_SPECULAR_TYPE);
-	}
-	
-	if ( draw_call_a->render_material.get_texture_map(TM_SPEC_GLOSS_TYPE) != draw_call_b->render_material.get_texture_map(TM_SPEC_GLOSS_TYPE) ) {
-		return draw_call_a->render_material.get_texture_map(TM_SPEC_GLOSS_TYPE) < draw_call_b->render_material.get_texture_map(TM_SPEC_GLOSS_TYPE);
-	}
+	Materials.push_back(mat);
+	Next_with_signature.push_back(-1);
 
-	if ( draw_call_a->render_material.get_texture_map(TM_GLOW_TYPE) != draw_call_b->render_material.get_texture_map(TM_GLOW_TYPE) ) {
-		return draw_call_a->render_material.get_texture_map(TM_GLOW_TYPE) < draw_call_b->render_material.get_texture_map(TM_GLOW_TYPE);
+	auto new_index = static_cast<int>(Materials.size() - 1);
+	if (last >= 0) {
+		Next_with_signature[last] = new_index;
+	} else {
+		iter->second = new_index;
 	}
 
-	if ( draw_call_a->render_material.get_texture_map(TM_NORMAL_TYPE) != draw_call_b->render_material.get_texture_map(TM_NORMAL_TYPE) ) {
-		return draw_call_a->render_material.get_texture_map(TM_NORMAL_TYPE) < draw_call_b->render_material.get_texture_map(TM_NORMAL_TYPE);
-	}
+	return new_index;
+}
 
-	if ( draw_call_a->render_material.get_texture_map(TM_HEIGHT_TYPE) != draw_call_b->render_material.get_texture_map(TM_HEIGHT_TYPE) ) {
-		return draw_call_a->render_material.get_texture_map(TM_HEIGHT_TYPE) < draw_call_b->render_material.get_texture_map(TM_HEIGHT_TYPE);
-	}
+void model_material_table::clear()
+{
+	Materials.clear();
+	Next_with_signature.clear();
+	First_with_signature.clear();
+}
 
-	if ( draw_call_a->render_material.get_texture_map(TM_AMBIENT_TYPE) != draw_call_b->render_material.get_texture_map(TM_AMBIENT_TYPE) ) {
-		return draw_call_a->render_material.get_texture_map(TM_AMBIENT_TYPE) < draw_call_b->render_material.get_texture_map(TM_AMBIENT_TYPE);
-	}
+std::uint64_t model_draw_sort_key(gr_zbuffer_type depth_mode, uint shader_id, int vertex_buffer, uint texture_id,
+	uint material_index)
+{
+	auto field = [](std::uint64_t value, int bits) { return std::min(value, (static_cast<std::uint64_t>(1) << bits) - 1); };
 
-	if ( draw_call_a->render_material.get_texture_map(TM_MISC_TYPE) != draw_call_b->render_material.get_texture_map(TM_MISC_TYPE) ) {
-		return draw_call_a->render_material.get_texture_map(TM_MISC_TYPE) < draw_call_b->render_material.get_texture_map(TM_MISC_TYPE);
-	}
+	std::uint64_t key = field(static_cast<std::uint64_t>(depth_mode), 3);
+	key = (key << 7) | field(shader_id, 7);
+	key = (key << 16) | field(static_cast<std::uint64_t>(std::max(vertex_buffer, 0)), 16);
+	key = (key << 16) | field(texture_id, 16);
+	key = (key << 22) | field(material_index, 22);
 
-	return draw_call_a->lights.index_start < draw_call_b->lights.index_start;
+	return key;
 }
+
 void model_draw_list::build_uniform_buffer() {
 	GR_DEBUG_SCOPE("Build model uniform buffer");
 
@@ -789,11 +844,12 @@ void model_draw_list::build_uniform_buffer() {
 
 	_dataBuffer = gr_get_uniform_buffer(uniform_block_type::ModelData, Render_keys.size());
 
-	for (auto render_index : Render_keys) {
-		auto& queued_draw = Render_elements[render_index];
+	for (const auto& render_key : Render_keys) {
+		auto& queued_draw = Render_elements[render_key.index];
+		auto& render_material = Render_materials.get(queued_draw.material_index);
 
 		// Set lighting here so that it can be captured by the uniform conversion below
-		if ( queued_draw.render_material.is_lit() ) {
+		if ( render_material.is_lit() ) {
 			Scene_light_handler.setLights(&queued_draw.lights);
 		} else {
 
@@ -802,7 +858,7 @@ void model_draw_list::build_uniform_buffer() {
 
 		auto element = _dataBuffer.aligner().addTypedElement<graphics::model_uniform_data>();
 		graphics::uniforms::convert_model_material(element,
-												   queued_draw.render_material,
+												   render_material,
 												   queued_draw.transform,
 												   queued_draw.scale,
 												   queued_draw.transform_buffer_offset);
@@ -1260,6 +1316,9 @@ void model_render_buffers(model_draw_list* scene, model_material *rendering_mate
 	}
 }
 
+MONITOR( NumSubmodelsRend )
+MONITOR( NumSubmodelsCulled )
+
 void model_render_children_buffers(model_draw_list* scene, model_material *rendering_material, model_render_params* interp, polymodel* pm, polymodel_instance *pmi, int mn, int detail_level, uint tmap_flags, bool trans_buffer)
 {
 	int i;
@@ -1306,17 +1365,33 @@ void model_render_children_buffers(model_draw_list* scene, model_material *rende
 	}
 
 	scene->push_transform(&submodel_offset, &submodel_orient);
-	
-	if ( (model_flags & MR_SHOW_OUTLINE || model_flags & MR_SHOW_OUTLINE_HTL || model_flags & MR_SHOW_OUTLINE_PRESET) && 
-		sm->outline_buffer != nullptr ) {
-		color outline_color = interp->get_color();
-		scene->add_outline(sm->outline_buffer, sm->n_verts_outline, &outline_color);
+
+	// Batched submodels are part of the draw of the whole model and thrusters are stretched by the shader so only
+	// individually drawn submodels can be culled. Their children are still checked since they may move elsewhere.
+	bool culled = false;
+	if ( !(tmap_flags & TMAP_FLAG_BATCH_TRANSFORMS) && !sm->flags[Model::Submodel_flags::Is_thruster] ) {
+		const vec3d& warp_scale = interp->get_warp_scale();
+		float scale = MAX(MAX(warp_scale.xyz.x, warp_scale.xyz.y), warp_scale.xyz.z);
+
+		culled = !scene->is_sphere_in_view(sm->cull_radius * scale);
+	}
+
+	if ( culled ) {
+		MONITOR_INC( NumSubmodelsCulled, 1 );
 	} else {
-		if ( trans_buffer && sm->trans_buffer.flags & VB_FLAG_TRANS ) {
-			model_render_buffers(scene, rendering_material, interp, &sm->trans_buffer, pm, mn, detail_level, tmap_flags);
+		MONITOR_INC( NumSubmodelsRend, 1 );
+
+		if ( (model_flags & MR_SHOW_OUTLINE || model_flags & MR_SHOW_OUTLINE_HTL || model_flags & MR_SHOW_OUTLINE_PRESET) && 
+			sm->outline_buffer != nullptr ) {
+			color outline_color = interp->get_color();
+			scene->add_outline(sm->outline_buffer, sm->n_verts_outline, &outline_color);
 		} else {
-			model_render_buffers(scene, rendering_material, interp, &sm->buffer, pm, mn, detail_level, tmap_flags);
-		} 
+			if ( trans_buffer && sm->trans_buffer.flags & VB_FLAG_TRANS ) {
+				model_render_buffers(scene, rendering_material, interp, &sm->trans_buffer, pm, mn, detail_level, tmap_flags);
+			} else {
+				model_render_buffers(scene, rendering_material, interp, &sm->buffer, pm, mn, detail_level, tmap_flags);
+			} 
+		}
 	}
 
 	if ( smi != nullptr && smi->num_arcs > 0 ) {
@@ -2694,6 +2769,8 @@ void model_render_queue(model_render_params* interp, model_draw_list* scene, int
 {
 	int i;
 
+	model_finish_pending_loads();
+
 	const int objnum = interp->get_object_number();
 	const int model_flags = interp->get_model_flags();
 
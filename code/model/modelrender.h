@@ -188,7 +188,7 @@ struct queued_buffer_draw
 	size_t transform_buffer_offset = 0;
 	size_t uniform_buffer_offset = 0;
 
-	model_material render_material;
+	int material_index = -1; // index into the material table of the draw list
 
 	matrix4 transform;
 	vec3d scale;
@@ -197,7 +197,6 @@ struct queued_buffer_draw
 	vertex_buffer *buffer;
 	size_t texi;
 	int flags;
-	int sdr_flags;
 
 	light_indexing_info lights;
 
@@ -206,6 +205,57 @@ struct queued_buffer_draw
 	}
 };
 
+struct queued_draw_key
+{
+	std::uint64_t key;
+	int index; // index into the queued draws
+};
+
+/**
+ * @brief Stores the materials of the draws queued in one frame
+ *
+ * Many draws of a frame use the same material, e.g. all ships of the same class, so identical materials are only stored
+ * once.
+ */
+class model_material_table
+{
+	SCP_vector<model_material> Materials;
+
+	// Materials with the same signature are chained so that only those need to be compared with a new material
+	SCP_vector<int> Next_with_signature;
+	SCP_unordered_map<std::uint64_t, int> First_with_signature;
+
+public:
+	/**
+	 * @brief Adds a material to the table unless an identical material is already stored
+	 * @return The index of the material in the table
+	 */
+	int add(const model_material& mat);
+
+	model_material& get(int index) { return Materials[index]; }
+	const model_material& get(int index) const { return Materials[index]; }
+
+	size_t size() const { return Materials.size(); }
+
+	void clear();
+};
+
+/**
+ * @brief Packs the state which decides the draw order of a queued draw into a single key
+ *
+ * The draws are sorted by depth mode, shader, vertex buffer, base texture and material in that order so that draws
+ * which can share state end up next to each other. Values which don't fit into their bits are clamped which only makes
+ * the grouping less effective.
+ *
+ * @param depth_mode The depth mode of the material
+ * @param shader_id A small number identifying the shader flags of the material
+ * @param vertex_buffer The handle of the vertex buffer
+ * @param texture_id A small number identifying the base texture of the material
+ * @param material_index The index of the material in the material table
+ */
+std::uint64_t model_draw_sort_key(gr_zbuffer_type depth_mode, uint shader_id, int vertex_buffer, uint texture_id,
+	uint material_index);
+
 struct outline_draw
 {
 	vertex* vert_array;
@@ -252,7 +302,17 @@ class model_draw_list
 	void render_buffer(queued_buffer_draw &render_elements);
 	
 	SCP_vector<queued_buffer_draw> Render_elements;
-	SCP_vector<int> Render_keys;
+	SCP_vector<queued_draw_key> Render_keys;
+	SCP_vector<queued_draw_key> Render_keys_scratch;
+
+	model_material_table Render_materials;
+
+	// Maps the shader flags and base textures of the current frame to small numbers for the sort keys
+	SCP_vector<uint> Shader_ids;
+	SCP_unordered_map<int, uint> Texture_ids;
+
+	uint get_shader_id(uint sdr_flags);
+	uint get_texture_id(int texture);
 
 	SCP_vector<arc_effect> Arcs;
 	SCP_vector<insignia_draw_data> Insignias;
@@ -262,7 +322,6 @@ class model_draw_list
 
 	bool Render_initialized = false; //!< A flag for checking if init_render has been called before a render_all call
 	
-	static bool sort_draw_pair(model_draw_list* target, const int a, const int b);
 	void sort_draws();
 
 	void build_uniform_buffer();
@@ -281,6 +340,7 @@ public:
 	void add_buffer_draw(model_material *render_material, indexed_vertex_source *vert_src, vertex_buffer *buffer, size_t texi, uint tmap_flags);
 	
 	vec3d get_view_position();
+	bool is_sphere_in_view(float radius);
 	void push_transform(vec3d* pos, matrix* orient);
 	void pop_transform();
 	void set_scale(vec3d *scale = NULL);
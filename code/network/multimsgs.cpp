@@ -24,6 +24,7 @@
 #include "hud/hudsquadmsg.h"
 #include "freespace.h"
 #include "io/timer.h"
+#include "mission/missioncue.h"
 #include "mission/missiongoals.h"
 #include "mission/missionlog.h"
 #include "mission/missionmessage.h"
@@ -8525,6 +8526,8 @@ void process_event_update_packet(ubyte *data, header *hinfo)
 	GET_INT(Mission_events[u_event].count);
 	PACKET_SET_SIZE();
 
+	mission_cue_fact_changed(CueFact::Events);
+
 	// went from non directive special to directive special
 	if(!(store_flags & MEF_DIRECTIVE_SPECIAL) && (Mission_events[u_event].flags & MEF_DIRECTIVE_SPECIAL)){
 		mission_event_set_directive_special(u_event);
@@ -22,6 +22,7 @@
 #include "network/multi.h"
 #include "object/objcollide.h"
 #include "object/object.h"
+#include "object/objectbounds.h"
 #include "object/objectdock.h"
 #include "object/objectshield.h"
 #include "scripting/global_hooks.h"
@@ -833,6 +834,9 @@ void calculate_ship_ship_collision_physics(collision_info_struct *ship_ship_hit_
 			heavy->phys_info.mass = copy_mass;
 		}
 	}
+
+	obj_bounds_update(heavy);
+	obj_bounds_update(lighter);
 }
 
 
@@ -12,6 +12,7 @@
 #include "io/timer.h"
 #include "object/objcollide.h"
 #include "object/object.h"
+#include "object/objectbounds.h"
 #include "object/objectdock.h"
 #include "ship/ship.h"
 #include "tracing/tracing.h"
@@ -481,27 +482,25 @@ int collide_predict_large_ship(object *objp, float distance)
 
 #define CRW_MAX_TO_DELETE	4
 
-char crw_status[MAX_WEAPONS];
+SCP_vector<char> crw_status;
 
 void crw_check_weapon( int weapon_num, int collide_next_check )
 {
 	weapon *wp = &Weapons[weapon_num];
 
 	// if this weapons life left > time before next collision, then we cannot remove it
-	crw_status[WEAPON_INDEX(wp)] = CRW_IN_PAIR;
+	crw_status[weapon_num] = CRW_IN_PAIR;
 	const float next_check_time = ((float)(timestamp_until(collide_next_check)) / 1000.0f);
 	if ( wp->lifeleft < next_check_time )
-		crw_status[WEAPON_INDEX(wp)] = CRW_CAN_DELETE;
+		crw_status[weapon_num] = CRW_CAN_DELETE;
 }
 
 int collide_remove_weapons( )
 {
 	// setup remove_weapon array.  assume we can remove it.
-	for (int i = 0; i < MAX_WEAPONS; i++ ) {
-		if ( Weapons[i].objnum == -1 )
-			crw_status[i] = CRW_NO_OBJECT;
-		else
-			crw_status[i] = CRW_NO_PAIR;
+	crw_status.assign(Weapons.capacity(), CRW_NO_OBJECT);
+	for (auto i : Weapons.used()) {
+		crw_status[i] = CRW_NO_PAIR;
 	}
 
 	// first pass is to see if any of the weapons don't have collision pairs.
@@ -531,7 +530,7 @@ int collide_remove_weapons( )
 
 	// for each weapon which could be removed, delete the object
 	int num_deleted = 0;
-	for (int i = 0; i < MAX_WEAPONS; i++ ) {
+	for (int i = 0; i < Weapons.capacity(); i++ ) {
 		if ( crw_status[i] == CRW_CAN_DELETE ) {
 			Assert( Weapons[i].objnum != -1 );
 			obj_delete( Weapons[i].objnum );
@@ -631,56 +630,22 @@ void obj_collide_obj_cache_stale(object* objp)
 {
 	objp->flags.set(Object::Object_Flags::Collision_cache_stale);
 	Collision_cache_stale_objects.insert(objp);
+
+	// the object was moved outside of physics so the sorting endpoints have to be updated as well
+	obj_bounds_update(objp);
 }
 
 //local helper functions only used in objcollide.cpp
 namespace
 {
 
-float obj_get_collider_endpoint(int obj_num, int axis, bool min)
+// The endpoints are precomputed in Obj_bounds so sorting does not have to touch the objects themselves
+inline float obj_get_collider_endpoint(int obj_num, int axis, bool min)
 {
-    if ( Objects[obj_num].type == OBJ_BEAM ) {
-        beam *b = &Beams[Objects[obj_num].instance];
-
-        // use the last start and last shot as endpoints
-        float min_end, max_end;
-        if ( b->last_start.a1d[axis] > b->last_shot.a1d[axis] ) {
-            min_end = b->last_shot.a1d[axis];
-            max_end = b->last_start.a1d[axis];
-        } else {
-            min_end = b->last_start.a1d[axis];
-            max_end = b->last_shot.a1d[axis];
-        }
-
-        if ( min ) {
-            return min_end;
-        } else {
-            return max_end;
-        }
-    } else if ( Objects[obj_num].type == OBJ_WEAPON ) {
-        float min_end, max_end;
-
-        if ( Objects[obj_num].pos.a1d[axis] > Objects[obj_num].last_pos.a1d[axis] ) {
-            min_end = Objects[obj_num].last_pos.a1d[axis];
-            max_end = Objects[obj_num].pos.a1d[axis];
-        } else {
-            min_end = Objects[obj_num].pos.a1d[axis];
-            max_end = Objects[obj_num].last_pos.a1d[axis];
-        }
-
-        if ( min ) {
-            return min_end - Objects[obj_num].radius;
-        } else {
-            return max_end + Objects[obj_num].radius;
-        }
+    if ( min ) {
+        return Obj_bounds.sweep_min[obj_num].a1d[axis];
     } else {
-        vec3d *pos = &Objects[obj_num].pos;
-
-        if ( min ) {
-            return pos->a1d[axis] - Objects[obj_num].radius;
-        } else {
-            return pos->a1d[axis] + Objects[obj_num].radius;
-        }
+        return Obj_bounds.sweep_max[obj_num].a1d[axis];
     }
 }
 
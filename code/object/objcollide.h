@@ -43,6 +43,10 @@ struct collision_info_struct {
 #define MIN_LANDING_SOUND_VEL			2.0f
 #define LANDING_POS_OFFSET				0.05f
 
+// Added to the ranges of the coarse distance tests which pick the candidates for an exact test (turret targets,
+// shockwave victims, beam collisions) so float rounding in the coarse test never drops an object the exact test takes
+#define COLLISION_PREFILTER_SLACK		1.0f
+
 //===============================================================================
 // GENERAL COLLISION DETECTION HELPER FUNCTIONS 
 // These are in CollideGeneral.cpp and are used by one or more of the collision-
@@ -133,6 +137,8 @@ int get_ship_quadrant_from_global(vec3d *global_pos, object *objp);
 
 bool reject_due_collision_groups(object *A, object *B);
 
+int reject_obj_pair_on_parent(object *A, object *B);
+
 void init_collision_info_struct(collision_info_struct *cis);
 
 // goes over weapons applying gravity-relevant flags
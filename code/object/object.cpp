@@ -31,6 +31,7 @@
 #include "object/deadobjectdock.h"
 #include "object/objcollide.h"
 #include "object/object.h"
+#include "object/objectbounds.h"
 #include "object/objectdock.h"
 #include "object/objectshield.h"
 #include "object/objectsnd.h"
@@ -550,6 +551,8 @@ int obj_create(ubyte type,int parent_obj,int instance, matrix * orient,
 	obj->n_quadrants = DEFAULT_SHIELD_SECTIONS; // Might be changed by the ship creation code
 	obj->shield_quadrant.resize(obj->n_quadrants);
 
+	obj_bounds_update(obj);
+
 	return objnum;
 }
 
@@ -852,6 +855,42 @@ void obj_player_fire_stuff( object *objp, control_info ci )
 	
 }
 
+// if a weapon is flagged as dead, kill its engines just like a ship
+static void obj_move_kill_weapon_engines(object *objp)
+{
+	if((objp->type == OBJ_WEAPON) && (Weapons[objp->instance].weapon_flags[Weapon::Weapon_Flags::Dead_in_water])){
+		vm_vec_zero(&objp->phys_info.desired_vel);
+		vm_vec_zero(&objp->phys_info.desired_rotvel);
+		objp->phys_info.flags |= (PF_REDUCED_DAMP | PF_DEAD_DAMP);
+		objp->phys_info.side_slip_time_const = 1.0f;	// FIXME?  originally indexed into Ship_info[], which was a bug...
+	}
+}
+
+//2D MODE
+//THIS IS A FREAKIN' HACK
+//Do not let ship change position on Y axis
+static void obj_move_2d_mission_hack(object *objp)
+{
+	if(The_mission.flags[Mission::Mission_Flags::Mission_2d])
+	{
+		angles old_angles, new_angles;
+		objp->pos.xyz.y = objp->last_pos.xyz.y;
+		vm_extract_angles_matrix(&old_angles, &objp->last_orient);
+		vm_extract_angles_matrix(&new_angles, &objp->orient);
+		new_angles.p = old_angles.p;
+		new_angles.b = old_angles.b;
+		vm_angles_2_matrix(&objp->orient, &new_angles);
+
+		//Phys stuff hack
+		new_angles.h = old_angles.h;
+		vm_angles_2_matrix(&objp->phys_info.last_rotmat, &new_angles);
+		objp->phys_info.vel.xyz.y = 0.0f;
+		objp->phys_info.desired_rotvel.xyz.x = 0;
+		objp->phys_info.desired_rotvel.xyz.z = 0;
+		objp->phys_info.desired_vel.xyz.y = 0.0f;
+	}
+}
+
 void obj_move_call_physics(object *objp, float frametime)
 {
 	TRACE_SCOPE(tracing::Physics);
@@ -918,13 +957,7 @@ void obj_move_call_physics(object *objp, float frametime)
 			}
 		}
 
-		// if a weapon is flagged as dead, kill its engines just like a ship
-		if((objp->type == OBJ_WEAPON) && (Weapons[objp->instance].weapon_flags[Weapon::Weapon_Flags::Dead_in_water])){
-			vm_vec_zero(&objp->phys_info.desired_vel);
-			vm_vec_zero(&objp->phys_info.desired_rotvel);
-			objp->phys_info.flags |= (PF_REDUCED_DAMP | PF_DEAD_DAMP);
-			objp->phys_info.side_slip_time_const = 1.0f;	// FIXME?  originally indexed into Ship_info[], which was a bug...
-		}
+		obj_move_kill_weapon_engines(objp);
 
 		if (physics_paused)	{
 			if (objp==Player_obj){
@@ -972,26 +1005,37 @@ void obj_move_call_physics(object *objp, float frametime)
 		}
 	}
 
-	//2D MODE
-	//THIS IS A FREAKIN' HACK
-	//Do not let ship change position on Y axis
-	if(The_mission.flags[Mission::Mission_Flags::Mission_2d])
-	{
-		angles old_angles, new_angles;
-		objp->pos.xyz.y = objp->last_pos.xyz.y;
-		vm_extract_angles_matrix(&old_angles, &objp->last_orient);
-		vm_extract_angles_matrix(&new_angles, &objp->orient);
-		new_angles.p = old_angles.p;
-		new_angles.b = old_angles.b;
-		vm_angles_2_matrix(&objp->orient, &new_angles);
+	obj_move_2d_mission_hack(objp);
+}
 
-		//Phys stuff hack
-		new_angles.h = old_angles.h;
-		vm_angles_2_matrix(&objp->phys_info.last_rotmat, &new_angles);
-		objp->phys_info.vel.xyz.y = 0.0f;
-		objp->phys_info.desired_rotvel.xyz.x = 0;
-		objp->phys_info.desired_rotvel.xyz.z = 0;
-		objp->phys_info.desired_vel.xyz.y = 0.0f;
+// Whether obj_move_call_physics() can be replaced by obj_move_call_physics_batch() for this object. Only the large
+// numbers of simple bodies are batched, ships with their flight models keep going through obj_move_call_physics().
+static bool obj_physics_batchable(const object *objp)
+{
+	if (physics_paused || !objp->flags[Object::Object_Flags::Physics]) {
+		return false;
+	}
+
+	return (objp->type == OBJ_WEAPON) || (objp->type == OBJ_DEBRIS) || (objp->type == OBJ_ASTEROID);
+}
+
+// Does the same as calling obj_move_call_physics() for each of the objects, which all passed obj_physics_batchable()
+static void obj_move_call_physics_batch(const SCP_vector<object*> &objects, float frametime)
+{
+	TRACE_SCOPE(tracing::Physics);
+
+	static physics_batch batch;
+	batch.clear();
+
+	for (auto objp : objects) {
+		obj_move_kill_weapon_engines(objp);
+		batch.add(&objp->pos, &objp->orient, &objp->phys_info);
+	}
+
+	physics_sim_batch(&batch, &The_mission.gravity, frametime);
+
+	for (auto objp : objects) {
+		obj_move_2d_mission_hack(objp);
 	}
 }
 
@@ -1454,6 +1498,58 @@ DCF_BOOL( collisions, Collisions_enabled )
 
 MONITOR( NumObjects )
 
+// Everything that happens to an object after its physics, the second half of moving it in obj_move_all()
+static void obj_move_one_post_physics(object *objp, float frametime)
+{
+	// Submodel movement now happens here, right after physics movement.  It's not excluded by the "immobile" flag.
+	
+	// this flag only affects ship subsystems, not any other type of submodel movement
+	if (objp->type == OBJ_SHIP && !Ships[objp->instance].flags[Ship::Ship_Flags::Subsystem_movement_locked])
+		ship_move_subsystems(objp);
+
+	// do animation on this object
+	int model_instance_num = object_get_model_instance(objp);
+	if (model_instance_num > -1) {
+		polymodel_instance* pmi = model_get_instance(model_instance_num);
+		animation::ModelAnimation::stepAnimations(frametime, pmi);
+	}
+
+	// finally, do intrinsic motion on this object
+	// (this happens last because look_at is a type of intrinsic rotation,
+	// and look_at needs to happen last or the angle may be off by a frame)
+	model_do_intrinsic_motions(objp);
+
+	// For ships, we now have to make sure that all the submodel detail levels remain consistent.
+	if (objp->type == OBJ_SHIP)
+		ship_model_replicate_submodels(objp);
+
+	// move post
+	obj_move_all_post(objp, frametime);
+
+	obj_bounds_update(objp);
+
+	// Equipment script processing
+	if (objp->type == OBJ_SHIP) {
+		ship* shipp = &Ships[objp->instance];
+		object* target;
+
+		if (Ai_info[shipp->ai_index].target_objnum != -1)
+			target = &Objects[Ai_info[shipp->ai_index].target_objnum];
+		else
+			target = NULL;
+		if (objp == Player_obj && Player_ai->target_objnum != -1)
+			target = &Objects[Player_ai->target_objnum];
+
+		if (scripting::hooks::OnWeaponEquipped->isActive()) {
+			scripting::hooks::OnWeaponEquipped->run(scripting::hooks::WeaponEquippedConditions{ shipp, target },
+				scripting::hook_param_list(
+					scripting::hook_param("User", 'o', objp),
+					scripting::hook_param("Target", 'o', target)
+				));
+		}
+	}
+}
+
 /**
  * Move all objects for the current frame
  */
@@ -1477,6 +1573,9 @@ void obj_move_all(float frametime)
 
 	obj_merge_created_list();
 
+	// Positions may have been set directly since the last frame and the AI reads them from the table
+	obj_bounds_update_all();
+
 	// Clear the table that tells which groups of weapons have cast light so far.
 	if(!(Game_mode & GM_MULTIPLAYER) || (MULTIPLAYER_MASTER)) {
 		obj_clear_weapon_group_id_list();
@@ -1484,6 +1583,9 @@ void obj_move_all(float frametime)
 
 	MONITOR_INC( NumObjects, Num_objects );	
 
+	static SCP_vector<object*> batched_objects;
+	batched_objects.clear();
+
 	for (objp = GET_FIRST(&obj_used_list); objp != END_OF_LIST(&obj_used_list); objp = GET_NEXT(objp)) {
 		// skip objects which should be dead
 		if (objp->flags[Object::Object_Flags::Should_be_dead]) {
@@ -1537,6 +1639,10 @@ void obj_move_all(float frametime)
 			// if this is an object which should be interpolated in multiplayer, do so
 			if (interpolation_object) {
 				objp->interp_info.interpolate_main(&objp->pos, &objp->orient, &objp->phys_info, &objp->last_pos, &objp->last_orient, &The_mission.gravity, objp->flags[Object::Object_Flags::Player_ship]);
+			} else if (obj_physics_batchable(objp)) {
+				// done together with all the others after this loop
+				batched_objects.push_back(objp);
+				continue;
 			} else {
 				// physics
 				obj_move_call_physics(objp, frametime);
@@ -1549,50 +1655,20 @@ void obj_move_all(float frametime)
 			vm_vec_zero(&objp->phys_info.desired_rotvel);
 		}
 
-		// Submodel movement now happens here, right after physics movement.  It's not excluded by the "immobile" flag.
-		
-		// this flag only affects ship subsystems, not any other type of submodel movement
-		if (objp->type == OBJ_SHIP && !Ships[objp->instance].flags[Ship::Ship_Flags::Subsystem_movement_locked])
-			ship_move_subsystems(objp);
-
-		// do animation on this object
-		int model_instance_num = object_get_model_instance(objp);
-		if (model_instance_num > -1) {
-			polymodel_instance* pmi = model_get_instance(model_instance_num);
-			animation::ModelAnimation::stepAnimations(frametime, pmi);
-		}
-
-		// finally, do intrinsic motion on this object
-		// (this happens last because look_at is a type of intrinsic rotation,
-		// and look_at needs to happen last or the angle may be off by a frame)
-		model_do_intrinsic_motions(objp);
-
-		// For ships, we now have to make sure that all the submodel detail levels remain consistent.
-		if (objp->type == OBJ_SHIP)
-			ship_model_replicate_submodels(objp);
+		obj_move_one_post_physics(objp, frametime);
+	}
 
-		// move post
-		obj_move_all_post(objp, frametime);
+	// the simple objects held back above are simulated all at once, and then the rest of their move follows
+	if (!batched_objects.empty()) {
+		obj_move_call_physics_batch(batched_objects, frametime);
 
-		// Equipment script processing
-		if (objp->type == OBJ_SHIP) {
-			ship* shipp = &Ships[objp->instance];
-			object* target;
-
-			if (Ai_info[shipp->ai_index].target_objnum != -1)
-				target = &Objects[Ai_info[shipp->ai_index].target_objnum];
-			else
-				target = NULL;
-			if (objp == Player_obj && Player_ai->target_objnum != -1)
-				target = &Objects[Player_ai->target_objnum];
-
-			if (scripting::hooks::OnWeaponEquipped->isActive()) {
-				scripting::hooks::OnWeaponEquipped->run(scripting::hooks::WeaponEquippedConditions{ shipp, target },
-					scripting::hook_param_list(
-						scripting::hook_param("User", 'o', objp),
-						scripting::hook_param("Target", 'o', target)
-					));
+		for (auto batched_objp : batched_objects) {
+			// objects moved after this one was held back may have killed it in the meantime
+			if (batched_objp->flags[Object::Object_Flags::Should_be_dead]) {
+				continue;
 			}
+
+			obj_move_one_post_physics(batched_objp, frametime);
 		}
 	}
 
@@ -1649,6 +1725,7 @@ void obj_move_all(float frametime)
 
 	if ( Collisions_enabled ) {
 		TRACE_SCOPE(tracing::CollisionDetection);
+		beam_collide_previous_stops();
 		obj_sort_and_collide();
 	}
 
@@ -1865,7 +1942,7 @@ int obj_team(object *objp)
 			break;
 */
 		case OBJ_WEAPON:
-			Assert( objp->instance >= 0 && objp->instance < MAX_WEAPONS );
+			Assert( objp->instance >= 0 && objp->instance < Weapons.capacity() );
 			team = Weapons[objp->instance].team;
 			break;
 
@@ -376,6 +376,9 @@ int object_get_model_instance(const object *objp);
 
 void obj_render_queue_all();
 
+// Returns 1 if the bounding box of the sphere may be inside the view cone of the current 3d frame
+int obj_sphere_in_view_cone(const vec3d *pos, float radius);
+
 /**
  * @brief Compares two object pointers and determines if they refer to the same object
  *
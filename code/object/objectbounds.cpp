@@ -0,0 +1,48 @@
+
+#include "object/objectbounds.h"
+
+#include "globalincs/linklist.h"
+#include "object/object.h"
+#include "weapon/beam.h"
+
+#include <algorithm>
+
+object_bounds_table Obj_bounds;
+
+void obj_bounds_update(const object* objp)
+{
+	const int objnum = OBJ_INDEX(objp);
+
+	Obj_bounds.pos[objnum]    = objp->pos;
+	Obj_bounds.radius[objnum] = objp->radius;
+
+	auto& sweep_min = Obj_bounds.sweep_min[objnum];
+	auto& sweep_max = Obj_bounds.sweep_max[objnum];
+
+	if (objp->type == OBJ_BEAM) {
+		const beam* b = &Beams[objp->instance];
+
+		// use the last start and last shot as endpoints
+		for (int axis = 0; axis < 3; ++axis) {
+			sweep_min.a1d[axis] = std::min(b->last_start.a1d[axis], b->last_shot.a1d[axis]);
+			sweep_max.a1d[axis] = std::max(b->last_start.a1d[axis], b->last_shot.a1d[axis]);
+		}
+	} else if (objp->type == OBJ_WEAPON) {
+		for (int axis = 0; axis < 3; ++axis) {
+			sweep_min.a1d[axis] = std::min(objp->pos.a1d[axis], objp->last_pos.a1d[axis]) - objp->radius;
+			sweep_max.a1d[axis] = std::max(objp->pos.a1d[axis], objp->last_pos.a1d[axis]) + objp->radius;
+		}
+	} else {
+		for (int axis = 0; axis < 3; ++axis) {
+			sweep_min.a1d[axis] = objp->pos.a1d[axis] - objp->radius;
+			sweep_max.a1d[axis] = objp->pos.a1d[axis] + objp->radius;
+		}
+	}
+}
+
+void obj_bounds_update_all()
+{
+	for (auto objp = GET_FIRST(&obj_used_list); objp != END_OF_LIST(&obj_used_list); objp = GET_NEXT(objp)) {
+		obj_bounds_update(objp);
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "globalincs/globals.h"
+#include "math/vecmat.h"
+
+class object;
+
+/**
+ * @brief Dense copies of the object data which is read for every object each frame, indexed by object number
+ *
+ * The object class is large and most of it is only touched occasionally. Code which has to look at the position or size
+ * of many objects (collision sorting, view culling, proximity searches) reads this table instead so it only pulls in
+ * the data it needs.
+ *
+ * The entries are updated when an object is created, at the start of every frame, after it was moved by physics or
+ * docking and after collision response pushed it. Code which sets a position directly (scripts, SEXPs, multiplayer
+ * updates) is therefore picked up before the AI of the next frame looks at the table. Anything that moves an object in
+ * the middle of the frame must call obj_bounds_update() if the change has to be visible right away.
+ */
+struct object_bounds_table {
+	vec3d pos[MAX_OBJECTS];
+	float radius[MAX_OBJECTS];
+
+	// A box around everything the object covered this frame. For weapons this includes the path from the last position
+	// and for beams the entire beam without any radius. Used as the collision sorting endpoints.
+	vec3d sweep_min[MAX_OBJECTS];
+	vec3d sweep_max[MAX_OBJECTS];
+};
+
+extern object_bounds_table Obj_bounds;
+
+/**
+ * @brief Copies the current position and size of an object into Obj_bounds
+ */
+void obj_bounds_update(const object* objp);
+
+/**
+ * @brief Updates the entries of all objects in the used list
+ */
+void obj_bounds_update_all();
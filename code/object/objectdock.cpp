@@ -10,6 +10,7 @@
 #include "math/vecmat.h"
 #include "mission/missionparse.h"
 #include "object/object.h"
+#include "object/objectbounds.h"
 #include "object/objectdock.h"
 #include "ship/ship.h"
 
@@ -602,6 +603,7 @@ void dock_move_docked_children_tree(object *objp, object *parent_objp)
 	{
 		// move this object to align with it
 		obj_move_one_docked_object(objp, parent_objp);
+		obj_bounds_update(objp);
 	}
 
 	// iterate through all docked objects
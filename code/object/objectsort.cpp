@@ -16,16 +16,19 @@
 #include "asteroid/asteroid.h"
 #include "cmdline/cmdline.h"
 #include "debris/debris.h"
+#include "executor/WorkerPool.h"
 #include "graphics/light.h"
 #include "jumpnode/jumpnode.h"
 #include "mission/missionparse.h"
 #include "model/modelrender.h"
 #include "nebula/neb.h"
 #include "object/object.h"
+#include "object/objectbounds.h"
 #include "scripting/scripting.h"
 #include "render/3d.h"
 #include "render/batching.h"
 #include "ship/ship.h"
+#include "tracing/Monitor.h"
 #include "tracing/tracing.h"
 #include "weapon/weapon.h"
 #include "decals/decals.h"
@@ -129,18 +132,39 @@ vec3d check_offsets[8] = {
 // This routine could possibly be optimized.  Right now, for an
 // offscreen object, it has to rotate 8 points to determine it's
 // offscreen.  Not the best considering we're looking at a sphere.
+// This only reads the view state so it may be called from the worker threads.
 int obj_in_view_cone( object * objp )
+{
+	return obj_sphere_in_view_cone(&objp->pos, objp->radius);
+}
+
+int obj_sphere_in_view_cone( const vec3d *pos, float radius )
 {
 	int i;
-	vec3d tmp,pt;
+	vec3d tmp,rel,center,axes[3];
 	ubyte codes;
 
+	// Only rotate the center and the axes of the box, the corners are combinations of them.
+	// This gives the same codes as rotating every corner with g3_rotate_vector()
+	vm_vec_sub( &rel, pos, &View_position );
+	vm_vec_rotate( &center, &rel, &View_matrix );
+
+	for (i=0; i<3; i++ ) {
+		axes[i].xyz.x = View_matrix.vec.rvec.a1d[i] * radius;
+		axes[i].xyz.y = View_matrix.vec.uvec.a1d[i] * radius;
+		axes[i].xyz.z = View_matrix.vec.fvec.a1d[i] * radius;
+	}
+
 	// Center isn't in... are other points?
 	ubyte and_codes = 0xff;
 
 	for (i=0; i<8; i++ ) {
-		vm_vec_scale_add( &pt, &objp->pos, &check_offsets[i], objp->radius );
-		codes=g3_rotate_vector(&tmp,&pt);
+		tmp = center;
+		vm_vec_scale_add2( &tmp, &axes[0], check_offsets[i].xyz.x );
+		vm_vec_scale_add2( &tmp, &axes[1], check_offsets[i].xyz.y );
+		vm_vec_scale_add2( &tmp, &axes[2], check_offsets[i].xyz.z );
+
+		codes=g3_code_vector(&tmp);
 		if ( !codes ) {
 			//mprintf(( "A point is inside, so render it.\n" ));
 			return 1;		// this point is in, so return 1
@@ -173,6 +197,96 @@ bool is_full_nebula()
 	return (The_mission.flags[Mission::Mission_Flags::Fullneb]) && (Neb2_render_mode != NEB2_RENDER_NONE) && !Fred_running;
 }
 
+// Objects are culled in chunks of this many object slots
+const int OBJ_CULL_CHUNK_SIZE = 128;
+
+// Below this many object slots the chunks are culled on the main thread. Culling an object only takes a few dozen
+// nanoseconds so waking up the workers costs more than it saves until there are a lot of objects.
+const int OBJ_CULL_PARALLEL_MIN_OBJECTS = 1024;
+
+struct obj_cull_chunk {
+	SCP_vector<object*> visible;
+	int num_culled = 0;
+};
+
+// The results of each chunk, kept around so that the vectors do not have to be reallocated every frame
+static SCP_vector<obj_cull_chunk> Obj_cull_chunks;
+
+MONITOR(NumObjectsCulled)
+
+static void obj_cull_chunk_objects(size_t chunk, bool full_neb)
+{
+	auto& chunk_data = Obj_cull_chunks[chunk];
+	chunk_data.visible.clear();
+	chunk_data.num_culled = 0;
+
+	const int first = static_cast<int>(chunk) * OBJ_CULL_CHUNK_SIZE;
+	const int last  = std::min(first + OBJ_CULL_CHUNK_SIZE - 1, Highest_object_index);
+
+	for (int i = first; i <= last; ++i) {
+		object* objp = &Objects[i];
+
+		if ( (objp->type == OBJ_NONE) || !( objp->flags [Object::Object_Flags::Renders] ) ) {
+			continue;
+		}
+
+		// only this chunk touches the object so this is safe
+		objp->flags.remove(Object::Object_Flags::Was_rendered);
+
+		if ( !obj_sphere_in_view_cone(&Obj_bounds.pos[i], Obj_bounds.radius[i]) ) {
+			++chunk_data.num_culled;
+			continue;
+		}
+
+		if ( full_neb ) {
+			vec3d to_obj;
+			vm_vec_sub( &to_obj, &Obj_bounds.pos[i], &Eye_position );
+			float z = vm_vec_dot( &Eye_matrix.vec.fvec, &to_obj );
+
+			if ( neb2_skip_render(objp, z) ){
+				++chunk_data.num_culled;
+				continue;
+			}
+		}
+
+		chunk_data.visible.push_back(objp);
+	}
+}
+
+// Determines which objects have to be queued for rendering this frame
+//
+// The view cone and nebula tests of every object are independent of each other so the object slots are split into
+// chunks which are culled on the worker pool once there are enough of them. The results are then concatenated in chunk
+// order which gives the same order (and therefore the same draw list) as culling all objects on the main thread.
+static void obj_cull_all(SCP_vector<object*>& visible)
+{
+	TRACE_SCOPE(tracing::CullObjects);
+
+	const bool full_neb = is_full_nebula();
+	const int num_chunks = (Highest_object_index + OBJ_CULL_CHUNK_SIZE) / OBJ_CULL_CHUNK_SIZE;
+
+	if (static_cast<int>(Obj_cull_chunks.size()) < num_chunks) {
+		Obj_cull_chunks.resize(num_chunks);
+	}
+
+	if (Highest_object_index + 1 < OBJ_CULL_PARALLEL_MIN_OBJECTS) {
+		for (int chunk = 0; chunk < num_chunks; ++chunk) {
+			obj_cull_chunk_objects(static_cast<size_t>(chunk), full_neb);
+		}
+	} else {
+		executor::workerPool().parallel_for(static_cast<size_t>(num_chunks),
+			[full_neb](size_t chunk) { obj_cull_chunk_objects(chunk, full_neb); });
+	}
+
+	visible.clear();
+	for (int chunk = 0; chunk < num_chunks; ++chunk) {
+		const auto& chunk_data = Obj_cull_chunks[chunk];
+
+		visible.insert(visible.end(), chunk_data.visible.begin(), chunk_data.visible.end());
+		MONITOR_INC(NumObjectsCulled, chunk_data.num_culled);
+	}
+}
+
 // Sorts all the objects by Z and renders them
 void obj_render_all(const std::function<void(object*)>& render_function, bool *draw_viewer_last )
 {
@@ -298,47 +412,28 @@ void obj_render_queue_all()
 	GR_DEBUG_SCOPE("Render all objects");
 	TRACE_SCOPE(tracing::RenderScene);
 
-	object *objp;
-	int i;
+	static SCP_vector<object*> visible_objects;
 	model_draw_list scene;
 
-	objp = Objects;
-
 	gr_deferred_lighting_begin(false);
 
 	scene.init();
 
-	bool full_neb = is_full_nebula();
-
-	for ( i = 0; i <= Highest_object_index; i++,objp++ ) {
-		if ( (objp->type != OBJ_NONE) && ( objp->flags [Object::Object_Flags::Renders] ) )	{
-            objp->flags.remove(Object::Object_Flags::Was_rendered);
+	obj_cull_all(visible_objects);
 
-			if ( !obj_in_view_cone(objp) ) {
-				continue;
-			}
-
-			if ( full_neb ) {
-				vec3d to_obj;
-				vm_vec_sub( &to_obj, &objp->pos, &Eye_position );
-				float z = vm_vec_dot( &Eye_matrix.vec.fvec, &to_obj );
-
-				if ( neb2_skip_render(objp, z) ){
-					continue;
-				}
-			}
-
-
-			if ( (objp->type == OBJ_SHIP) && Ships[objp->instance].shader_effect_timestamp.isValid() ) {
-				effect_ships.push_back(objp);
-				continue;
-			}
-
-            objp->flags.set(Object::Object_Flags::Was_rendered);
-			obj_queue_render(objp, &scene);
+	// Queueing runs scripting hooks and adds to the global batching and light lists so it stays on the main thread
+	for ( auto objp : visible_objects ) {
+		if ( (objp->type == OBJ_SHIP) && Ships[objp->instance].shader_effect_timestamp.isValid() ) {
+			effect_ships.push_back(objp);
+			continue;
 		}
+
+		objp->flags.set(Object::Object_Flags::Was_rendered);
+		obj_queue_render(objp, &scene);
 	}
 
+	asteroid_field_rocks_render(&scene);
+
 	scene.init_render();
 
 	scene.render_all(ZBUFFER_TYPE_FULL);
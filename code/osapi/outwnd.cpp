@@ -11,6 +11,7 @@
 #include <cstdarg>
 #include <cstring>
 #include <algorithm>
+#include <mutex>
 
 #ifdef WIN32
 #include <direct.h>
@@ -62,6 +63,10 @@ static const char* FreeSpace_logfilename = nullptr;
 
 static std::unique_ptr<osapi::DebugWindow> debugWindow;
 
+// Sounds are decoded on worker threads and FFmpeg logs from there so all output has to be serialized. This is
+// recursive since outwnd_print writes the missing filter file notice by calling itself.
+static std::recursive_mutex Outwnd_mutex;
+
 void load_filter_info()
 {
 	FILE* fp;
@@ -201,6 +206,8 @@ void outwnd_print(const char *id, const char *tmp)
 	if (!outwnd_inited)
 		return;
 
+	std::lock_guard<std::recursive_mutex> guard(Outwnd_mutex);
+
 	if (Outwnd_no_filter_file == 1) {
 		Outwnd_no_filter_file = 2;
 
@@ -331,6 +338,7 @@ void outwnd_debug_window_init() {
 	debugWindow.reset(new osapi::DebugWindow());
 }
 void outwnd_debug_window_do_frame(float frametime) {
+	std::lock_guard<std::recursive_mutex> guard(Outwnd_mutex);
 	debugWindow->doFrame(frametime);
 }
 void outwnd_debug_window_deinit() {
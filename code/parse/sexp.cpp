@@ -60,6 +60,7 @@
 #include "menuui/techmenu.h"		// for intel stuff
 #include "mission/missionbriefcommon.h"
 #include "mission/missioncampaign.h"
+#include "mission/missioncue.h"
 #include "mission/missiongoals.h"
 #include "mission/missionlog.h"
 #include "mission/missionmessage.h"
@@ -1247,6 +1248,8 @@ void clear_cache(int node)
 		Sexp_nodes[node].cache = nullptr;
 	}
 
+	mission_cue_forget(node);
+
 	// note that cached_variable_index is not reset here because it is a parallel cache (c.f. sexp_get_variable_index)
 }
 
@@ -6819,8 +6822,9 @@ int sexp_check_objective_delay(int delay_node, int objective_node, int(*objectiv
 	{
 		if ((Missiontime - time) >= delay)
 			return val;
-		else
-			return SEXP_FALSE;
+
+		mission_cue_note_wakeup(time + delay);
+		return SEXP_FALSE;
 	}
 
 	return val;
@@ -7262,8 +7266,9 @@ int sexp_are_waypoints_done_delay(int n)
 	{
 		if ((Missiontime - time) >= delay)
 			return val;
-		else
-			return SEXP_FALSE;
+
+		mission_cue_note_wakeup(time + delay);
+		return SEXP_FALSE;
 	}
 
 	return val;
@@ -7363,6 +7368,7 @@ int sexp_has_docked_or_undocked(int n, int op_num)
 		{
 			if ((Missiontime - time) >= delay)
 				return SEXP_KNOWN_TRUE;
+			mission_cue_note_wakeup(time + delay);
 		}
 		// if either ship has exited, no way to dock
 		else if (docker->status == ShipStatus::EXITED || dockee->status == ShipStatus::EXITED)
@@ -7429,6 +7435,7 @@ int sexp_has_time_elapsed(int n)
 	if ( f2i(Missiontime) >= time )
 		return SEXP_KNOWN_TRUE;
 
+	mission_cue_note_wakeup(i2f(time));
 	return SEXP_FALSE;
 }
 
@@ -15721,8 +15728,9 @@ void sexp_set_asteroid_field(int n)
 		}
 	}
 
-	if (num_asteroids > MAX_ASTEROIDS) {
-		num_asteroids = MAX_ASTEROIDS;
+	int max_asteroids = asteroid_field_max_count(((field_type == 1) || (field_type == 3)) ? FT_ACTIVE : FT_PASSIVE);
+	if (num_asteroids > max_asteroids) {
+		num_asteroids = max_asteroids;
 	}
 
 	vec3d o_min = vm_vec_new((float)o_minx, (float)o_miny, (float)o_minz);
@@ -15816,8 +15824,9 @@ void sexp_set_debris_field(int n)
 		n = CDR(n);
 	}
 
-	if (num_asteroids > MAX_ASTEROIDS) {
-		num_asteroids = MAX_ASTEROIDS;
+	int max_asteroids = asteroid_field_max_count(FT_PASSIVE);
+	if (num_asteroids > max_asteroids) {
+		num_asteroids = max_asteroids;
 	}
 
 	vec3d o_min = vm_vec_new((float)o_minx, (float)o_miny, (float)o_minz);
@@ -17614,6 +17623,8 @@ int sexp_event_delay_status( int n, int want_true, bool use_msecs = false)
 			// Note that if the event and the timestamp happen simultaneously, at least one frame must elapse first;
 			// this matches the delay check in the original public source code release
 			else if (!timestamp_elapsed_last_frame(timestamp_delta(Mission_events[i].timestamp, delay))) {
+				// the delay is measured in timestamps rather than mission time
+				mission_cue_note_polling();
 				rval = SEXP_FALSE;
 				break;
 			}
@@ -17698,6 +17709,7 @@ int sexp_goal_delay_status( int n, int want_true )
 		else if ( mission_log_get_time(LOG_GOAL_SATISFIED, name, nullptr, &time) ) {
 			if ( (Missiontime - time) >= delay )
 				return SEXP_KNOWN_TRUE;
+			mission_cue_note_wakeup(time + delay);
 		}
 	} else {
 		// if we are looking for a goal false entry and we find a true, then return known false here
@@ -17706,6 +17718,7 @@ int sexp_goal_delay_status( int n, int want_true )
 		else if ( mission_log_get_time(LOG_GOAL_FAILED, name, nullptr, &time) ) {
 			if ( (Missiontime - time) >= delay )
 				return SEXP_KNOWN_TRUE;
+			mission_cue_note_wakeup(time + delay);
 		}
 	}
 
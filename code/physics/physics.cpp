@@ -103,7 +103,8 @@ void physics_init( physics_info * pi )
 //    delta_pos = delta position (framevec)
 // You can extend this to 3d by calling it 3 times, once for each x,y,z component.
 
-void apply_physics( float damping, float desired_vel, float initial_vel, float t, float * new_vel, float * delta_pos )
+// The same as apply_physics() with e = exp(-t/damping) already computed, which is only used if damping is not (nearly) zero.
+static void apply_physics_factor( float damping, float e, float desired_vel, float initial_vel, float t, float * new_vel, float * delta_pos )
 {
 	if ( damping < 0.0001f )	{
 		if ( delta_pos )
@@ -111,9 +112,8 @@ void apply_physics( float damping, float desired_vel, float initial_vel, float t
 		if ( new_vel )
 			*new_vel = desired_vel;
 	} else {
-		float dv, e;
+		float dv;
 		dv = initial_vel - desired_vel;
-		e = (float)exp( -t/damping );
 		if ( delta_pos )
 			*delta_pos = (1.0f - e)*dv*damping + desired_vel*t;
 		if ( new_vel )
@@ -121,6 +121,13 @@ void apply_physics( float damping, float desired_vel, float initial_vel, float t
 	}
 }
 
+void apply_physics( float damping, float desired_vel, float initial_vel, float t, float * new_vel, float * delta_pos )
+{
+	float e = ( damping < 0.0001f ) ? 0.0f : (float)exp( -t/damping );
+
+	apply_physics_factor(damping, e, desired_vel, initial_vel, t, new_vel, delta_pos);
+}
+
 
 
 float Physics_viewer_bank = 0.0f;
@@ -414,6 +421,149 @@ void physics_sim(vec3d* position, matrix* orient, physics_info* pi, vec3d* gravi
 
 }
 
+//	-----------------------------------------------------------------------------------------------------------
+// Batched simulation
+
+void physics_batch::clear()
+{
+	position.clear();
+	orient.clear();
+	pi.clear();
+}
+
+void physics_batch::add(vec3d *body_position, matrix *body_orient, physics_info *body_pi)
+{
+	position.push_back(body_position);
+	orient.push_back(body_orient);
+	pi.push_back(body_pi);
+}
+
+// exp(-t/damping) for the dampings used by the bodies of a batch. Bodies of the same class share their time constants so
+// there are only a few different ones, each of which only has to be computed once instead of five times per body.
+class physics_damp_factors {
+	static const int MAX_FACTORS = 32;
+
+	float m_sim_time;
+	float m_damping[MAX_FACTORS];
+	float m_factor[MAX_FACTORS];
+	int m_count = 0;
+
+  public:
+	explicit physics_damp_factors(float sim_time) : m_sim_time(sim_time) {}
+
+	float get(float damping)
+	{
+		if (damping < 0.0001f) {
+			return 0.0f;
+		}
+
+		for (int i = 0; i < m_count; ++i) {
+			if (m_damping[i] == damping) {
+				return m_factor[i];
+			}
+		}
+
+		float factor = (float)exp( -m_sim_time/damping );
+		if (m_count < MAX_FACTORS) {
+			m_damping[m_count] = damping;
+			m_factor[m_count] = factor;
+			++m_count;
+		}
+		return factor;
+	}
+};
+
+// Whether physics_sim() would take none of its special paths for this body, so physics_sim_batch() can do it instead
+static bool physics_sim_is_plain(const physics_info *pi)
+{
+	const uint special = PF_BALLISTIC | PF_REDUCED_DAMP | PF_DEAD_DAMP | PF_MANEUVER_NO_DAMP | PF_IN_SHOCKWAVE | PF_SPECIAL_WARP_IN | PF_SPECIAL_WARP_OUT;
+	if (pi->flags & special) {
+		return false;
+	}
+
+	// the AI already did the turning, see physics_sim_rot()
+	return !Framerate_independent_turning || IS_MAT_NULL(&pi->ai_desired_orient);
+}
+
+// physics_sim_vel() and physics_sim_rot() without any of the special cases, see physics_sim_is_plain()
+static void physics_sim_plain(vec3d *position, matrix *orient, physics_info *pi, const vec3d *gravity, float sim_time, physics_damp_factors &factors)
+{
+	vec3d local_disp, local_v_in, local_desired_vel, local_v_out;
+	vec3d old_vel = pi->vel;
+
+	float slip = pi->side_slip_time_const;
+	float slip_factor = factors.get(slip);
+	float z_damp = (pi->flags & PF_NEWTONIAN_DAMP) ? slip : 0.0f;
+	float z_factor = (pi->flags & PF_NEWTONIAN_DAMP) ? slip_factor : 0.0f;
+
+	vm_vec_rotate(&local_v_in, &pi->vel, orient);
+	vm_vec_rotate(&local_desired_vel, &pi->desired_vel, orient);
+
+	apply_physics_factor(slip, slip_factor, local_desired_vel.xyz.x, local_v_in.xyz.x, sim_time, &local_v_out.xyz.x, &local_disp.xyz.x);
+	apply_physics_factor(slip, slip_factor, local_desired_vel.xyz.y, local_v_in.xyz.y, sim_time, &local_v_out.xyz.y, &local_disp.xyz.y);
+	apply_physics_factor(z_damp, z_factor, local_desired_vel.xyz.z, local_v_in.xyz.z, sim_time, &local_v_out.xyz.z, &local_disp.xyz.z);
+
+	vec3d grav_disp = vmd_zero_vector;
+	vec3d grav_vel = vmd_zero_vector;
+	if (pi->gravity_const != 0.0f) {
+		grav_vel = *gravity * sim_time * pi->gravity_const;
+		grav_disp = (grav_vel * sim_time) * 0.5; // 1/2 * at^2
+	}
+
+	vec3d world_disp;
+	vm_vec_unrotate(&world_disp, &local_disp, orient);
+	*position += world_disp;
+	*position += grav_disp;
+
+	vm_vec_unrotate(&pi->vel, &local_v_out, orient);
+	pi->vel += grav_vel;
+
+	pi->acceleration = pi->vel - old_vel;
+	pi->acceleration *= 1 / sim_time;
+
+	// and the rotation
+	vec3d new_rotvel;
+	float rot_factor = factors.get(pi->rotdamp);
+	apply_physics_factor(pi->rotdamp, rot_factor, pi->desired_rotvel.xyz.x, pi->rotvel.xyz.x, sim_time, &new_rotvel.xyz.x, nullptr);
+	apply_physics_factor(pi->rotdamp, rot_factor, pi->desired_rotvel.xyz.y, pi->rotvel.xyz.y, sim_time, &new_rotvel.xyz.y, nullptr);
+	apply_physics_factor(pi->rotdamp, rot_factor, pi->desired_rotvel.xyz.z, pi->rotvel.xyz.z, sim_time, &new_rotvel.xyz.z, nullptr);
+	pi->rotvel = new_rotvel;
+
+	angles tangles;
+	tangles.p = pi->rotvel.xyz.x * sim_time;
+	tangles.h = pi->rotvel.xyz.y * sim_time;
+	tangles.b = pi->rotvel.xyz.z * sim_time;
+
+	matrix tmp;
+	vm_angles_2_matrix(&pi->last_rotmat, &tangles);
+	vm_matrix_x_matrix(&tmp, orient, &pi->last_rotmat);
+	*orient = tmp;
+
+	vm_orthogonalize_matrix(orient);
+
+	pi->speed = vm_vec_mag(&pi->vel);
+	pi->fspeed = vm_vec_dot(&orient->vec.fvec, &pi->vel);
+}
+
+// Simulate all bodies of a batch for this frame, with the same results as calling physics_sim() for each of them
+void physics_sim_batch(physics_batch *batch, vec3d *gravity, float sim_time)
+{
+	const size_t count = batch->pi.size();
+	physics_damp_factors factors(sim_time);
+
+	for (size_t i = 0; i < count; ++i) {
+		physics_info *pi = batch->pi[i];
+
+		if (pi->flags & PF_CONST_VEL) {
+			*batch->position[i] += pi->vel * sim_time;
+		} else if (physics_sim_is_plain(pi)) {
+			physics_sim_plain(batch->position[i], batch->orient[i], pi, gravity, sim_time, factors);
+		} else {
+			physics_sim(batch->position[i], batch->orient[i], pi, gravity, sim_time);
+		}
+	}
+}
+
 //	-----------------------------------------------------------------------------------------------------------
 // Simulate a physics object for this frame.  Used by the editor.  The difference between
 // this function and physics_sim() is that this one uses a heading change to rotate around
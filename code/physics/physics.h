@@ -151,6 +151,20 @@ extern int physics_paused;				//	Set means don't do physics, except for player.
 extern void physics_init( physics_info * pi );
 extern void physics_read_flying_controls( matrix * orient, physics_info * pi, control_info * ci, float sim_time, vec3d *wash_rot=NULL);
 extern void physics_sim(vec3d *position, matrix * orient, physics_info * pi, vec3d* gravity, float sim_time);
+
+// The state of many bodies which are simulated at once by physics_sim_batch(), one entry per body in each array
+struct physics_batch {
+	SCP_vector<vec3d*> position;
+	SCP_vector<matrix*> orient;
+	SCP_vector<physics_info*> pi;
+
+	void clear();
+	void add(vec3d *body_position, matrix *body_orient, physics_info *body_pi);
+};
+
+// Same as calling physics_sim() for every body of the batch, but the damping of all bodies with the same time
+// constants is only computed once. Meant for the large numbers of simple bodies like weapons and debris.
+extern void physics_sim_batch(physics_batch *batch, vec3d* gravity, float sim_time);
 extern void physics_sim_editor(vec3d *position, matrix * orient, physics_info * pi, float sim_time);
 
 extern void physics_sim_vel(vec3d * position, physics_info * pi,matrix * orient, vec3d* gravity, float sim_time);
@@ -156,9 +156,13 @@ void HudGaugeRadarStd::drawBlips(int blip_type, int bright, int distort)
 				drawContactImage(x, y, b->rad, b->radar_image_2d, b->radar_color_image_2d, b->radar_image_size);
 		}
 	}
+
+	drawContactCircles();
 }
 void HudGaugeRadarStd::drawBlipsSorted(int distort)
 {
+	radar_project_blips();
+
 	current_target_x = 0;
 	current_target_y = 0;
 	// draw dim blips first, then bright blips
@@ -183,12 +187,30 @@ void HudGaugeRadarStd::drawContactCircle( int x, int y, int rad )
 			if (Missiontime & 8192)
 				return;
 		}
-		renderCircle(x, y, 6);
+		contact_circles.push_back({gr_screen.current_color, 6, x, y});
 	} else {
 		// rad = RADAR_BLIP_RADIUS_NORMAL;
-		renderCircle(x, y, 4);
+		contact_circles.push_back({gr_screen.current_color, 4, x, y});
 	}
 }
+
+/**
+ * Draws the circles collected by drawContactCircle() with one fill per color and size
+ */
+void HudGaugeRadarStd::drawContactCircles()
+{
+	if (contact_circles.empty()) {
+		return;
+	}
+
+	radar_draw_contact_circle_groups(contact_circles, contact_circle_centers,
+		[this](const color& clr, int diameter, const int* centers, int n_circles) {
+			gr_set_color_fast(&clr);
+			renderCircles(centers, n_circles, diameter);
+		});
+
+	contact_circles.clear();
+}
 void HudGaugeRadarStd::drawContactImage( int x, int y, int rad, int idx, int clr_idx, int size )
 {
 	// this we will move as ships.tbl option (or use for radar scaling etc etc)
@@ -12,8 +12,12 @@
 #ifndef _RADAR_H
 #define _RADAR_H
 
+#include "graphics/2d.h"
 #include "radar/radarsetup.h"
 
+#include <algorithm>
+#include <tuple>
+
 class object;
 struct blip;
 struct color;
@@ -35,6 +39,44 @@ void radar_blip_draw_distorted_std(blip *b);
 void radar_blip_draw_flicker_std(blip *b);
 void radar_draw_image_std( int x, int y, int rad, int idx, int size);
 
+struct radar_contact_circle {
+	color clr;
+	int diameter;
+	int x, y;
+};
+
+/**
+ * Sorts the circles so the ones with the same color and size are next to each other and calls
+ * draw(clr, diameter, centers, n_circles) once for each of these groups. centers holds the x and y position of each
+ * circle of the group one after another, the circles of a group keep the order they were added in.
+ */
+template <typename DrawFunc>
+void radar_draw_contact_circle_groups(SCP_vector<radar_contact_circle>& circles, SCP_vector<int>& centers, DrawFunc draw)
+{
+	auto style = [](const radar_contact_circle& circle) {
+		return std::make_tuple(circle.diameter, circle.clr.red, circle.clr.green, circle.clr.blue, circle.clr.alpha);
+	};
+
+	std::stable_sort(circles.begin(), circles.end(),
+		[&style](const radar_contact_circle& a, const radar_contact_circle& b) { return style(a) < style(b); });
+
+	size_t first = 0;
+	while (first < circles.size()) {
+		const auto& run = circles[first];
+
+		centers.clear();
+		size_t last = first;
+		for (; (last < circles.size()) && (style(circles[last]) == style(run)); ++last) {
+			centers.push_back(circles[last].x);
+			centers.push_back(circles[last].y);
+		}
+
+		draw(run.clr, run.diameter, centers.data(), static_cast<int>(last - first));
+
+		first = last;
+	}
+}
+
 class HudGaugeRadarStd: public HudGaugeRadar
 {
 	hud_frames Radar_gauge;
@@ -45,6 +87,10 @@ class HudGaugeRadarStd: public HudGaugeRadar
 	// formerly parts of Current_radar_global
 	float Radar_center_offsets[2];
 
+	// contact circles of the blip type being drawn, drawn together by drawContactCircles()
+	SCP_vector<radar_contact_circle> contact_circles;
+	SCP_vector<int> contact_circle_centers;
+
 protected:
 	/**
 	 * @brief Clamps and scales the blip to be within the plot area
@@ -62,6 +108,7 @@ public:
 	void drawBlips(int blip_type, int bright, int distort);
 	void drawBlipsSorted(int distort);
 	void drawContactCircle( int x, int y, int rad );
+	void drawContactCircles();
 	void drawContactImage( int x, int y, int rad, int idx, int clr_idx, int size );
 	void drawCrosshairs(int x, int y);
 	void render(float frametime) override;
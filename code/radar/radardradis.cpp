@@ -454,6 +454,8 @@ void HudGaugeRadarDradis::drawBlipsSorted(int distort)
 {
 	GR_DEBUG_SCOPE("Draw Dradis blips");
 
+	radar_project_blips();
+
 	matrix base_tilt = vmd_identity_matrix;
 	
 	vm_angle_2_matrix(&base_tilt, -PI/6, 0);
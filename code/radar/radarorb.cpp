@@ -295,6 +295,8 @@ void HudGaugeRadarOrb::drawBlips(int blip_type, int bright, int distort)
 
 void HudGaugeRadarOrb::drawBlipsSorted(int distort)
 {
+	radar_project_blips();
+
 	g3_start_instance_matrix(&vmd_zero_vector, &view_perturb, false);
 
 	vm_vec_zero(&target_position);
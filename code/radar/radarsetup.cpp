@@ -77,6 +77,10 @@ blip	Blip_dim_list[MAX_BLIP_TYPES];			// linked list of dim blips
 blip	Blips[MAX_BLIPS];								// blips pool
 int	N_blips;											// next blip index to take from pool
 
+// World positions of the blips, radar_project_blips() turns them into the eye relative blip positions
+static vec3d	Blip_world_pos[MAX_BLIPS];
+static bool	Blips_projected;
+
 float	Radar_bright_range;					// range at which we start dimming the radar blips
 int		Radar_calc_bright_dist_timer;		// timestamp at which we recalc Radar_bright_range
 
@@ -146,7 +150,6 @@ void radar_stuff_blip_info(object *objp, int is_bright, color **blip_color, int
 
 void radar_plot_object( object *objp )
 {
-	vec3d pos, tempv;
 	float awacs_level, dist, max_radar_dist;
 	vec3d world_pos = objp->pos;
 	SCP_list<CJumpNode>::iterator jnp;
@@ -167,24 +170,9 @@ void radar_plot_object( object *objp )
 		return;
 	}
 
-	// get team-wide awacs level for the object if not ship
-	int ship_is_visible = 0;
-	if (objp->type == OBJ_SHIP) {
-		if (Player_ship != NULL) {
-			if (ship_is_visible_by_team(objp, Player_ship)) {
-				ship_is_visible = 1;
-			}
-		}
-	}
-
-	// only check awacs level if ship is not visible by team
-	awacs_level = 1.5f;
-	if (Player_ship != NULL && !ship_is_visible) {
-		awacs_level = awacs_get_level(objp, Player_ship);
-	}
-
-	// if the awacs level is unviewable - bail
-	if(awacs_level < 0.0f && !See_all){
+	// no room for another blip, don't bother with the rest
+	if (N_blips >= MAX_BLIPS)
+	{
 		return;
 	}
 
@@ -241,23 +229,32 @@ void radar_plot_object( object *objp )
 			return;
 	}
 
-	// Retrieve the eye orientation so we can position the blips relative to it
-	matrix eye_orient;
+	// Apply range filter, before the AWACS level since that has to look at every AWACS ship
+	dist = vm_vec_dist_squared(&world_pos, &Player_obj->pos);
+	max_radar_dist = Radar_ranges[HUD_config.rp_dist];
+	if (dist > max_radar_dist * max_radar_dist) {
+		return;
+	}
+	dist = fl_sqrt(dist);
 
-	if (Player_obj->type == OBJ_SHIP) 
-		ship_get_eye(&tempv, &eye_orient, Player_obj, false , false);
-	else
-		eye_orient = Player_obj->orient;
+	// get team-wide awacs level for the object if not ship
+	int ship_is_visible = 0;
+	if (objp->type == OBJ_SHIP) {
+		if (Player_ship != NULL) {
+			if (ship_is_visible_by_team(objp, Player_ship)) {
+				ship_is_visible = 1;
+			}
+		}
+	}
 
-	// JAS -- new way of getting the rotated point that doesn't require this to be
-	// in a g3_start_frame/end_frame block.
-	vm_vec_sub(&tempv, &world_pos, &Player_obj->pos);
-	vm_vec_rotate(&pos, &tempv, &eye_orient);
+	// only check awacs level if ship is not visible by team
+	awacs_level = 1.5f;
+	if (Player_ship != NULL && !ship_is_visible) {
+		awacs_level = awacs_get_level(objp, Player_ship);
+	}
 
-	// Apply range filter
-	dist = vm_vec_dist(&world_pos, &Player_obj->pos);
-	max_radar_dist = Radar_ranges[HUD_config.rp_dist];
-	if (dist > max_radar_dist) {
+	// if the awacs level is unviewable - bail
+	if(awacs_level < 0.0f && !See_all){
 		return;
 	}
 
@@ -274,11 +271,6 @@ void radar_plot_object( object *objp )
 	int blip_bright = 0;
 	int blip_type = 0;
 
-	if (N_blips >= MAX_BLIPS)
-	{
-		return;
-	}
-
 	b = &Blips[N_blips];
 	b->flags = 0;
 
@@ -299,7 +291,8 @@ void radar_plot_object( object *objp )
 	else
 		list_append(&Blip_dim_list[blip_type], b);
 
-	b->position = pos;
+	// positioned relative to the eye in radar_project_blips()
+	Blip_world_pos[N_blips] = world_pos;
 	b->dist = dist;
 	b->objp = objp;
 	b->radar_image_2d = -1;
@@ -356,11 +349,55 @@ void radar_mission_init()
 	Radar_calc_bright_dist_timer = timestamp(0);
 }
 
+/**
+ * Positions all blips of this frame relative to the player's eye
+ *
+ * The blips are collected while the objects move, this is done once for all of them when the first radar gauge draws
+ * them. The eye orientation is only looked up once and all blips are rotated in one batch.
+ */
+void radar_project_blips()
+{
+	if (Blips_projected) {
+		return;
+	}
+	Blips_projected = true;
+
+	if ((N_blips == 0) || (Player_obj == nullptr)) {
+		return;
+	}
+
+	// Retrieve the eye orientation so we can position the blips relative to it
+	matrix eye_orient;
+	vec3d eye_pos;
+
+	if (Player_obj->type == OBJ_SHIP)
+		ship_get_eye(&eye_pos, &eye_orient, Player_obj, false , false);
+	else
+		eye_orient = Player_obj->orient;
+
+	// JAS -- new way of getting the rotated point that doesn't require this to be
+	// in a g3_start_frame/end_frame block.
+	// the distance has to come from the same player position as the rotated blip, the player may have moved since the
+	// blip was plotted
+	static vec3d positions[MAX_BLIPS];
+	for (int i = 0; i < N_blips; i++) {
+		vm_vec_sub(&positions[i], &Blip_world_pos[i], &Player_obj->pos);
+		Blips[i].dist = vm_vec_mag(&positions[i]);
+	}
+
+	vm_vec_rotate_batch(positions, positions, N_blips, &eye_orient);
+
+	for (int i = 0; i < N_blips; i++) {
+		Blips[i].position = positions[i];
+	}
+}
+
 void radar_null_nblips()
 {
 	int i;
 
 	N_blips=0;
+	Blips_projected = false;
 
 	for (i=0; i<MAX_BLIP_TYPES; i++) {
 		list_init(&Blip_bright_list[i]);
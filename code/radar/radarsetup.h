@@ -91,6 +91,7 @@ enum RadarVisibility
 void radar_frame_init();
 void radar_mission_init();
 void radar_plot_object( object *objp );
+void radar_project_blips();
 RadarVisibility radar_is_visible( object *objp );
 
 extern sound_handle Radar_static_looping;
@@ -466,16 +466,12 @@ void g3_render_rect_oriented_internal(material* material_params, vec3d *pos, mat
 	p[3].xyz.x = width;
 	p[3].xyz.y = -height;
 
-	for ( int i = 0; i < NUM_VERTICES; i++ ) {
-		vec3d tmp = vmd_zero_vector;
-
-		//Rotate correctly
-		vm_vec_unrotate(&tmp, &p[i], ori);
-		//Move to point in space
-		vm_vec_add2(&tmp, pos);
+	//Rotate correctly and move to point in space
+	vm_vec_unrotate_batch(p, p, NUM_VERTICES, ori, pos);
 
+	for ( int i = 0; i < NUM_VERTICES; i++ ) {
 		//Convert to vertex
-		g3_transfer_vertex(&v[i], &tmp);
+		g3_transfer_vertex(&v[i], &p[i]);
 	}
 
 	v[0].texture_position.u = 1.0f;
@@ -29,6 +29,7 @@ extern void init_free_points(void);
 extern void clip_line(vertex **p0,vertex **p1,ubyte codes_or, uint flags);
 
 extern int G3_count;
+extern int instance_depth;
 
 extern int G3_user_clip;
 extern vec3d G3_user_clip_normal;
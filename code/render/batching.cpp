@@ -13,6 +13,7 @@
 #include "graphics/2d.h"
 #include "render/3d.h"
 #include "graphics/material.h"
+#include "graphics/util/FrameRingBuffer.h"
 #include "tracing/tracing.h"
 
 static SCP_map<batch_info, primitive_batch> Batching_primitives;
@@ -76,9 +77,7 @@ void batching_init_buffer(primitive_batch_buffer *buffer, primitive_type prim_ty
 {
 	batching_setup_vertex_layout(&buffer->layout, vertex_mask);
 
-	buffer->buffer_num = gr_create_buffer(BufferType::Vertex, BufferUsageHint::Streaming);
-	buffer->buffer_ptr = NULL;
-	buffer->buffer_size = 0;
+	buffer->buffer_num = gr_buffer_handle();
 	buffer->desired_buffer_size = 0;
 	buffer->prim_type = prim_type;
 }
@@ -375,16 +374,12 @@ void batching_add_polygon_internal(primitive_batch *batch, int texture, vec3d *p
 
 	auto array_index = texture - batch->get_render_info().texture;
 
+	//Rotate correctly and move to point in space
+	vm_vec_unrotate_batch(p, p, NUM_VERTICES, orient, pos);
+
 	for(int i = 0; i < NUM_VERTICES; i++)
 	{
-		vec3d tmp = vmd_zero_vector;
-
-		//Rotate correctly
-		vm_vec_unrotate(&tmp, &p[i], orient);
-		//Move to point in space
-		vm_vec_add2(&tmp, pos);
-
-		v[i].position = tmp;
+		v[i].position = p[i];
 
 		v[i].r = clr->red;
 		v[i].g = clr->green;
@@ -966,34 +961,36 @@ void batching_allocate_and_load_buffer(primitive_batch_buffer *draw_queue)
 {
 	Assert(draw_queue != NULL);
 
-	if ( draw_queue->buffer_size < draw_queue->desired_buffer_size ) {
-		if ( draw_queue->buffer_ptr != NULL ) {
-			vm_free(draw_queue->buffer_ptr);
-		}
+	size_t num_items = draw_queue->items.size();
 
-		draw_queue->buffer_size = draw_queue->desired_buffer_size;
-		draw_queue->buffer_ptr = vm_malloc(draw_queue->desired_buffer_size);
+	// if there are no items in this batch, we will never render it and thus there is no need to put it in vmem
+	if ( num_items == 0 ) {
+		draw_queue->desired_buffer_size = 0;
+		return;
 	}
 
+	// The vertices are written directly into the memory of the frame ring buffer. Aligning the range to the vertex size
+	// allows addressing it with vertex offsets.
+	auto& ring = gr_get_vertex_ring_buffer();
+	auto alloc = ring.allocate(draw_queue->desired_buffer_size, sizeof(batch_vertex));
+
+	draw_queue->buffer_num = alloc.handle;
 	draw_queue->desired_buffer_size = 0;
-	
+
+	auto first_vertex = alloc.offset / sizeof(batch_vertex);
 	size_t offset = 0;
-	size_t num_items = draw_queue->items.size();
 
 	for ( size_t i = 0; i < num_items; ++i ) {
 		primitive_batch_item *item = &draw_queue->items[i];
 
-		item->offset = offset;
-		item->n_verts = item->batch->load_buffer((batch_vertex*)draw_queue->buffer_ptr, offset);
+		item->offset = first_vertex + offset;
+		item->n_verts = item->batch->load_buffer(reinterpret_cast<batch_vertex*>(alloc.data), offset);
 		item->batch->clear();
 		
 		offset += item->n_verts;
 	}
 
-	// if there are no items in this batch, we will never render it and thus there is no need to update it in vmem
-	if (num_items && draw_queue->buffer_num.isValid()) {
-		gr_update_buffer_data(draw_queue->buffer_num, draw_queue->buffer_size, draw_queue->buffer_ptr);
-	}
+	ring.submit(alloc, offset * sizeof(batch_vertex));
 }
 
 void batching_load_buffers(bool distortion)
@@ -1080,12 +1077,6 @@ void batching_render_all(bool render_distortions)
 
 void batching_shutdown()
 {
-	for ( auto buffer_iter = Batching_buffers.begin(); buffer_iter != Batching_buffers.end(); ++buffer_iter ) {
-		primitive_batch_buffer *batch_buffer = &buffer_iter->second;
-
-		if ( batch_buffer->buffer_ptr != NULL ) {
-			vm_free(batch_buffer->buffer_ptr);
-			batch_buffer->buffer_ptr = nullptr;
-		}
-	}
+	// The vertex data lives in the vertex ring buffer of the graphics code so there is nothing to free here
+	Batching_buffers.clear();
 }
@@ -100,10 +100,7 @@ struct primitive_batch_item {
 
 struct primitive_batch_buffer {
 	vertex_layout layout;
-	gr_buffer_handle buffer_num;
-
-	void* buffer_ptr;
-	size_t buffer_size;
+	gr_buffer_handle buffer_num; // The vertex ring buffer the items of this frame were loaded into
 
 	size_t desired_buffer_size;
 
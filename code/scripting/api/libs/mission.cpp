@@ -576,13 +576,13 @@ ADE_INDEXER(l_Mission_Weapons, "number Index", "Gets handle to a weapon object i
 
 	int objnum = -1;
 	if (idx > 0)
-		objnum = object_subclass_at_index(Weapons, MAX_WEAPONS, idx);
+		objnum = object_subclass_at_index(Weapons, Weapons.capacity(), idx);
 
 	return ade_set_args(L, "o", l_Weapon.Set(object_h(objnum)));
 }
 ADE_FUNC(__len, l_Mission_Weapons, NULL, "Number of weapon objects in mission. Note that this is only accurate for one frame.", "number", "Number of weapon objects in mission")
 {
-	return ade_set_args(L, "i", object_subclass_count(Weapons, MAX_WEAPONS));
+	return ade_set_args(L, "i", object_subclass_count(Weapons, Weapons.capacity()));
 }
 
 //****SUBLIBRARY: Mission/Beams
@@ -596,13 +596,13 @@ ADE_INDEXER(l_Mission_Beams, "number Index", "Gets handle to a beam object in th
 
 	int objnum = -1;
 	if (idx > 0)
-		objnum = object_subclass_at_index(Beams, MAX_BEAMS, idx);
+		objnum = object_subclass_at_index(Beams, Beams.capacity(), idx);
 
 	return ade_set_args(L, "o", l_Beam.Set(object_h(objnum)));
 }
 ADE_FUNC(__len, l_Mission_Beams, NULL, "Number of beam objects in mission. Note that this is only accurate for one frame.", "number", "Number of beam objects in mission")
 {
-	return ade_set_args(L, "i", object_subclass_count(Beams, MAX_BEAMS));
+	return ade_set_args(L, "i", object_subclass_count(Beams, Beams.capacity()));
 }
 
 //****SUBLIBRARY: Mission/Wings
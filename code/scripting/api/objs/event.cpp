@@ -2,6 +2,7 @@
 #include "event.h"
 #include "scripting/ade_args.h"
 #include "scripting/ade.h"
+#include "mission/missioncue.h"
 #include "mission/missiongoals.h"
 
 namespace scripting {
@@ -24,6 +25,8 @@ ADE_VIRTVAR(Name, l_Event, "string", "Mission event name", "string", NULL)
 
 	if (ADE_SETTING_VAR && s != nullptr) {
 		mep->name = s;
+		// the event operators of arrival and departure cues look up events by name
+		mission_cue_fact_changed(CueFact::Events);
 	}
 
 	return ade_set_args(L, "s", mep->name.c_str());
@@ -81,6 +84,8 @@ ADE_VIRTVAR(Interval, l_Event, "number", "Time for event to repeat (in seconds)"
 
 	if (ADE_SETTING_VAR) {
 		mep->interval = newinterval;
+		// the event delay operators deduct the interval, the other values scripts can set here are not read by cues
+		mission_cue_fact_changed(CueFact::Events);
 	}
 
 	return ade_set_args(L, "i", mep->interval);
@@ -363,6 +363,8 @@ ADE_FUNC(NumVertices, l_Submodel, nullptr, "Returns the number of vertices in th
 	if (!smh->IsValid())
 		return ade_set_error(L, "i", 0);
 
+	model_finish_pending_loads();
+
 	auto sm = smh->GetSubmodel();
 	bsp_collision_tree* tree = model_get_bsp_collision_tree(sm->collision_tree_index);
 
@@ -380,6 +382,8 @@ ADE_FUNC(GetVertex, l_Submodel, nullptr, "Gets the specified vertex, or a random
 	if (!smh->IsValid())
 		return ADE_RETURN_NIL;
 
+	model_finish_pending_loads();
+
 	auto sm = smh->GetSubmodel(); 
 	bsp_collision_tree* tree = model_get_bsp_collision_tree(sm->collision_tree_index);
 
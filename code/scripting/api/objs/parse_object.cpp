@@ -55,7 +55,7 @@ ADE_VIRTVAR(Name, l_ParseObject, "string",
 		return ade_set_error(L, "s", "");
 
 	if (ADE_SETTING_VAR) {
-		strcpy_s(poh->getObject()->name, newName);
+		mission_parse_set_name(poh->getObject(), newName);
 	}
 
 	return ade_set_args(L, "s", poh->getObject()->name);
@@ -59,6 +59,22 @@ ade_odata_setter<vec3d> convert_arg_type(vec3d vec)
 {
 	return scripting::api::l_Vector.Set(vec);
 }
+
+int hook_parameter_id(const HookBase& hook, const char* name)
+{
+	// Hooks only have a handful of parameters so a linear search is cheaper than any kind of lookup structure. The
+	// names are usually the same string literal so comparing the pointers catches most cases.
+	for (size_t i = 0; i < hook._parameters.size(); ++i) {
+		const auto paramName = hook._parameters[i].name;
+
+		if (paramName == name || strcmp(paramName, name) == 0) {
+			return hook._parameterIds[i];
+		}
+	}
+
+	Assertion(false, "Hook '%s' does not accept parameter '%s'.", hook._hookName.c_str(), name);
+	return script_state::GetHookVariableId(name);
+}
 } // namespace detail
 
 HookVariableDocumentation::HookVariableDocumentation(const char* name_, ade_type_info type_, const char* description_)
@@ -74,6 +90,11 @@ HookBase::HookBase(SCP_string hookName,
 				   int32_t hookId)
 	: _conditions(conditions), _hookName(std::move(hookName)), _description(std::move(description)), _parameters(std::move(parameters)), _deprecation(std::move(deprecation))
 {
+	_parameterIds.reserve(_parameters.size());
+	for (const auto& param : _parameters) {
+		_parameterIds.push_back(script_state::GetHookVariableId(param.name));
+	}
+
 	// If we specify a forced id then use that. This is for special hooks that need a guaranteed id
 	if (hookId >= 0) {
 		_hookId = hookId;
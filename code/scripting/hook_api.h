@@ -8,11 +8,14 @@
 
 #include "utils/tuples.h"
 
+#include <array>
 #include <utility>
 #include <tl/optional.hpp>
 
 namespace scripting {
 
+class HookBase;
+
 namespace detail {
 ade_odata_setter<object_h> convert_arg_type(object* objp);
 ade_odata_setter<vec3d> convert_arg_type(vec3d vec);
@@ -25,35 +28,67 @@ T&& convert_arg_type(T&& arg)
 
 template <typename T>
 struct HookParameterInstance {
-	SCP_string name;
+	const char* name = nullptr;
 	char type = '\0';
 	T value;
 	bool enabled = true;
 
-	HookParameterInstance(SCP_string name_, char type_, T&& value_, bool enabled_)
-		: name(std::move(name_)), type(type_), value(std::forward<T>(value_)), enabled(enabled_)
+	HookParameterInstance(const char* name_, char type_, T&& value_, bool enabled_)
+		: name(name_), type(type_), value(std::forward<T>(value_)), enabled(enabled_)
+	{
+	}
+
+	// Converts the parameter to a Lua value. This is only done if a script actually reads the hook variable.
+	static void pushValue(lua_State* L, void* data)
+	{
+		auto instance = static_cast<HookParameterInstance<T>*>(data);
+
+		char fmt[2] = {instance->type, '\0'};
+		ade_set_args(L, fmt, detail::convert_arg_type(std::move(instance->value)));
+	}
+};
+
+int hook_parameter_id(const HookBase& hook, const char* name);
+
+/**
+ * @brief The ids of the hook variables bound by a single hook invocation
+ *
+ * The number of parameters is known at compile time so this does not need any dynamic memory.
+ */
+template <size_t N>
+struct HookParameterFrame {
+	std::array<int, N> ids;
+	size_t count = 0;
+
+	void removeHookVars()
 	{
+		// Remove in reverse order in case a parameter was (incorrectly) specified twice
+		while (count > 0) {
+			Script_system.RemHookVar(ids[--count]);
+		}
 	}
 };
 
+template <size_t N>
 struct SetSingleHookVarHelper {
-	SCP_vector<SCP_string>& paramNames;
+	const HookBase& hook;
+	HookParameterFrame<N>& frame;
 
-	SetSingleHookVarHelper(SCP_vector<SCP_string>& paramNames_) : paramNames(paramNames_) {}
+	SetSingleHookVarHelper(const HookBase& hook_, HookParameterFrame<N>& frame_) : hook(hook_), frame(frame_) {}
 
 	template <typename T>
-	void operator()(HookParameterInstance<T>&& instance)
+	void operator()(HookParameterInstance<T>& instance)
 	{
 		// If a parameter is not enabled, skip it
-		if (!instance.enabled) {
+		if (!instance.enabled || instance.type == '\0') {
 			return;
 		}
 
-		paramNames.push_back(instance.name);
+		const auto id = hook_parameter_id(hook, instance.name);
 
-		Script_system.SetHookVar(instance.name.c_str(),
-								 instance.type,
-								 detail::convert_arg_type(std::move(instance.value)));
+		// The instance lives until the frame is removed again so the value can be converted later
+		Script_system.SetLazyHookVar(id, &HookParameterInstance<T>::pushValue, &instance);
+		frame.ids[frame.count++] = id;
 	}
 };
 
@@ -66,20 +101,20 @@ struct HookParameterInstanceList {
 	{
 	}
 
-	void setHookVars(SCP_vector<SCP_string>& paramNames)
+	void setHookVars(const HookBase& hook, HookParameterFrame<sizeof...(Args)>& frame)
 	{
-		util::tuples::for_each<0, SetSingleHookVarHelper, HookParameterInstance<Args>...>(
-			std::move(params),
-			SetSingleHookVarHelper(paramNames));
+		util::tuples::for_each<0, SetSingleHookVarHelper<sizeof...(Args)>, HookParameterInstance<Args>...>(
+			params,
+			SetSingleHookVarHelper<sizeof...(Args)>(hook, frame));
 	}
 };
 
 } // namespace detail
 
 template <typename T>
-detail::HookParameterInstance<T> hook_param(SCP_string name_, char type_, T&& value_, bool enabled = true)
+detail::HookParameterInstance<T> hook_param(const char* name_, char type_, T&& value_, bool enabled = true)
 {
-	return detail::HookParameterInstance<T>(std::move(name_), type_, std::forward<T>(value_), enabled);
+	return detail::HookParameterInstance<T>(name_, type_, std::forward<T>(value_), enabled);
 }
 
 template <typename... Args>
@@ -135,12 +170,10 @@ class HookBase {
 	tl::optional<HookDeprecationOptions> _deprecation;
 	int32_t _hookId = 0;
 	
-	bool hasParameter(const SCP_string& param) const
-	{
-		return std::find_if(_parameters.begin(), _parameters.end(), [&param](const HookVariableDocumentation& test) {
-				   return test.name == param;
-			   }) != _parameters.end();
-	}
+	// Interned hook variable ids of the documented parameters
+	SCP_vector<int> _parameterIds;
+
+	friend int detail::hook_parameter_id(const HookBase& hook, const char* name);
 };
 
 template<typename condition_t>
@@ -152,23 +185,12 @@ class HookImpl : public HookBase {
 	template <typename... Args>
 	int run(condition_t condition, detail::HookParameterInstanceList<Args...> argsList = hook_param_list<Args...>()) const
 	{
-		SCP_vector<SCP_string> paramNames;
-		argsList.setHookVars(paramNames);
-
-#ifndef NDEBUG
-		std::for_each(paramNames.begin(), paramNames.end(), [this](const SCP_string& param) {
-			Assertion(this->hasParameter(param),
-				"Hook '%s' does not accept parameter '%s'.",
-				this->_hookName.c_str(),
-				param.c_str());
-			});
-#endif
+		detail::HookParameterFrame<sizeof...(Args)> frame;
+		argsList.setHookVars(*this, frame);
 
 		const auto num_run = Script_system.RunCondition(this->_hookId, linb::any(std::move(condition)));
 
-		for (const auto& param : paramNames) {
-			Script_system.RemHookVar(param.c_str());
-		}
+		frame.removeHookVars();
 
 		return num_run;
 	}
@@ -183,23 +205,12 @@ class HookImpl<void> : public HookBase {
 	template <typename... Args>
 	int run(detail::HookParameterInstanceList<Args...> argsList = hook_param_list<Args...>()) const
 	{
-		SCP_vector<SCP_string> paramNames;
-		argsList.setHookVars(paramNames);
-
-#ifndef NDEBUG
-		std::for_each(paramNames.begin(), paramNames.end(), [this](const SCP_string& param) {
-			Assertion(this->hasParameter(param),
-				"Hook '%s' does not accept parameter '%s'.",
-				this->_hookName.c_str(),
-				param.c_str());
-			});
-#endif
+		detail::HookParameterFrame<sizeof...(Args)> frame;
+		argsList.setHookVars(*this, frame);
 
 		const auto num_run = Script_system.RunCondition(this->_hookId, linb::any{});
 
-		for (const auto& param : paramNames) {
-			Script_system.RemHookVar(param.c_str());
-		}
+		frame.removeHookVars();
 
 		return num_run;
 	}
@@ -239,23 +250,12 @@ class OverridableHookImpl : public Hook<condition_t> {
 	template <typename... Args>
 	bool isOverride(condition_t condition, detail::HookParameterInstanceList<Args...> argsList = hook_param_list<Args...>()) const
 	{
-		SCP_vector<SCP_string> paramNames;
-		argsList.setHookVars(paramNames);
-
-#ifndef NDEBUG
-		std::for_each(paramNames.begin(), paramNames.end(), [this](const SCP_string& param) {
-			Assertion(this->hasParameter(param),
-				"Hook '%s' does not accept parameter '%s'.",
-				this->_hookName.c_str(),
-				param.c_str());
-			});
-#endif
+		detail::HookParameterFrame<sizeof...(Args)> frame;
+		argsList.setHookVars(*this, frame);
 
 		const auto ret_val = Script_system.IsConditionOverride(this->_hookId, linb::any(std::move(condition)));
 
-		for (const auto& param : paramNames) {
-			Script_system.RemHookVar(param.c_str());
-		}
+		frame.removeHookVars();
 
 		return ret_val;
 	}
@@ -270,23 +270,12 @@ protected:
 	template <typename... Args>
 	bool isOverride(detail::HookParameterInstanceList<Args...> argsList = hook_param_list<Args...>()) const
 	{
-		SCP_vector<SCP_string> paramNames;
-		argsList.setHookVars(paramNames);
-
-#ifndef NDEBUG
-		std::for_each(paramNames.begin(), paramNames.end(), [this](const SCP_string& param) {
-			Assertion(this->hasParameter(param),
-				"Hook '%s' does not accept parameter '%s'.",
-				this->_hookName.c_str(),
-				param.c_str());
-			});
-#endif
+		detail::HookParameterFrame<sizeof...(Args)> frame;
+		argsList.setHookVars(*this, frame);
 
 		const auto ret_val = Script_system.IsConditionOverride(this->_hookId, linb::any{});
 
-		for (const auto& param : paramNames) {
-			Script_system.RemHookVar(param.c_str());
-		}
+		frame.removeHookVars();
 
 		return ret_val;
 	}
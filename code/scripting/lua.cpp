@@ -3,6 +3,7 @@
 
 #include "scripting_doc.h"
 
+#include "scripting/script_profiler.h"
 #include "scripting/lua/LuaUtil.h"
 
 extern "C" {
@@ -94,7 +95,7 @@ const char* ScriptStateReferenceName = "SCP_ScriptState";
 
 // *************************Housekeeping*************************
 
-static void *vm_lua_alloc(void*, void *ptr, size_t, size_t nsize) {
+static void *vm_lua_alloc(void*, void *ptr, size_t osize, size_t nsize) {
 	if (nsize == 0)
 	{
 		vm_free(ptr);
@@ -102,6 +103,9 @@ static void *vm_lua_alloc(void*, void *ptr, size_t, size_t nsize) {
 	}
 	else
 	{
+		if (nsize > osize) {
+			profiler::record_allocation(nsize - osize);
+		}
 		return vm_realloc(ptr, nsize);
 	}
 }
@@ -0,0 +1,387 @@
+#include "scripting/script_profiler.h"
+
+#include "debugconsole/console.h"
+#include "parse/parselo.h"
+#include "scripting/hook_api.h"
+#include "scripting/scripting.h"
+
+extern "C" {
+#include <lua.h>
+}
+
+namespace scripting {
+namespace profiler {
+
+namespace {
+
+struct profile_counters {
+	std::uint64_t calls       = 0;
+	std::uint64_t time        = 0;
+	std::uint64_t self_time   = 0;
+	std::uint64_t allocations = 0;
+	std::uint64_t bytes       = 0;
+};
+
+struct function_profile {
+	SCP_string source;
+	int line = -1;
+
+	SCP_string name;
+	profile_counters counters;
+};
+
+// Identifies a function by the contents of its source string so that functions are not mixed up if Lua reuses the
+// memory of a collected string
+struct function_key {
+	const char* source;
+	int line;
+};
+
+struct function_key_hash {
+	size_t operator()(const function_key& key) const
+	{
+		// FNV-1a
+		size_t hash = 2166136261u;
+		for (auto c = key.source; *c != '\0'; ++c) {
+			hash = (hash ^ static_cast<unsigned char>(*c)) * 16777619u;
+		}
+		return hash ^ static_cast<size_t>(key.line);
+	}
+};
+
+struct function_key_equal {
+	bool operator()(const function_key& lhs, const function_key& rhs) const
+	{
+		return lhs.line == rhs.line && strcmp(lhs.source, rhs.source) == 0;
+	}
+};
+
+struct call_frame {
+	function_profile* function;
+
+	std::uint64_t start;
+	std::uint64_t child_time;
+	std::uint64_t start_allocs;
+	std::uint64_t start_bytes;
+};
+
+lua_State* Profiled_state = nullptr;
+
+// Owns the function profiles. The keys of the lookup map point into the strings of these profiles.
+SCP_vector<std::unique_ptr<function_profile>> Functions;
+SCP_unordered_map<function_key, function_profile*, function_key_hash, function_key_equal> Function_lookup;
+
+// Every coroutine has its own call stack
+SCP_unordered_map<lua_State*, SCP_vector<call_frame>> Call_stacks;
+
+function_profile* get_function_profile(const lua_Debug& ar)
+{
+	function_key key;
+	if (ar.what != nullptr && !strcmp(ar.what, "C")) {
+		// All C functions have the same source so use the name they were called with instead
+		key.source = ar.name != nullptr ? ar.name : "?";
+		key.line   = -1;
+	} else {
+		key.source = ar.source;
+		key.line   = ar.linedefined;
+	}
+
+	const auto iter = Function_lookup.find(key);
+	if (iter != Function_lookup.end()) {
+		return iter->second;
+	}
+
+	std::unique_ptr<function_profile> profile(new function_profile());
+	profile->source = key.source;
+	profile->line   = key.line;
+
+	if (key.line < 0) {
+		sprintf(profile->name, "[C] %s", key.source);
+	} else if (key.line == 0) {
+		sprintf(profile->name, "%s (main chunk)", ar.short_src);
+	} else {
+		sprintf(profile->name, "%s:%d", ar.short_src, key.line);
+	}
+
+	auto profilePtr = profile.get();
+	Function_lookup.emplace(function_key{profilePtr->source.c_str(), profilePtr->line}, profilePtr);
+	Functions.push_back(std::move(profile));
+
+	return profilePtr;
+}
+
+void finish_frame(SCP_vector<call_frame>& stack, std::uint64_t now)
+{
+	const auto frame = stack.back();
+	stack.pop_back();
+
+	const auto elapsed = now - frame.start;
+
+	auto& counters = frame.function->counters;
+	++counters.calls;
+	counters.time += elapsed;
+	counters.self_time += elapsed - std::min(elapsed, frame.child_time);
+	counters.allocations += detail::allocations - frame.start_allocs;
+	counters.bytes += detail::allocated_bytes - frame.start_bytes;
+
+	if (!stack.empty()) {
+		stack.back().child_time += elapsed;
+	}
+}
+
+void profile_hook(lua_State* L, lua_Debug* ar)
+{
+	auto& stack = Call_stacks[L];
+
+	if (ar->event == LUA_HOOKCALL) {
+		lua_getinfo(L, "Sn", ar);
+
+		call_frame frame;
+		frame.function     = get_function_profile(*ar);
+		frame.child_time   = 0;
+		frame.start_allocs = detail::allocations;
+		frame.start_bytes  = detail::allocated_bytes;
+		// Read the time last so that the lookup above is not attributed to the function
+		frame.start = timer_get_nanoseconds();
+
+		stack.push_back(frame);
+	} else if (ar->event == LUA_HOOKRET || ar->event == LUA_HOOKTAILRET) {
+		if (stack.empty()) {
+			// The function was called before the profiler was started
+			return;
+		}
+
+		finish_frame(stack, timer_get_nanoseconds());
+	}
+}
+
+} // namespace
+
+namespace detail {
+bool enabled = false;
+
+std::uint64_t allocations     = 0;
+std::uint64_t allocated_bytes = 0;
+
+struct hook_profile {
+	SCP_string name;
+	// Trace events keep a pointer to their category so this may never be freed
+	std::unique_ptr<tracing::Category> category;
+
+	profile_counters counters;
+	std::uint64_t conditions_time = 0;
+};
+} // namespace detail
+
+namespace {
+SCP_unordered_map<int, detail::hook_profile> Hooks;
+
+detail::hook_profile* get_hook_profile(int hookId)
+{
+	auto iter = Hooks.find(hookId);
+	if (iter != Hooks.end()) {
+		return &iter->second;
+	}
+
+	auto& hook = Hooks[hookId];
+
+	for (const auto& hookBase : getHooks()) {
+		if (hookBase->getHookId() == hookId) {
+			hook.name = hookBase->getHookName();
+			break;
+		}
+	}
+	if (hook.name.empty()) {
+		sprintf(hook.name, "Hook %d", hookId);
+	}
+
+	hook.category.reset(new tracing::Category(("Lua: " + hook.name).c_str(), false));
+
+	return &hook;
+}
+
+void print_line(bool print_to_console, const SCP_string& line)
+{
+	mprintf(("%s\n", line.c_str()));
+
+	if (print_to_console) {
+		dc_printf("%s\n", line.c_str());
+	}
+}
+
+double to_ms(std::uint64_t ns) { return ns / 1000000.0; }
+
+double to_kib(std::uint64_t bytes) { return bytes / 1024.0; }
+
+} // namespace
+
+void start(lua_State* L)
+{
+	if (detail::enabled) {
+		if (Profiled_state == L) {
+			return;
+		}
+		stop(Profiled_state);
+	}
+
+	mprintf(("SCRIPTING: Starting Lua profiler\n"));
+
+	detail::enabled = true;
+	Profiled_state  = L;
+
+	lua_sethook(L, profile_hook, LUA_MASKCALL | LUA_MASKRET, 0);
+}
+
+bool is_profiling(lua_State* L) { return detail::enabled && L != nullptr && Profiled_state == L; }
+
+void stop(lua_State* L)
+{
+	if (!is_profiling(L)) {
+		return;
+	}
+
+	mprintf(("SCRIPTING: Stopping Lua profiler\n"));
+
+	lua_sethook(L, nullptr, 0, 0);
+
+	detail::enabled = false;
+	Profiled_state  = nullptr;
+
+	// Any unfinished calls can't be attributed properly anymore
+	Call_stacks.clear();
+}
+
+void reset()
+{
+	// Hooks keep their entries since their categories may still be referenced by trace events
+	for (auto& pair : Hooks) {
+		pair.second.counters        = profile_counters();
+		pair.second.conditions_time = 0;
+	}
+
+	Call_stacks.clear();
+	Function_lookup.clear();
+	Functions.clear();
+}
+
+void dump(bool print_to_console)
+{
+	SCP_vector<const detail::hook_profile*> hooks;
+	for (const auto& pair : Hooks) {
+		if (pair.second.counters.calls > 0) {
+			hooks.push_back(&pair.second);
+		}
+	}
+	std::sort(hooks.begin(), hooks.end(), [](const detail::hook_profile* lhs, const detail::hook_profile* rhs) {
+		return lhs->counters.time > rhs->counters.time;
+	});
+
+	SCP_vector<const function_profile*> functions;
+	for (const auto& function : Functions) {
+		if (function->counters.calls > 0) {
+			functions.push_back(function.get());
+		}
+	}
+	std::sort(functions.begin(), functions.end(), [](const function_profile* lhs, const function_profile* rhs) {
+		return lhs->counters.self_time > rhs->counters.self_time;
+	});
+
+	SCP_string line;
+
+	sprintf(line, "Lua profile: " SIZE_T_ARG " hooks, " SIZE_T_ARG " functions", hooks.size(), functions.size());
+	print_line(print_to_console, line);
+
+	sprintf(line, "%-40s %10s %12s %10s %12s %10s %12s", "Hook", "Calls", "Total (ms)", "Avg (us)", "Cond. (ms)",
+		"Allocs", "Alloc (KiB)");
+	print_line(print_to_console, line);
+
+	for (const auto hook : hooks) {
+		const auto& counters = hook->counters;
+		sprintf(line, "%-40s %10" PRIu64 " %12.3f %10.2f %12.3f %10" PRIu64 " %12.1f", hook->name.c_str(),
+			counters.calls, to_ms(counters.time), counters.time / 1000.0 / counters.calls,
+			to_ms(hook->conditions_time), counters.allocations, to_kib(counters.bytes));
+		print_line(print_to_console, line);
+	}
+
+	print_line(print_to_console, "");
+
+	sprintf(line, "%-60s %10s %12s %12s %10s %12s", "Function", "Calls", "Total (ms)", "Self (ms)", "Allocs",
+		"Alloc (KiB)");
+	print_line(print_to_console, line);
+
+	for (const auto function : functions) {
+		const auto& counters = function->counters;
+		sprintf(line, "%-60s %10" PRIu64 " %12.3f %12.3f %10" PRIu64 " %12.1f", function->name.c_str(),
+			counters.calls, to_ms(counters.time), to_ms(counters.self_time), counters.allocations,
+			to_kib(counters.bytes));
+		print_line(print_to_console, line);
+	}
+}
+
+void ScopedHookProfile::begin(int hookId)
+{
+	_hook = get_hook_profile(hookId);
+
+	auto& stack = Call_stacks[Profiled_state];
+	_callDepth  = stack.size();
+
+	tracing::complete::start(*_hook->category, &_evt);
+
+	_startAllocs = detail::allocations;
+	_startBytes  = detail::allocated_bytes;
+	_start       = timer_get_nanoseconds();
+}
+
+void ScopedHookProfile::end()
+{
+	const auto now = timer_get_nanoseconds();
+
+	auto& counters = _hook->counters;
+	++counters.calls;
+	counters.time += now - _start;
+	counters.allocations += detail::allocations - _startAllocs;
+	counters.bytes += detail::allocated_bytes - _startBytes;
+
+	// Lua does not call the return hook if a function exits because of an error so those calls need to be finished
+	// here or else the stack would grow indefinitely
+	if (detail::enabled) {
+		auto& stack = Call_stacks[Profiled_state];
+		while (stack.size() > _callDepth) {
+			finish_frame(stack, now);
+		}
+	}
+
+	tracing::complete::end(&_evt);
+}
+
+void ScopedHookProfile::addConditionsTime(std::uint64_t time) { _hook->conditions_time += time; }
+
+} // namespace profiler
+} // namespace scripting
+
+DCF(lua_profile, "Controls the Lua script profiler")
+{
+	if (dc_optional_string_either("help", "--help")) {
+		dc_printf("Usage: lua_profile [arg]\nWhere arg can be any of the following:\n");
+		dc_printf("\ton       Starts profiling Lua hooks and functions.\n");
+		dc_printf("\toff      Stops profiling. The collected data is kept.\n");
+		dc_printf("\tdump     Prints the collected data to the console and the log.\n");
+		dc_printf("\treset    Discards the collected data.\n");
+		return;
+	}
+
+	if (dc_optional_string("on")) {
+		scripting::profiler::start(Script_system.GetLuaSession());
+		dc_printf("Lua profiler started\n");
+	} else if (dc_optional_string("off")) {
+		scripting::profiler::stop(Script_system.GetLuaSession());
+		dc_printf("Lua profiler stopped\n");
+	} else if (dc_optional_string("dump")) {
+		scripting::profiler::dump(true);
+	} else if (dc_optional_string("reset")) {
+		scripting::profiler::reset();
+		dc_printf("Lua profiler data discarded\n");
+	} else {
+		dc_printf("Lua profiler is %s\n", scripting::profiler::is_enabled() ? "running" : "stopped");
+	}
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "globalincs/pstypes.h"
+
+#include "io/timer.h"
+#include "tracing/tracing.h"
+
+struct lua_State;
+
+/** @file
+ *  @ingroup scripting
+ *
+ *  An instrumented profiler for the Lua scripting system. When enabled, it attributes wall time and Lua allocations to
+ *  the scripting hooks (including the time spent checking their conditions) and to every Lua function that is called.
+ *  Hooks also show up as their own categories in the tracing output.
+ *
+ *  The profiler can be enabled with the -profile_scripts command line option or with the "lua_profile" debug console
+ *  command. If it is disabled, the only cost is a single check of a global flag per hook call and Lua allocation.
+ */
+
+namespace scripting {
+namespace profiler {
+
+namespace detail {
+extern bool enabled;
+
+extern std::uint64_t allocations;
+extern std::uint64_t allocated_bytes;
+
+struct hook_profile;
+} // namespace detail
+
+inline bool is_enabled() { return detail::enabled; }
+
+/**
+ * @brief Called by the Lua allocator whenever a new block of memory is allocated
+ * @param size The size of the new block
+ */
+inline void record_allocation(size_t size)
+{
+	if (detail::enabled) {
+		++detail::allocations;
+		detail::allocated_bytes += size;
+	}
+}
+
+/**
+ * @brief Starts profiling the specified Lua state
+ */
+void start(lua_State* L);
+
+/**
+ * @brief Checks if the specified Lua state is being profiled
+ */
+bool is_profiling(lua_State* L);
+
+/**
+ * @brief Stops profiling. The collected data is kept until reset() is called.
+ */
+void stop(lua_State* L);
+
+/**
+ * @brief Discards all collected data
+ */
+void reset();
+
+/**
+ * @brief Writes a summary of the collected data to the log
+ * @param print_to_console If @c true, the summary is also printed to the debug console
+ */
+void dump(bool print_to_console = false);
+
+/**
+ * @brief Attributes the time of a scope to a scripting hook
+ */
+class ScopedHookProfile {
+	detail::hook_profile* _hook = nullptr;
+
+	std::uint64_t _start           = 0;
+	std::uint64_t _startAllocs     = 0;
+	std::uint64_t _startBytes      = 0;
+	std::uint64_t _conditionsStart = 0;
+	size_t _callDepth              = 0;
+
+	tracing::trace_event _evt;
+
+	void begin(int hookId);
+	void end();
+
+  public:
+	explicit ScopedHookProfile(int hookId)
+	{
+		if (detail::enabled) {
+			begin(hookId);
+		}
+	}
+	~ScopedHookProfile()
+	{
+		if (_hook != nullptr) {
+			end();
+		}
+	}
+
+	ScopedHookProfile(const ScopedHookProfile&) = delete;
+	ScopedHookProfile& operator=(const ScopedHookProfile&) = delete;
+
+	/**
+	 * @brief Marks the start of a condition check of this hook
+	 */
+	void beginConditions()
+	{
+		if (_hook != nullptr) {
+			_conditionsStart = timer_get_nanoseconds();
+		}
+	}
+
+	/**
+	 * @brief Marks the end of a condition check of this hook
+	 */
+	void endConditions()
+	{
+		if (_hook != nullptr) {
+			addConditionsTime(timer_get_nanoseconds() - _conditionsStart);
+		}
+	}
+
+  private:
+	void addConditionsTime(std::uint64_t time);
+};
+
+} // namespace profiler
+} // namespace scripting
@@ -9,6 +9,7 @@
 #include "hook_api.h"
 
 #include "bmpman/bmpman.h"
+#include "cmdline/cmdline.h"
 #include "controlconfig/controlsconfig.h"
 #include "gamesequence/gamesequence.h"
 #include "hud/hud.h"
@@ -19,6 +20,7 @@
 #include "scripting/doc_html.h"
 #include "scripting/doc_json.h"
 #include "scripting/global_hooks.h"
+#include "scripting/script_profiler.h"
 #include "scripting/scripting_doc.h"
 #include "ship/ship.h"
 #include "tracing/tracing.h"
@@ -151,6 +153,10 @@ void script_init()
 	mprintf(("SCRIPTING: Beginning Lua initialization...\n"));
 	Script_system.CreateLuaState();
 
+	if (Cmdline_profile_scripts) {
+		profiler::start(Script_system.GetLuaSession());
+	}
+
 	if (Output_scripting_meta || Output_scripting_json) {
 		const auto doc = Script_system.OutputDocumentation([](const SCP_string& error) {
 			mprintf(("Scripting documentation: Error while parsing\n%s(This is only relevant for coders)\n\n",
@@ -337,36 +343,130 @@ void script_state::SetHookObjects(int num, ...)
 		char* name = va_arg(vl, char*);
 		object* objp = va_arg(vl, object*);
 
+		HookVariableValue val;
 		ade_set_object_with_breed(LuaState, OBJ_INDEX(objp));
-		auto reference = luacpp::UniqueLuaReference::create(LuaState);
+		val.reference = luacpp::UniqueLuaReference::create(LuaState);
 		lua_pop(LuaState, 1); // Remove object value from the stack
 
-		HookVariableValues[name].push_back(std::move(reference));
+		GetHookVariableStack(GetHookVariableId(name)).push_back(std::move(val));
 	}
 
 	va_end(vl);
 }
 
+namespace {
+struct hook_variable_registry {
+	SCP_vector<SCP_string> names;
+	SCP_unordered_map<SCP_string, int> ids;
+};
+
+// Hooks intern their parameter names during static initialization so this can't be a normal global
+hook_variable_registry& get_hook_variable_registry()
+{
+	static hook_variable_registry registry;
+	return registry;
+}
+
+int find_hook_variable_id(const char* name)
+{
+	const auto& ids = get_hook_variable_registry().ids;
+
+	const auto iter = ids.find(name);
+	return iter != ids.end() ? iter->second : -1;
+}
+} // namespace
+
 void script_state::RemHookVar(const char* name)
 {
 	this->RemHookVars({name});
 }
 
-void script_state::RemHookVars(std::initializer_list<SCP_string> names)
+void script_state::RemHookVars(std::initializer_list<const char*> names)
 {
-	if (LuaState != nullptr) {
-		for (const auto& hookVar : names) {
-			if (HookVariableValues[hookVar].empty()) {
-				// Nothing to do
-				continue;
-			}
-			HookVariableValues[hookVar].pop_back();
-		}
+	for (const auto& hookVar : names) {
+		RemHookVar(find_hook_variable_id(hookVar));
+	}
+}
+
+void script_state::SetLazyHookVar(int id, HookVariablePusher pusher, void* data)
+{
+	Assertion(pusher != nullptr, "A lazy hook variable needs a value pusher!");
+
+	if (LuaState == nullptr) {
+		return;
+	}
+
+	HookVariableValue val;
+	val.pusher = pusher;
+	val.data   = data;
+
+	GetHookVariableStack(id).push_back(std::move(val));
+}
+
+void script_state::RemHookVar(int id)
+{
+	if (!IsHookVarSet(id)) {
+		// Nothing to do
+		return;
 	}
+
+	HookVariableValues[id].pop_back();
 }
-const SCP_unordered_map<SCP_string, SCP_vector<luacpp::LuaReference>>& script_state::GetHookVariableReferences()
+
+bool script_state::PushHookVar(lua_State* L, const char* name)
 {
-	return HookVariableValues;
+	// Do not intern the name here since scripts may read arbitrary variable names
+	const auto id = find_hook_variable_id(name);
+	if (!IsHookVarSet(id)) {
+		return false;
+	}
+
+	// Use the value on top of the stack
+	auto& val = HookVariableValues[id].back();
+	if (val.reference == nullptr) {
+		// This is the first time a script needs this value so it has to be converted now. The reference keeps the value
+		// alive in case another script reads the variable while the hook is still running.
+		val.pusher(L, val.data);
+		val.reference = luacpp::UniqueLuaReference::create(L);
+		val.pusher    = nullptr;
+		val.data      = nullptr;
+		return true;
+	}
+
+	val.reference->pushValue(L);
+	return true;
+}
+
+bool script_state::IsHookVarSet(int id) const
+{
+	return id >= 0 && id < (int)HookVariableValues.size() && !HookVariableValues[id].empty();
+}
+
+SCP_vector<HookVariableValue>& script_state::GetHookVariableStack(int id)
+{
+	if (id >= (int)HookVariableValues.size()) {
+		HookVariableValues.resize(id + 1);
+	}
+	return HookVariableValues[id];
+}
+
+int script_state::GetHookVariableId(const char* name)
+{
+	auto id = find_hook_variable_id(name);
+	if (id >= 0) {
+		return id;
+	}
+
+	auto& registry = get_hook_variable_registry();
+	id = (int)registry.names.size();
+	registry.names.emplace_back(name);
+	registry.ids.emplace(name, id);
+	return id;
+}
+
+const SCP_vector<SCP_string>& script_state::GetHookVariableNames()
+{
+	return get_hook_variable_registry().names;
 }
 
 int script_state::LoadBm(const char* name)
@@ -412,9 +512,15 @@ int script_state::RunCondition(int action_type, linb::any local_condition_data)
 	if (action_it == ConditionalHooks.end())
 		return num;
 
+	profiler::ScopedHookProfile hookProfile(action_type);
+
 	for(const auto& action : action_it->second) 
 	{
-		if (action.ConditionsValid(local_condition_data))
+		hookProfile.beginConditions();
+		const auto valid = action.ConditionsValid(local_condition_data);
+		hookProfile.endConditions();
+
+		if (valid)
 		{
 			RunBytecode(action.hook.hook_function);
 			num++;
@@ -431,9 +537,15 @@ bool script_state::IsConditionOverride(int action_type, linb::any local_conditio
 	if (action_it == ConditionalHooks.end())
 		return false;
 
+	profiler::ScopedHookProfile hookProfile(action_type);
+
 	for (const auto& action : action_it->second)
 	{
-		if (action.ConditionsValid(local_condition_data))
+		hookProfile.beginConditions();
+		const auto valid = action.ConditionsValid(local_condition_data);
+		hookProfile.endConditions();
+
+		if (valid)
 		{
 			if (IsOverride(action.hook))
 				return true;
@@ -451,6 +563,12 @@ void script_state::Clear()
 	AssayActions();
 
 	if (LuaState != nullptr) {
+		if (profiler::is_profiling(LuaState)) {
+			// The state is cleared when the game shuts down so this is the last chance to get the profile
+			profiler::dump();
+			profiler::stop(LuaState);
+		}
+
 		OnStateDestroy(LuaState);
 
 		lua_close(LuaState);
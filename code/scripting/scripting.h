@@ -114,6 +114,18 @@ public:
 	bool ConditionsValid(const linb::any& local_condition_data) const;
 };
 
+using HookVariablePusher = void (*)(lua_State* L, void* data);
+
+// A single value of a hook variable. Either holds a reference to the Lua value or a function which creates the Lua
+// value when a script reads the variable for the first time. Uses a raw reference since we do not need the more
+// advanced features of LuaValue
+struct HookVariableValue {
+	luacpp::LuaReference reference;
+
+	HookVariablePusher pusher = nullptr;
+	void* data = nullptr;
+};
+
 //**********Main script_state function
 class script_state
 {
@@ -133,16 +145,19 @@ class script_state
 
 	SCP_vector<script_function> GameInitFunctions;
 
-	// Stores references to the Lua values for the hook variables. Uses a raw reference since we do not need the more
-	// advanced features of LuaValue
-	// values are a vector to provide a stack of values. This is necessary to ensure consistent behavior if a scripting
-	// hook is called from within another script (e.g. calls to createShip)
-	SCP_unordered_map<SCP_string, SCP_vector<luacpp::LuaReference>> HookVariableValues;
+	// Stores the values for the hook variables, indexed by the interned id of the variable name (see
+	// GetHookVariableId). Values are a vector to provide a stack of values. This is necessary to ensure consistent
+	// behavior if a scripting hook is called from within another script (e.g. calls to createShip)
+	// The inner vectors keep their capacity when values are removed so binding hook variables does not allocate once
+	// a hook has been called a few times.
+	SCP_vector<SCP_vector<HookVariableValue>> HookVariableValues;
 
 	// ActiveActions lets code that might run scripting hooks know whether any scripts are even registered for it.
 	// AssayActions is responsible for keeping it up to date.
 	SCP_unordered_map<int, bool> ActiveActions;
 
+	SCP_vector<HookVariableValue>& GetHookVariableStack(int id);
+
 	void ParseChunkSub(script_function& out_func, const char* debug_str=NULL);
 
 	void SetLuaSession(struct lua_State *L);
@@ -184,9 +199,35 @@ public:
 	void SetHookObject(const char *name, object *objp);
 	void SetHookObjects(int num, ...);
 	void RemHookVar(const char *name);
-	void RemHookVars(std::initializer_list<SCP_string> names);
+	void RemHookVars(std::initializer_list<const char*> names);
 
-	const SCP_unordered_map<SCP_string, SCP_vector<luacpp::LuaReference>>& GetHookVariableReferences();
+	/**
+	 * @brief Binds a hook variable without converting it to a Lua value
+	 *
+	 * The value is only pushed to Lua (by calling @c pusher with @c data) if a script actually reads the variable. The
+	 * caller must ensure that @c data stays valid until the variable is removed again with RemHookVar.
+	 *
+	 * @param id The interned id of the variable name
+	 * @param pusher The function which pushes the Lua value of the variable
+	 * @param data The data passed to @c pusher
+	 */
+	void SetLazyHookVar(int id, HookVariablePusher pusher, void* data);
+	void RemHookVar(int id);
+
+	/**
+	 * @brief Pushes the current value of a hook variable onto the Lua stack
+	 * @return @c true if the variable is set and a value was pushed, @c false otherwise
+	 */
+	bool PushHookVar(lua_State* L, const char* name);
+	bool IsHookVarSet(int id) const;
+
+	/**
+	 * @brief Gets the interned id of a hook variable name
+	 *
+	 * Ids are shared by all script states and stay valid for the lifetime of the program.
+	 */
+	static int GetHookVariableId(const char* name);
+	static const SCP_vector<SCP_string>& GetHookVariableNames();
 
 	//***Hook creation functions
 	template <typename T>
@@ -229,10 +270,11 @@ void script_state::SetHookVar(const char *name, char format, T&& value)
 	{
 		char fmt[2] = {format, '\0'};
 		::scripting::ade_set_args(LuaState, fmt, std::forward<T>(value));
-		auto reference = luacpp::UniqueLuaReference::create(LuaState);
+		HookVariableValue val;
+		val.reference = luacpp::UniqueLuaReference::create(LuaState);
 		lua_pop(LuaState, 1); // Remove object value from the stack
 
-		HookVariableValues[name].push_back(std::move(reference));
+		GetHookVariableStack(GetHookVariableId(name)).push_back(std::move(val));
 	}
 }
 
@@ -47,6 +47,7 @@
 #include "math/staticrand.h"
 #include "math/vecmat.h"
 #include "mission/missioncampaign.h"
+#include "mission/missioncue.h"
 #include "mission/missionlog.h"
 #include "mission/missionmessage.h"
 #include "missionui/missionshipchoice.h"
@@ -86,6 +87,7 @@
 #include "tracing/Monitor.h"
 #include "tracing/tracing.h"
 #include "utils/Random.h"
+#include "utils/run_arena.h"
 #include "weapon/beam.h"
 #include "weapon/corkscrew.h"
 #include "weapon/emp.h"
@@ -107,11 +109,10 @@ using namespace Ship;
 												//    have warped in.   So I put code in the paging code which knows all ships
 												//    that will warp in.
 
-static int Num_ship_subsystems = 0;
-static int Num_ship_subsystems_allocated = 0;
-
-static SCP_vector<ship_subsys*> Ship_subsystems;
-ship_subsys ship_subsys_free_list;
+// Every ship gets its subsystems as one run of consecutive elements so walking the subsystem list
+// does not jump around in memory.  The runs live until the end of the mission and the runs of
+// destroyed ships are reused by new ships of the same class.
+static util::run_arena<ship_subsys, NUM_SHIP_SUBSYSTEMS_PER_SET> Ship_subsystems;
 
 extern bool splodeing;
 extern float splode_level;
@@ -6088,7 +6089,7 @@ void ship_init()
 		}
 
 		// We shouldn't already have any subsystem pointers at this point.
-		Assertion(Ship_subsystems.empty(), "Some pre-allocated subsystems didn't get cleared out: " SIZE_T_ARG " batches present during ship_init(); get a coder!\n", Ship_subsystems.size());
+		Assertion(Ship_subsystems.allocated() == 0, "Some pre-allocated subsystems didn't get cleared out: %d subsystems present during ship_init(); get a coder!\n", Ship_subsystems.allocated());
 	}
 }
 
@@ -6096,63 +6097,19 @@ static int Man_thruster_reset_timestamp = 0;
 
 static void ship_clear_subsystems()
 {
-	for (auto it = Ship_subsystems.begin(); it != Ship_subsystems.end(); ++it) {
-		delete[] *it;
-	}
 	Ship_subsystems.clear();
-
-	Num_ship_subsystems = 0;
-	Num_ship_subsystems_allocated = 0;
 }
 
-static int ship_allocate_subsystems(int num_so, bool page_in = false)
+/**
+ * Makes sure the subsystems of ships which will arrive later end up in one block of memory
+ */
+static void ship_reserve_subsystems(int num_so)
 {
-	int i;
-	int num_subsystems_save = 0;
-
-	// "0" itself is safe
-	if (num_so < 0) {
-		Int3();
-		return 0;
-	}
-
-	// allow a page-in thingy, so that we can grab as much as possible before mission
-	// start, but without messing up our count for future things
-	if (page_in)
-		num_subsystems_save = Num_ship_subsystems;
-
-	Num_ship_subsystems += num_so;
+	Assertion(num_so >= 0, "Cannot reserve %d subsystems!", num_so);
 
-	// bail if we don't actually need any more
-	if ( Num_ship_subsystems < Num_ship_subsystems_allocated )
-		return 1;
-
-	mprintf(("Allocating space for at least %i new ship subsystems ... ", num_so));
-
-	// we might need more than one set worth of new subsystems, so make as many as required
-	do {
-		ship_subsys* new_batch = new ship_subsys[NUM_SHIP_SUBSYSTEMS_PER_SET];
-		Ship_subsystems.push_back(new_batch);
-
-		// append the new set to our free list
-		for (i = 0; i < NUM_SHIP_SUBSYSTEMS_PER_SET; i++)
-			list_append( &ship_subsys_free_list, &new_batch[i] );
-
-		Num_ship_subsystems_allocated += NUM_SHIP_SUBSYSTEMS_PER_SET;
-	} while ( (Num_ship_subsystems - Num_ship_subsystems_allocated) > 0 );
-
-	if (page_in)
-		Num_ship_subsystems = num_subsystems_save;
-
-	// because the Ship_subsystems vector changed, it might have moved in memory, so invalidate all the subsystem caches
-	for (auto so : list_range(&Ship_obj_list))
-	{
-		// don't skip should-be-dead ships for this flag removal
-		Ships[Objects[so->objnum].instance].flags.remove(Ship::Ship_Flags::Subsystem_cache_valid);
-	}
-
-	mprintf(("a total of %i is now available (%i in-use).\n", Num_ship_subsystems_allocated, Num_ship_subsystems));
-	return 1;
+	mprintf(("Reserving space for %i ship subsystems ... ", num_so));
+	Ship_subsystems.reserve(num_so);
+	mprintf(("a total of %i is now available (%i in-use).\n", Ship_subsystems.allocated(), Ship_subsystems.in_use()));
 }
 
 /**
@@ -6209,7 +6166,6 @@ void ship_level_init()
 
 	// Empty the subsys list
 	ship_clear_subsystems();
-	list_init( &ship_subsys_free_list );
 
 	Laser_energy_out_snd_timer = 1;
 	Missile_out_snd_timer		= 1;
@@ -6563,11 +6519,13 @@ void ship::clear()
 	orders_accepted.clear();
 	orders_allowed_against.clear();
 
-	subsys_list_indexer.reset();
 	subsys_list.clear();
 	// since these aren't cleared by clear()
 	subsys_list.next = NULL;
 	subsys_list.prev = NULL;
+	subsys_storage = nullptr;
+	subsys_storage_size = 0;
+	num_subsys_linked = 0;
 
 	memset(&subsys_info, 0, SUBSYSTEM_MAX * sizeof(ship_subsys_info));
 
@@ -6995,7 +6953,7 @@ static void ship_set(int ship_index, int objnum, int ship_type)
 	if (!subsys_set(objnum))
 	{
 		char err_msg[512]; 
-		sprintf (err_msg, "Unable to allocate ship subsystems, which shouldn't be possible anymore. Current allocation is %d (%d in use). No subsystems have been assigned to %s.", Num_ship_subsystems_allocated, Num_ship_subsystems, shipp->ship_name);
+		sprintf (err_msg, "Unable to allocate ship subsystems, which shouldn't be possible anymore. Current allocation is %d (%d in use). No subsystems have been assigned to %s.", Ship_subsystems.allocated(), Ship_subsystems.in_use(), shipp->ship_name);
 
 		if (Fred_running) 
 			os::dialogs::Message(os::dialogs::MESSAGEBOX_ERROR, err_msg);
@@ -7378,11 +7336,14 @@ static int subsys_set(int objnum, int ignore_subsys_info)
 	// set up the subsystems for this ship.  walk through list of subsystems in the ship-info array.
 	// for each subsystem, get a new ship_subsys instance and set up the pointers and other values
 	list_init ( &shipp->subsys_list );								// initialize the ship's list of subsystems
-	shipp->subsys_list_indexer.reset();
-	shipp->flags.remove(Ship::Ship_Flags::Subsystem_cache_valid);
 
-	// make sure to have allocated the number of subsystems we require
-	if (!ship_allocate_subsystems( sinfo->n_subsystems )) {
+	// get one consecutive run of subsystems for the whole ship
+	Assertion(shipp->subsys_storage == nullptr, "Subsystems of ship %s were not deleted before setting them up again!", shipp->ship_name);
+	shipp->subsys_storage = Ship_subsystems.allocate( sinfo->n_subsystems );
+	shipp->subsys_storage_size = sinfo->n_subsystems;
+	shipp->num_subsys_linked = 0;
+
+	if (shipp->subsys_storage == nullptr && sinfo->n_subsystems > 0) {
 		return 0;
 	}
 
@@ -7401,12 +7362,12 @@ static int subsys_set(int objnum, int ignore_subsys_info)
 			continue;
 		}
 
-		// set up the linked list
-		ship_system = GET_FIRST( &ship_subsys_free_list );		// get a new element from the ship_subsystem array
-		Assert ( ship_system != &ship_subsys_free_list );		// shouldn't have the dummy element
-		list_remove( ship_subsys_free_list, ship_system );		// remove the element from the array
+		// set up the linked list; subsystems are linked in the order of the storage, so the index
+		// of a subsystem is also its position in the storage
+		ship_system = &shipp->subsys_storage[shipp->num_subsys_linked];
 		list_append( &shipp->subsys_list, ship_system );		// link the element into the ship
 		ship_system->clear();									// initialize it to a known blank slate
+		ship_system->parent_subsys_index = shipp->num_subsys_linked++;
 
 		ship_system->system_info = model_system;				// set the system_info pointer to point to the data read in from the model
 		ship_system->parent_objnum = objnum;
@@ -8144,22 +8105,13 @@ void ship_end_render_cockpit_display(size_t cockpit_display_num)
 
 static void ship_subsystems_delete(ship *shipp)
 {
-	if ( NOT_EMPTY(&shipp->subsys_list) )
-	{
-		ship_subsys *systemp, *temp;
-
-		systemp = GET_FIRST( &shipp->subsys_list );
-		while ( systemp != END_OF_LIST(&shipp->subsys_list) ) {
-			temp = GET_NEXT( systemp );								// use temporary since pointers will get screwed with next operation
-			list_remove( shipp->subsys_list, systemp );			// remove the element
-			list_append( &ship_subsys_free_list, systemp );		// and place back onto free list
-			Num_ship_subsystems--;								// subtract from our in-use total
-			systemp = temp;												// use the temp variable to move right along
-		}
+	// return the whole run to the arena for other ships to use
+	Ship_subsystems.free(shipp->subsys_storage, shipp->subsys_storage_size);
 
-		shipp->subsys_list_indexer.reset();
-		shipp->flags.remove(Ship::Ship_Flags::Subsystem_cache_valid);
-	}
+	list_init( &shipp->subsys_list );
+	shipp->subsys_storage = nullptr;
+	shipp->subsys_storage_size = 0;
+	shipp->num_subsys_linked = 0;
 }
 
 void ship_delete( object * obj )
@@ -8279,6 +8231,7 @@ void ship_wing_cleanup( int shipnum, wing *wingp )
 			// mark the wing as gone
 			wingp->flags.set(Ship::Wing_Flags::Gone);
 			wingp->time_gone = Missiontime;
+			mission_cue_fact_changed(CueFact::MissionLog);
 
 			// if all ships were destroyed, log it as destroyed
 			if (wingp->total_destroyed == wingp->total_arrived_count)
@@ -8452,6 +8405,7 @@ void ship_cleanup(int shipnum, int cleanup_mode)
 	entry->objp = nullptr;
 	entry->shipp = nullptr;
 	entry->cleanup_mode = cleanup_mode;
+	mission_cue_fact_changed(CueFact::MissionLog);
 
 	// add the information to the exited ship list
 	switch (cleanup_mode) {
@@ -10807,6 +10761,7 @@ int ship_create(matrix* orient, vec3d* pos, int ship_type, const char* ship_name
 		entry->objp = &Objects[objnum];
 		entry->shipp = shipp;
 	}
+	mission_cue_fact_changed(CueFact::MissionLog);
 	
 	// Start up stracking for this ship in multi.
 	if (Game_mode & (GM_MULTIPLAYER)) {
@@ -11046,11 +11001,8 @@ void change_ship_type(int n, int ship_type, int by_sexp)
 			}
 		}
 
-		for (i = 0; i < MAX_WEAPONS; i++) {
-			if (Weapons[i].objnum == -1) {
-				continue;
-			}
-			weapon* wp = &Weapons[i];
+		for (auto weapon_idx : Weapons.used()) {
+			weapon* wp = &Weapons[weapon_idx];
 			if (wp->homing_subsys && wp->homing_subsys->parent_objnum == objnum) {
 				homing_matches.push_back(wp);
 			}
@@ -14729,37 +14681,6 @@ ship_subsys *ship_find_first_subsys(ship *sp, int subsys_type, vec3d *attacker_p
 	return nullptr;
 }
 
-/**
- * Create or recreate the subsystem index cache.
- */
-void ship_index_subsystems(ship *shipp)
-{
-	auto sinfo = &Ship_info[shipp->ship_info_index];
-
-	// if the indexer already exists, its size won't change, so don't reallocate it
-	if (shipp->subsys_list_indexer.get() == nullptr)
-		shipp->subsys_list_indexer.reset(new ship_subsys* [sinfo->n_subsystems]);
-
-	auto ss = GET_FIRST(&shipp->subsys_list);
-	for (int index = 0; index < sinfo->n_subsystems; ++index)
-	{
-		// normal indexing to valid subsystems
-		if (ss != END_OF_LIST(&shipp->subsys_list))
-		{
-			shipp->subsys_list_indexer[index] = ss;
-			ss->parent_subsys_index = index;
-			ss = GET_NEXT(ss);
-		}
-		// in the event we run out of subsystems (i.e. if not all subsystems were linked)
-		else
-		{
-			shipp->subsys_list_indexer[index] = nullptr;
-		}
-	}
-
-	shipp->flags.set(Ship::Ship_Flags::Subsystem_cache_valid);
-}
-
 /**
  * Returns the 'nth' ship_subsys structure in a ship's linked list of subsystems.
  */
@@ -14768,11 +14689,11 @@ ship_subsys *ship_get_indexed_subsys(ship *sp, int index)
 	Assertion(index >= 0, "Index must be positive!  The functionality for negative indexes has been moved to ship_get_first_subsys.");
 	Assertion(index < Ship_info[sp->ship_info_index].n_subsystems, "Subsystem index out of range!");
 
-	// might need to refresh the cache
-	if (!sp->flags[Ship::Ship_Flags::Subsystem_cache_valid])
-		ship_index_subsystems(sp);
+	// subsystems which could not be linked are missing at the end
+	if (index >= sp->num_subsys_linked)
+		return nullptr;
 
-	return sp->subsys_list_indexer[index];
+	return &sp->subsys_storage[index];
 }
 
 /**
@@ -14784,12 +14705,7 @@ int ship_get_subsys_index(ship_subsys *subsys)
 	if (subsys == nullptr)
 		return -1;
 
-	// might need to refresh the cache
-	auto sp = &Ships[Objects[subsys->parent_objnum].instance];
-	if (!sp->flags[Ship::Ship_Flags::Subsystem_cache_valid])
-		ship_index_subsystems(sp);
-
-	Assertion(subsys->parent_subsys_index >= 0, "Somehow a subsystem could not be found in its parent ship %s's subsystem list!", sp->ship_name);
+	Assertion(subsys->parent_subsys_index >= 0, "Somehow a subsystem could not be found in its parent ship %s's subsystem list!", Ships[Objects[subsys->parent_objnum].instance].ship_name);
 	return subsys->parent_subsys_index;
 }
 
@@ -16506,7 +16422,7 @@ static int ship_has_homing_missile_locked(ship *shipp)
 		if (A->type != OBJ_WEAPON)
 			continue;
 
-		Assert((A->instance >= 0) && (A->instance < MAX_WEAPONS));
+		Assert((A->instance >= 0) && (A->instance < Weapons.capacity()));
 		wp = &Weapons[A->instance];
 		wip = &Weapon_info[wp->weapon_info_index];
 
@@ -17891,9 +17807,7 @@ void ship_page_in()
 
 	// pre-allocate the subsystems, this really only needs to happen for ships
 	// which don't exist yet (ie, ships NOT in Ships[])
-	if (!ship_allocate_subsystems(num_subsystems_needed, true)) {
-		Error(LOCATION, "Attempt to page in new subsystems subsystems failed, which shouldn't be possible anymore. Currently allocated %d subsystems (%d in use)", Num_ship_subsystems_allocated, Num_ship_subsystems); 
-	}
+	ship_reserve_subsystems(num_subsystems_needed);
 
 	mprintf(("About to page in ships!\n"));
 
@@ -246,10 +246,18 @@ int ds_get_sid()
 	return (int)(sound_buffers.size() - 1);
 }
 
-int ds_load_buffer(int *sid, int  /*flags*/, sound::IAudioFile* file)
+/**
+ * Creates a sound buffer from already decoded PCM data
+ *
+ * @param sid Pointer to the variable which receives the sound id
+ * @param props The properties of the decoded data
+ * @param data The PCM data in the format described by props
+ * @param size The size of the data in bytes
+ * @return 0 on success, -1 on failure
+ */
+int ds_load_buffer(int *sid, const sound::AudioFileProperties& props, const uint8_t* data, size_t size)
 {
 	Assert(sid != NULL);
-	Assert(file != NULL);
 
 	// All sounds are required to have a software buffer
 	*sid = ds_get_sid();
@@ -261,46 +269,29 @@ int ds_load_buffer(int *sid, int  /*flags*/, sound::IAudioFile* file)
 	ALuint pi;
 	OpenAL_ErrorCheck(alGenBuffers(1, &pi), return -1);
 
-	const auto fileProps = file->getFileProperties();
-
 	ALenum format;
-	ALsizei size = fileProps.total_samples * fileProps.bytes_per_sample * fileProps.num_channels;
-	ALint n_channels = fileProps.num_channels;
+	ALint n_channels = props.num_channels;
 	ALsizei frequency;
-		
+
 	// format is now in pcm
-	frequency = fileProps.sample_rate;
-	format = openal_get_format(fileProps.bytes_per_sample * 8, fileProps.num_channels);
+	frequency = props.sample_rate;
+	format = openal_get_format(props.bytes_per_sample * 8, props.num_channels);
 
 	if (format == AL_INVALID_VALUE) {
 		return -1;
 	}
 
-	SCP_vector<uint8_t> audio_buffer;
-	audio_buffer.reserve(size);
-
-	SCP_vector<uint8_t> buffer(fileProps.sample_rate * fileProps.bytes_per_sample * fileProps.num_channels);
-	int read;
-	while((read = file->Read(&buffer[0], buffer.size())) >= 0) {
-		if (read == 0) {
-			// buffer not large enough
-			buffer.resize(buffer.size() * 2);
-		} else {
-			audio_buffer.insert(audio_buffer.end(), buffer.begin(), std::next(buffer.begin(), read));
-		}
-	}
-
-	Snd_sram += audio_buffer.size();
+	Snd_sram += size;
 
-	OpenAL_ErrorCheck(alBufferData(pi, format, audio_buffer.data(), (ALsizei)audio_buffer.size(), frequency), return -1; );
+	OpenAL_ErrorCheck(alBufferData(pi, format, data, (ALsizei)size, frequency), return -1; );
 
 	sound_buffers[*sid].buf_id = pi;
 	sound_buffers[*sid].channel_id = -1;
 	sound_buffers[*sid].frequency = frequency;
-	sound_buffers[*sid].bits_per_sample = fileProps.bytes_per_sample * 8;
+	sound_buffers[*sid].bits_per_sample = props.bytes_per_sample * 8;
 	sound_buffers[*sid].nchannels = n_channels;
-	sound_buffers[*sid].nseconds = fl2i(fileProps.duration);
-	sound_buffers[*sid].nbytes = (int)audio_buffer.size();
+	sound_buffers[*sid].nseconds = fl2i(props.duration);
+	sound_buffers[*sid].nbytes = (int)size;
 
 	return 0;
 }
@@ -58,7 +58,7 @@ using ds_sound_handle = ::util::ID<ds_sound_handle_tag, int, -1>;
 
 int ds_init();
 void ds_close();
-int ds_load_buffer(int *sid, int flags, sound::IAudioFile* file);
+int ds_load_buffer(int *sid, const sound::AudioFileProperties& props, const uint8_t* data, size_t size);
 void ds_unload_buffer(int sid);
 ds_sound_handle ds_play(int sid, int snd_id, int priority, const EnhancedSoundData* enhanced_sound_data, float volume,
                         float pan, int looping, bool is_voice_msg = false);
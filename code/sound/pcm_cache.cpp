@@ -0,0 +1,102 @@
+#include "sound/pcm_cache.h"
+
+#include "parse/parselo.h"
+
+#include <cstring>
+
+namespace {
+const uint PCM_CACHE_MAGIC   = 0x4D435046; // "FPCM"
+const int PCM_CACHE_VERSION = 1;
+
+// The cache is stored little endian like every other file written through cfile
+void write_int(SCP_vector<uint8_t>& out, int value)
+{
+	value = INTEL_INT(value);
+	auto bytes = reinterpret_cast<const uint8_t*>(&value);
+	out.insert(out.end(), bytes, bytes + sizeof(value));
+}
+
+void write_float(SCP_vector<uint8_t>& out, float value)
+{
+	int bits;
+	memcpy(&bits, &value, sizeof(bits));
+	write_int(out, bits);
+}
+
+bool read_int(const uint8_t*& data, const uint8_t* end, int& value)
+{
+	if (end - data < (ptrdiff_t)sizeof(value)) {
+		return false;
+	}
+
+	memcpy(&value, data, sizeof(value));
+	value = INTEL_INT(value);
+	data += sizeof(value);
+	return true;
+}
+
+bool read_float(const uint8_t*& data, const uint8_t* end, float& value)
+{
+	int bits;
+	if (!read_int(data, end, bits)) {
+		return false;
+	}
+
+	memcpy(&value, &bits, sizeof(value));
+	return true;
+}
+} // namespace
+
+namespace sound {
+
+SCP_string pcm_cache_name(uint file_checksum, size_t file_size, int quality, bool mono)
+{
+	SCP_string name;
+	sprintf(name, "snd_pcm-%08x-%x-%d%s.pcm", file_checksum, (uint)file_size, quality, mono ? "m" : "s");
+	return name;
+}
+
+void pcm_cache_write(const pcm_cache_entry& entry, SCP_vector<uint8_t>& out)
+{
+	write_int(out, (int)PCM_CACHE_MAGIC);
+	write_int(out, PCM_CACHE_VERSION);
+	write_int(out, entry.props.bytes_per_sample);
+	write_int(out, entry.props.num_channels);
+	write_int(out, entry.props.sample_rate);
+	write_int(out, entry.props.total_samples);
+	write_float(out, (float)entry.props.duration);
+	write_int(out, entry.source_channels);
+	write_int(out, (int)entry.pcm.size());
+	out.insert(out.end(), entry.pcm.begin(), entry.pcm.end());
+}
+
+bool pcm_cache_read(const uint8_t* data, size_t size, pcm_cache_entry& entry)
+{
+	const uint8_t* end = data + size;
+
+	int magic, version;
+	if (!read_int(data, end, magic) || (uint)magic != PCM_CACHE_MAGIC || !read_int(data, end, version)
+		|| version != PCM_CACHE_VERSION) {
+		return false;
+	}
+
+	float duration;
+	int pcm_size;
+	if (!read_int(data, end, entry.props.bytes_per_sample) || !read_int(data, end, entry.props.num_channels)
+		|| !read_int(data, end, entry.props.sample_rate) || !read_int(data, end, entry.props.total_samples)
+		|| !read_float(data, end, duration) || !read_int(data, end, entry.source_channels)
+		|| !read_int(data, end, pcm_size)) {
+		return false;
+	}
+
+	if (pcm_size <= 0 || pcm_size > end - data) {
+		return false;
+	}
+
+	entry.props.duration = duration;
+	entry.pcm.assign(data, data + pcm_size);
+
+	return true;
+}
+
+} // namespace sound
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "globalincs/pstypes.h"
+#include "sound/IAudioFile.h"
+
+namespace sound {
+
+/**
+ * @brief Decoded sound data as it is stored in the PCM cache
+ */
+struct pcm_cache_entry {
+	AudioFileProperties props;
+	int source_channels = -1; //!< The channel count of the file before it was resampled
+	SCP_vector<uint8_t> pcm;
+};
+
+/**
+ * @brief The cache file name of a sound
+ *
+ * @param file_checksum The checksum of the compressed source file
+ * @param file_size The size of the compressed source file
+ * @param quality The sound quality setting the data was decoded with
+ * @param mono @c true if the data was resampled to one channel for 3D playback
+ */
+SCP_string pcm_cache_name(uint file_checksum, size_t file_size, int quality, bool mono);
+
+/**
+ * @brief Appends the cache file contents of an entry to out
+ */
+void pcm_cache_write(const pcm_cache_entry& entry, SCP_vector<uint8_t>& out);
+
+/**
+ * @brief Reads the cache file contents written by pcm_cache_write()
+ *
+ * @return @c false if the data is not a valid cache file of the current version or is truncated
+ */
+bool pcm_cache_read(const uint8_t* data, size_t size, pcm_cache_entry& entry);
+
+} // namespace sound
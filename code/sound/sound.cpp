@@ -10,6 +10,7 @@
 #include "cfile/cfile.h"
 #include "cmdline/cmdline.h"
 #include "debugconsole/console.h"
+#include "executor/WorkerPool.h"
 #include "gamesnd/eventmusic.h"
 #include "gamesnd/gamesnd.h"
 #include "globalincs/alphacolors.h"
@@ -24,6 +25,7 @@
 #include "sound/ds.h"
 #include "sound/ds3d.h"
 #include "sound/dscap.h"
+#include "sound/pcm_cache.h"
 #include "tracing/Monitor.h"
 #include "tracing/tracing.h"
 
@@ -34,6 +36,22 @@
 #include <climits>
 
 #define SND_F_USED			(1<<0)		// Sounds[] element is used
+#define SND_F_PENDING		(1<<1)		// Sounds[] element is still being decoded in the background
+
+namespace {
+struct sound_decode_result : sound::pcm_cache_entry {
+	bool success = false;
+};
+
+struct pending_sound_load {
+	std::future<sound_decode_result> result;
+	std::shared_ptr<SCP_vector<uint8_t>> file_data; //!< Kept for decoding again if the background decoding failed
+	bool mono = false; //!< The sound is resampled to one channel for 3D playback
+
+	uint file_checksum = 0;
+	size_t file_size   = 0;
+};
+} // namespace
 
 struct loaded_sound {
 	int sid; // software id
@@ -43,10 +61,19 @@ struct loaded_sound {
 	sound_info info;
 	int uncompressed_size; // size (in bytes) of sound (uncompressed)
 	int duration;
+
+	std::shared_ptr<pending_sound_load> pending; // only set while SND_F_PENDING is set
 };
 
 SCP_vector<loaded_sound> Sounds;
 
+// Maps file names to the Sounds[] slots which contain that file. A file may be in there twice if it is used both as a
+// stereo 2D sound and as a mono 3D sound.
+static SCP_unordered_map<SCP_string, SCP_vector<int>, SCP_string_lcase_hash, SCP_string_lcase_equal_to> Sound_lookup;
+
+// Sounds[] slots which are still being decoded by the worker pool
+static SCP_vector<int> Sound_pending_loads;
+
 int Sound_enabled = FALSE;				// global flag to turn sound on/off
 size_t Snd_sram;								// mem (in bytes) used up by storing sounds in system memory
 
@@ -152,6 +179,8 @@ int ds_priority(int priority)
 void snd_clear()
 {
 	Sounds.clear();
+	Sound_lookup.clear();
+	Sound_pending_loads.clear();
 
 	// reset how much storage sounds are taking up in memory
 	Snd_sram = 0;
@@ -277,27 +306,330 @@ void snd_spew_debug_info()
 	gr_printf_no_resize(sx, sy, "Total sounds : %d\n", game_sounds + interface_sounds + message_sounds);
 }
 
-static std::unique_ptr<sound::IAudioFile> openAudioFile(const char* fileName)
+static void snd_lookup_add(const char* filename, int n)
+{
+	Sound_lookup[filename].push_back(n);
+}
+
+static void snd_lookup_remove(const char* filename, int n)
+{
+	auto iter = Sound_lookup.find(filename);
+	if (iter == Sound_lookup.end()) {
+		return;
+	}
+
+	auto& slots = iter->second;
+	slots.erase(std::remove(slots.begin(), slots.end(), n), slots.end());
+
+	if (slots.empty()) {
+		Sound_lookup.erase(iter);
+	}
+}
+
+// Puts a Sounds[] slot back into the unused state after its buffer has been released
+static void snd_release_slot(int n)
+{
+	auto& snd = Sounds[n];
+
+	if (snd.flags & SND_F_PENDING) {
+		// The decoder job keeps its own reference to the pending data so we can just forget about it
+		Sound_pending_loads.erase(std::remove(Sound_pending_loads.begin(), Sound_pending_loads.end(), n),
+			Sound_pending_loads.end());
+	}
+
+	if (snd.flags & SND_F_USED) {
+		snd_lookup_remove(snd.filename, n);
+	}
+
+	snd.sid     = -1;
+	snd.sig     = -1;
+	snd.flags   = 0;
+	snd.pending = nullptr;
+}
+
+static void snd_warn_multichannel_3d(const char* filename)
+{
+#ifndef NDEBUG
+	// Retail has a few sounds that triggers this warning so we need to ignore those
+	const char* warning_ignore_list[] = {
+		"l_hit.wav",
+		"m_hit.wav",
+		"s_hit_2.wav",
+		"Pirate.wav",
+	};
+
+	for (auto& name : warning_ignore_list) {
+		if (!stricmp(name, filename)) {
+			return;
+		}
+	}
+
+	if (mod_supports_version(3, 8, 0)) {
+		// This warning was introduced in 3.8.0 and caused a few issues since a lot of mods use 3D sounds
+		// with more than one channel. This will silence the warnings for any mod that does not support
+		// 3.8.0.
+		Warning(LOCATION,
+				"Sound '%s' has more than one channel but is used as a 3D sound! 3D sounds may only have "
+				"one channel.",
+				filename);
+	} else {
+		mprintf(("Warning: Sound '%s' has more than one channel but is used as a 3D sound! 3D sounds may "
+				 "only have one channel.\n",
+				 filename));
+	}
+#else
+	SCP_UNUSED(filename);
+#endif
+}
+
+// ---------------------------------------------------------------------------------------
+// Decoded PCM cache
+//
+// Decoding compressed sounds is the most expensive part of loading them. If enabled with -sound_cache the decoded
+// data is stored in the cache directory, keyed by the checksum of the source file and the output format, so that
+// later launches can skip the decoder entirely.
+//
+static SCP_string snd_pcm_cache_name(const pending_sound_load& pending)
+{
+	return sound::pcm_cache_name(pending.file_checksum, pending.file_size, Ds_sound_quality, pending.mono);
+}
+
+static bool snd_pcm_cache_load(const pending_sound_load& pending, sound_decode_result& result)
+{
+	if (!Cmdline_sound_cache) {
+		return false;
+	}
+
+	auto cache_name = snd_pcm_cache_name(pending);
+	auto cfp = cfopen(cache_name.c_str(), "rb", CFILE_NORMAL, CF_TYPE_CACHE, false,
+	                  CF_LOCATION_ROOT_USER | CF_LOCATION_ROOT_GAME | CF_LOCATION_TYPE_ROOT);
+	if (!cfp) {
+		return false;
+	}
+
+	auto length = cfilelength(cfp);
+	SCP_vector<uint8_t> data((size_t)MAX(length, 0));
+	auto read = cfread(data.data(), 1, length, cfp);
+	cfclose(cfp);
+
+	if (read != length || !sound::pcm_cache_read(data.data(), data.size(), result)) {
+		nprintf(("Sound", "SOUND ==> Ignoring invalid cache file '%s'\n", cache_name.c_str()));
+		return false;
+	}
+
+	result.success = true;
+
+	return true;
+}
+
+static void snd_pcm_cache_store(const pending_sound_load& pending, const sound_decode_result& result)
+{
+	if (!Cmdline_sound_cache) {
+		return;
+	}
+
+	auto cache_name = snd_pcm_cache_name(pending);
+	auto cfp = cfopen(cache_name.c_str(), "wb", CFILE_NORMAL, CF_TYPE_CACHE, false,
+	                  CF_LOCATION_ROOT_USER | CF_LOCATION_ROOT_GAME | CF_LOCATION_TYPE_ROOT);
+	if (!cfp) {
+		mprintf(("Could not open sound cache file '%s'!\n", cache_name.c_str()));
+		return;
+	}
+
+	SCP_vector<uint8_t> data;
+	sound::pcm_cache_write(result, data);
+	cfwrite(data.data(), 1, (int)data.size(), cfp);
+
+	cfclose(cfp);
+}
+
+// Reads the compressed sound file into memory. This touches cfile so it must happen on the main thread.
+static bool snd_read_file(const char* filename, SCP_vector<uint8_t>& data)
+{
+	auto res = cf_find_file_location_ext(filename, NUM_AUDIO_EXT, audio_ext_list, CF_TYPE_ANY);
+	if (!res.found) {
+		mprintf(("SOUND ==> Could not find sound file %s with any known extension.\n", filename));
+		return false;
+	}
+
+	auto cfp = cfopen_special(res, "rb", CF_TYPE_ANY);
+	if (cfp == nullptr) {
+		mprintf(("SOUND ==> Failed to open sound file %s.\n", filename));
+		return false;
+	}
+
+	auto length = cfilelength(cfp);
+	data.resize((size_t)length);
+	auto read = cfread(data.data(), 1, length, cfp);
+	cfclose(cfp);
+
+	return length > 0 && read == length;
+}
+
+// Decodes a sound file into PCM data. This does not touch any global state except for the (serialized) debug log so
+// it can run on a worker thread.
+static sound_decode_result snd_decode(const SCP_vector<uint8_t>& file_data, bool mono)
 {
+	sound_decode_result result;
+
 #ifdef WITH_FFMPEG
-	{
-		std::unique_ptr<sound::IAudioFile> audio_file(new sound::ffmpeg::FFmpegWaveFile());
+	sound::ffmpeg::FFmpegWaveFile audio_file;
 
-		if (audio_file->Open(fileName, false)) {
-			return audio_file;
+	if (!audio_file.OpenMem(file_data.data(), file_data.size())) {
+		return result;
+	}
+
+	auto fileProps = audio_file.getFileProperties();
+	result.source_channels = fileProps.num_channels;
+
+	if (mono && fileProps.num_channels > 1) {
+		// We need to resample the audio down to one channel
+		sound::ResampleProperties resample;
+		resample.num_channels = 1;
+
+		audio_file.setResamplingProperties(resample);
+		fileProps = audio_file.getFileProperties(); // Refresh properties so that we have accurate information
+	}
+
+	result.pcm.reserve(fileProps.total_samples * fileProps.bytes_per_sample * fileProps.num_channels);
+
+	SCP_vector<uint8_t> buffer(fileProps.sample_rate * fileProps.bytes_per_sample * fileProps.num_channels);
+	int read;
+	while ((read = audio_file.Read(&buffer[0], buffer.size())) >= 0) {
+		if (read == 0) {
+			// buffer not large enough
+			buffer.resize(buffer.size() * 2);
+		} else {
+			result.pcm.insert(result.pcm.end(), buffer.begin(), std::next(buffer.begin(), read));
 		}
 	}
+
+	result.props   = fileProps;
+	result.success = true;
+#else
+	SCP_UNUSED(file_data);
+	SCP_UNUSED(mono);
 #endif
 
-	return nullptr;
+	return result;
+}
+
+// Uploads decoded data into the sound buffer of slot n. Returns false and releases the slot if anything failed.
+static bool snd_upload_decoded(int n, const pending_sound_load& pending, const sound_decode_result& result)
+{
+	auto snd = &Sounds[n];
+	auto si  = &snd->info;
+
+	if (!result.success) {
+		mprintf(("SOUND ==> Failed to decode '%s'\n", snd->filename));
+		snd_release_slot(n);
+		return false;
+	}
+
+	if (pending.mono && result.source_channels > 1) {
+		snd_warn_multichannel_3d(snd->filename);
+	}
+
+	const auto& fileProps = result.props;
+
+	// Load was a success
+	si->n_channels        = fileProps.num_channels; // 16-bit channel count (nChannels)
+	si->sample_rate       = fileProps.sample_rate;  // 32-bit sample rate (nSamplesPerSec)
+	si->avg_bytes_per_sec = fileProps.sample_rate * fileProps.bytes_per_sample *
+							fileProps.num_channels; // 32-bit average bytes per second (nAvgBytesPerSec)
+	si->bits = fileProps.bytes_per_sample * 8;      // Read 16-bit bits per sample
+	si->size = fileProps.total_samples * fileProps.bytes_per_sample * fileProps.num_channels;
+
+	snd->uncompressed_size = si->size;
+
+	auto rc = ds_load_buffer(&snd->sid, fileProps, result.pcm.data(), result.pcm.size());
+	if (rc == -1) {
+		nprintf(("Sound", "SOUND ==> Failed to load '%s'\n", snd->filename));
+		snd_release_slot(n);
+		return false;
+	}
+
+	// NOTE: "si" values can change once loaded in the buffer
+	snd->duration = fl2i(1000.0f * fileProps.duration);
+
+	snd->flags &= ~SND_F_PENDING;
+	snd->pending = nullptr;
+
+	nprintf(("Sound", "SOUND ==> Finished loading '%s'\n", snd->filename));
+
+	return true;
+}
+
+// Waits for the background decoding of slot n to finish and uploads the result. Returns true if the slot holds a valid
+// sound afterwards.
+static bool snd_finish_load(int n)
+{
+	auto& snd = Sounds[n];
+
+	if (!(snd.flags & SND_F_PENDING)) {
+		return (snd.flags & SND_F_USED) != 0;
+	}
+
+	TRACE_SCOPE(tracing::LoadSound);
+
+	auto pending = snd.pending;
+	Sound_pending_loads.erase(std::remove(Sound_pending_loads.begin(), Sound_pending_loads.end(), n),
+		Sound_pending_loads.end());
+
+	auto result = pending->result.get();
+
+	if (!result.success) {
+		// Don't let the first play of the sound fail only because the worker couldn't decode it
+		mprintf(("SOUND ==> Background decoding of '%s' failed, decoding it again on the main thread.\n", snd.filename));
+		result = snd_decode(*pending->file_data, pending->mono);
+	}
+
+	if (!snd_upload_decoded(n, *pending, result)) {
+		return false;
+	}
+
+	snd_pcm_cache_store(*pending, result);
+
+	return true;
+}
+
+// Looks for an already loaded (or loading) sound which can be used for this request
+static int snd_find_loaded(const char* filename, bool use_ds3d)
+{
+	auto iter = Sound_lookup.find(filename);
+	if (iter == Sound_lookup.end()) {
+		return -1;
+	}
+
+	// Copy since finishing a load may modify the lookup table
+	auto slots = iter->second;
+	for (auto n : slots) {
+		auto& snd = Sounds[n];
+
+		// extra check: make sure the sound is actually loaded in a compatible way (2D vs. 3D)
+		//
+		// NOTE: this will allow a duplicate 3D entry if 2D stereo entry exists,
+		//       but will not load a duplicate 2D entry to get stereo if 3D
+		//       version already loaded
+		if (!use_ds3d || ((snd.flags & SND_F_PENDING) && snd.pending->mono)) {
+			return n;
+		}
+
+		// A 2D sound which is still decoding might be mono as well but we can only find out by waiting for it
+		if (snd_finish_load(n) && snd.info.n_channels == 1) {
+			return n;
+		}
+	}
+
+	return -1;
 }
 
 // ---------------------------------------------------------------------------------------
-// snd_load() 
+// snd_load_async()
 //
-// Load a sound into memory and prepare it for playback.  The sound will reside in memory as
-// a single instance, and can be played multiple times simultaneously.  Through the magic of
-// DirectSound, only 1 copy of the sound is used.
+// Starts loading a sound into memory and returns its index immediately. The compressed file is read on the calling
+// thread but decoding happens on the worker pool. Pending sounds are finished in snd_do_frame() or as soon as they are
+// needed for playback.
 //
 // parameters:		entry							=> entry of sound to load
 // parameters:		flags							=> pointer to flags of sound to load, so they
@@ -307,14 +639,12 @@ static std::unique_ptr<sound::IAudioFile> openAudioFile(const char* fileName)
 // returns:			success => index of sound in Sounds[] array
 //						failure => -1
 //
-//int snd_load( char *filename, int hardware, int use_ds3d, int *sig)
-sound_load_id snd_load(game_snd_entry* entry, int *flags, int /*allow_hardware_load*/)
+// NOTE: Decoding errors are only detected after this function returned. A sound which failed to decode in the
+//       background is decoded again on the main thread when it is finished. If that fails too the slot is released
+//       and the next snd_play() with the entry will try to load it again synchronously.
+//
+sound_load_id snd_load_async(game_snd_entry* entry, int* flags, int /*allow_hardware_load*/)
 {
-	int type;
-	sound_info* si;
-	loaded_sound* snd;
-	size_t n;
-
 	if (!ds_initialized)
 		return sound_load_id::invalid();
 
@@ -324,18 +654,28 @@ sound_load_id snd_load(game_snd_entry* entry, int *flags, int /*allow_hardware_l
 	if (flags && *flags & GAME_SND_NOT_VALID)
 		return sound_load_id::invalid();
 
+	const bool use_ds3d = flags && (*flags & GAME_SND_USE_DS3D);
+
+	auto existing = snd_find_loaded(entry->filename, use_ds3d);
+	if (existing >= 0) {
+		return sound_load_id(existing);
+	}
+
+	TRACE_SCOPE(tracing::LoadSound);
+
+	nprintf(("Sound", "SOUND ==> Loading '%s'\n", entry->filename));
+
+	auto file_data = std::make_shared<SCP_vector<uint8_t>>();
+	if (!snd_read_file(entry->filename, *file_data)) {
+		if (flags)
+			*flags |= GAME_SND_NOT_VALID;
+		return sound_load_id::invalid();
+	}
+
+	size_t n;
 	for (n = 0; n < Sounds.size(); n++) {
 		if ( !(Sounds[n].flags & SND_F_USED) ) {
 			break;
-		} else if ( !stricmp( Sounds[n].filename, entry->filename) ) {
-			// extra check: make sure the sound is actually loaded in a compatible way (2D vs. 3D)
-			//
-			// NOTE: this will allow a duplicate 3D entry if 2D stereo entry exists,
-			//       but will not load a duplicate 2D entry to get stereo if 3D
-			//       version already loaded
-			if ( (Sounds[n].info.n_channels == 1) || !(flags && *flags & GAME_SND_USE_DS3D) ) {
-				return sound_load_id(static_cast<int>(n));
-			}
 		}
 	}
 
@@ -347,104 +687,106 @@ sound_load_id snd_load(game_snd_entry* entry, int *flags, int /*allow_hardware_l
 		Sounds.push_back(new_sound);
 	}
 
-	snd = &Sounds[n];
-
-	si = &snd->info;
+	auto snd = &Sounds[n];
 
-	TRACE_SCOPE(tracing::LoadSound);
+	strcpy_s( snd->filename, entry->filename );
+	snd->sid   = -1;
+	snd->flags = SND_F_USED | SND_F_PENDING;
 
-	nprintf(("Sound", "SOUND ==> Loading '%s'\n", entry->filename));
+	snd->sig = snd_next_sig++;
+	if (snd_next_sig < 0 ) snd_next_sig = 1;
+	entry->id_sig = snd->sig;
+	entry->id     = sound_load_id(static_cast<int>(n));
 
-	std::unique_ptr<sound::IAudioFile> audio_file = openAudioFile(entry->filename);
+	snd_lookup_add(snd->filename, static_cast<int>(n));
 
-	if (audio_file == nullptr) {
-		if (flags)
-			*flags |= GAME_SND_NOT_VALID;
-		return sound_load_id::invalid();
+	auto pending       = std::make_shared<pending_sound_load>();
+	pending->mono      = use_ds3d;
+	pending->file_size = file_data->size();
+	pending->file_data = file_data;
+	if (Cmdline_sound_cache) {
+		pending->file_checksum = cf_add_chksum_long(0, file_data->data(), file_data->size());
 	}
+	snd->pending = pending;
 
-	auto fileProps = audio_file->getFileProperties();
-
-	type = 0;
-	if (flags && *flags & GAME_SND_USE_DS3D) {
-		type |= DS_3D;
+	sound_decode_result cached;
+	if (snd_pcm_cache_load(*pending, cached)) {
+		// Nothing left to decode
+		if (!snd_upload_decoded(static_cast<int>(n), *pending, cached)) {
+			return sound_load_id::invalid();
+		}
+		return sound_load_id(static_cast<int>(n));
+	}
 
-		if (fileProps.num_channels > 1) {
-			// We need to resample the audio down to one channel
-			sound::ResampleProperties resample;
-			resample.num_channels = 1;
+	const bool mono = pending->mono;
+	pending->result = executor::workerPool().submit([file_data, mono]() { return snd_decode(*file_data, mono); });
+	Sound_pending_loads.push_back(static_cast<int>(n));
 
-			audio_file->setResamplingProperties(resample);
-			fileProps = audio_file->getFileProperties(); // Refresh properties so that we have accurate information
+	return sound_load_id(static_cast<int>(n));
+}
 
-#ifndef NDEBUG
-			// Retail has a few sounds that triggers this warning so we need to ignore those
-			const char* warning_ignore_list[] = {
-				"l_hit.wav",
-				"m_hit.wav",
-				"s_hit_2.wav",
-				"Pirate.wav",
-			};
-
-			bool show_warning = true;
-			for (auto& name : warning_ignore_list) {
-				if (!stricmp(name, entry->filename)) {
-					show_warning = false;
-					break;
-				}
-			}
+// ---------------------------------------------------------------------------------------
+// snd_load() 
+//
+// Load a sound into memory and prepare it for playback.  The sound will reside in memory as
+// a single instance, and can be played multiple times simultaneously.  Through the magic of
+// DirectSound, only 1 copy of the sound is used.
+//
+// parameters:		entry							=> entry of sound to load
+// parameters:		flags							=> pointer to flags of sound to load, so they
+//													   can be modified if necessary; can be nullptr
+//					allow_hardware_load				=> whether to try to allocate in hardware
+//
+// returns:			success => index of sound in Sounds[] array
+//						failure => -1
+//
+//int snd_load( char *filename, int hardware, int use_ds3d, int *sig)
+sound_load_id snd_load(game_snd_entry* entry, int *flags, int allow_hardware_load)
+{
+	auto id = snd_load_async(entry, flags, allow_hardware_load);
 
-			if (show_warning) {
-				if (mod_supports_version(3, 8, 0)) {
-					// This warning was introduced in 3.8.0 and caused a few issues since a lot of mods use 3D sounds
-					// with more than one channel. This will silence the warnings for any mod that does not support
-					// 3.8.0.
-					Warning(LOCATION,
-							"Sound '%s' has more than one channel but is used as a 3D sound! 3D sounds may only have "
-							"one channel.",
-							entry->filename);
-				} else {
-					mprintf(("Warning: Sound '%s' has more than one channel but is used as a 3D sound! 3D sounds may "
-							 "only have one channel.\n",
-							 entry->filename));
-				}
-			}
-#endif
-		}
+	if (!id.isValid()) {
+		return id;
 	}
 
-	// Load was a success
-	si->n_channels        = fileProps.num_channels; // 16-bit channel count (nChannels)
-	si->sample_rate       = fileProps.sample_rate;  // 32-bit sample rate (nSamplesPerSec)
-	si->avg_bytes_per_sec = fileProps.sample_rate * fileProps.bytes_per_sample *
-							fileProps.num_channels; // 32-bit average bytes per second (nAvgBytesPerSec)
-	si->bits = fileProps.bytes_per_sample * 8;      // Read 16-bit bits per sample
-	si->size = fileProps.total_samples * fileProps.bytes_per_sample * fileProps.num_channels;
-
-	snd->uncompressed_size = si->size;
-
-	auto rc = ds_load_buffer(&snd->sid, type, audio_file.get());
-	if (rc == -1) {
-		nprintf(("Sound", "SOUND ==> Failed to load '%s'\n", entry->filename));
+	if (!snd_finish_load(id.value())) {
 		if (flags)
 			*flags |= GAME_SND_NOT_VALID;
 		return sound_load_id::invalid();
 	}
 
-	// NOTE: "si" values can change once loaded in the buffer
-	snd->duration = fl2i(1000.0f * fileProps.duration);
+	return id;
+}
 
-	strcpy_s( snd->filename, entry->filename );
-	snd->flags = SND_F_USED;
+// ---------------------------------------------------------------------------------------
+// snd_process_pending_loads()
+//
+// Uploads all sounds whose background decoding has finished. Does not block.
+//
+void snd_process_pending_loads()
+{
+	// Copy since finishing a load modifies the list
+	auto pending_loads = Sound_pending_loads;
 
-	snd->sig = snd_next_sig++;
-	if (snd_next_sig < 0 ) snd_next_sig = 1;
-	entry->id_sig = snd->sig;
-	entry->id     = sound_load_id(static_cast<int>(n));
+	for (auto n : pending_loads) {
+		auto& pending = Sounds[n].pending;
 
-	nprintf(("Sound", "SOUND ==> Finished loading '%s'\n", entry->filename));
+		if (pending->result.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+			snd_finish_load(n);
+		}
+	}
+}
 
-	return sound_load_id(static_cast<int>(n));
+// ---------------------------------------------------------------------------------------
+// snd_finish_pending_loads()
+//
+// Waits for all sounds started with snd_load_async() to be fully loaded.
+//
+void snd_finish_pending_loads()
+{
+	while (!Sound_pending_loads.empty()) {
+		snd_finish_load(Sound_pending_loads.front());
+	}
 }
 
 // ---------------------------------------------------------------------------------------
@@ -474,12 +816,11 @@ int snd_unload(sound_load_id n)
 		Snd_sram -= snd.uncompressed_size;
 	}
 
+	snd_release_slot(n.value());
+
 	//If this sound is at the end of the array, we might as well get rid of it
 	if ((size_t)n.value() == Sounds.size() - 1) {
 		Sounds.pop_back();
-	} else {
-		snd.sid = -1;
-		snd.flags &= ~SND_F_USED;
 	}
 
 	return 1;
@@ -609,6 +950,9 @@ sound_handle snd_play(game_snd* gs, float pan, float vol_scale, int priority, bo
 	if ( volume > 1.0f )
 		volume = 1.0f;
 
+	// The sound may still be decoding in the background
+	snd_finish_load(entry->id.value());
+
 	snd = &Sounds[entry->id.value()];
 
 	if ( !(snd->flags & SND_F_USED) )
@@ -693,6 +1037,9 @@ sound_handle snd_play_3d(game_snd* gs, vec3d* source_pos, vec3d* listen_pos, flo
 		return sound_handle::invalid();
 	}
 
+	// The sound may still be decoding in the background
+	snd_finish_load(entry->id.value());
+
 	snd = &Sounds[entry->id.value()];
 
 	if ( !(snd->flags & SND_F_USED) )
@@ -907,6 +1254,9 @@ sound_handle snd_play_looping(game_snd* gs, float pan, int /*start_loop*/, int /
 		return sound_handle::invalid();
 	}
 
+	// The sound may still be decoding in the background
+	snd_finish_load(entry->id.value());
+
 	snd = &Sounds[entry->id.value()];
 
 	if ( !(snd->flags & SND_F_USED) )
@@ -1168,6 +1518,8 @@ int snd_get_duration(sound_load_id snd_id)
 	if ( Sounds.empty() )
 		return 0;
 
+	snd_finish_load(snd_id.value());
+
 	Assertion(Sounds[snd_id.value()].duration > 0, "Sound duration for sound %s is bogus (%d)\n",
 	          Sounds[snd_id.value()].filename, Sounds[snd_id.value()].duration);
 
@@ -1297,6 +1649,8 @@ int snd_get_data(sound_load_id handle, char* data)
 {
 	Assert(handle.isValid());
 
+	snd_finish_load(handle.value());
+
 	if (ds_get_data(Sounds[handle.value()].sid, data)) {
 		return -1;
 	}
@@ -1309,6 +1663,8 @@ int snd_size(sound_load_id handle, int* size)
 {
 	Assert(handle.isValid());
 
+	snd_finish_load(handle.value());
+
 	if (ds_get_size(Sounds[handle.value()].sid, size)) {
 		return -1;
 	}
@@ -1321,6 +1677,8 @@ void snd_get_format(sound_load_id handle, int* bits_per_sample, int* frequency)
 {
 	Assert((handle.isValid()) && ((size_t)handle.value() < Sounds.size()));
 
+	snd_finish_load(handle.value());
+
 	if (bits_per_sample)
 		*bits_per_sample = Sounds[handle.value()].info.bits;
 
@@ -1481,6 +1839,8 @@ void snd_do_frame()
 	update_looping_sound_volumes(currentlyLoopingSoundInfos);
 	update_looping_sound_volumes(currentlyLooping3dSoundInfos);
 
+	snd_process_pending_loads();
+
 	ds_do_frame();
 }
 
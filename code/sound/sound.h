@@ -127,6 +127,16 @@ void snd_set_voice_volume(float volume);
 //int	snd_load( char *filename, int hardware=0, int three_d=0, int *sig=NULL );
 sound_load_id snd_load(game_snd_entry* entry, int* flags, int allow_hardware_load = 0);
 
+// Same as snd_load() but the sound is decoded in the background. The returned index can be used right away, playing it
+// before decoding is done will wait for the decoder.
+sound_load_id snd_load_async(game_snd_entry* entry, int* flags, int allow_hardware_load = 0);
+
+// Uploads sounds which finished decoding in the background. Called once per frame by snd_do_frame().
+void snd_process_pending_loads();
+
+// Waits until all sounds started with snd_load_async() are loaded
+void snd_finish_pending_loads();
+
 int snd_unload(sound_load_id sndnum);
 void	snd_unload_all();
 
@@ -339,6 +339,8 @@ add_file_folder("Executor"
 	executor/global_executors.h
 	executor/IExecutionContext.cpp
 	executor/IExecutionContext.h
+	executor/WorkerPool.cpp
+	executor/WorkerPool.h
 )
 
 # ExternalDLL files
@@ -546,8 +548,14 @@ add_file_folder("Graphics\\\\SoftwareGr\\\\Font"
 )
 
 add_file_folder("Graphics\\\\Util"
+	graphics/util/CommandRecorder.cpp
+	graphics/util/CommandRecorder.h
+	graphics/util/FrameRingBuffer.cpp
+	graphics/util/FrameRingBuffer.h
 	graphics/util/GPUMemoryHeap.cpp
 	graphics/util/GPUMemoryHeap.h
+	graphics/util/QuadBatch.cpp
+	graphics/util/QuadBatch.h
 	graphics/util/uniform_structs.h
 	graphics/util/UniformAligner.h
 	graphics/util/UniformAligner.cpp
@@ -807,6 +815,8 @@ add_file_folder("Mission"
 	mission/missionbriefcommon.h
 	mission/missioncampaign.cpp
 	mission/missioncampaign.h
+	mission/missioncue.cpp
+	mission/missioncue.h
 	mission/missiongoals.cpp
 	mission/missiongoals.h
 	mission/missiongrid.cpp
@@ -867,6 +877,8 @@ add_file_folder("Model"
 	model/modelanimation_moveables.h
 	model/modelanimation_segments.cpp
 	model/modelanimation_segments.h
+	model/modelcache.cpp
+	model/modelcache.h
 	model/modelcollide.cpp
 	model/modelinterp.cpp
 	model/modelread.cpp
@@ -1000,6 +1012,8 @@ add_file_folder("Object"
 	object/objcollide.h
 	object/object.cpp
 	object/object.h
+	object/objectbounds.cpp
+	object/objectbounds.h
 	object/objectdock.cpp
 	object/objectdock.h
 	object/objectshield.cpp
@@ -1231,6 +1245,8 @@ add_file_folder("Scripting"
 	scripting/hook_conditions.cpp
 	scripting/hook_conditions.h
 	scripting/lua.cpp
+	scripting/script_profiler.cpp
+	scripting/script_profiler.h
 	scripting/scripting.cpp
 	scripting/scripting.h
 	scripting/scripting_doc.h
@@ -1527,6 +1543,8 @@ add_file_folder("Sound"
 	sound/IAudioFile.h
 	sound/openal.cpp
 	sound/openal.h
+	sound/pcm_cache.cpp
+	sound/pcm_cache.h
 	sound/phrases.xml
 	sound/rtvoice.cpp
 	sound/rtvoice.h
@@ -1630,6 +1648,7 @@ add_file_folder("Ui"
 add_file_folder("Utils"
 	utils/base64.cpp
 	utils/base64.h
+	utils/chunked_pool.h
 	utils/encoding.cpp
 	utils/encoding.h
 	utils/event.h
@@ -1638,9 +1657,11 @@ add_file_folder("Utils"
 	utils/HeapAllocator.h
 	utils/id.h
 	utils/join_string.h
+	utils/radix_sort.h
 	utils/Random.cpp
 	utils/Random.h
 	utils/RandomRange.h
+	utils/run_arena.h
 	utils/string_utils.cpp
 	utils/string_utils.h
 	utils/strings.h
@@ -1180,8 +1180,8 @@ int scoring_eval_kill_on_weapon(object *weapon_obj, object *other_obj) {
 
 	// we don't evaluate kills on anything except weapons
 	// also make sure there was a killer, and that it was a ship
-	if((weapon_obj->type != OBJ_WEAPON) || (weapon_obj->instance < 0) || (weapon_obj->instance >= MAX_WEAPONS)
-			|| (other_obj == nullptr) || (other_obj->type != OBJ_WEAPON) || (other_obj->instance < 0) || (other_obj->instance >= MAX_WEAPONS)
+	if((weapon_obj->type != OBJ_WEAPON) || (weapon_obj->instance < 0) || (weapon_obj->instance >= Weapons.capacity())
+			|| (other_obj == nullptr) || (other_obj->type != OBJ_WEAPON) || (other_obj->instance < 0) || (other_obj->instance >= Weapons.capacity())
 			|| (other_obj->parent == -1) || (Objects[other_obj->parent].type != OBJ_SHIP)) {
 		return -1;
 	}
@@ -1399,7 +1399,7 @@ void scoring_eval_hit(object *hit_obj, object *other_obj,int from_blast)
 	
 	if((other_obj->type == OBJ_WEAPON) && !(Weapons[other_obj->instance].weapon_flags[Weapon::Weapon_Flags::Already_applied_stats])){		
 		// bogus weapon
-		if(other_obj->instance >= MAX_WEAPONS){
+		if(other_obj->instance >= Weapons.capacity()){
 			return;
 		}
 
@@ -1423,7 +1423,7 @@ void scoring_eval_hit(object *hit_obj, object *other_obj,int from_blast)
 		if(hit_obj->type == OBJ_WEAPON){
 
 			//Hit weapon is bogus
-			if (hit_obj->instance >= MAX_WEAPONS) {
+			if (hit_obj->instance >= Weapons.capacity()) {
 				return;
 			}	
 
@@ -48,14 +48,17 @@ Category ShipPostMove("Ship post move", false);
 Category FireballPostMove("Fireball post move", false);
 Category DebrisPostMove("Debris post move", false);
 Category AsteroidPostMove("Asteroid post move", false);
+Category AsteroidFieldRocks("Asteroid field rocks", false);
 Category PreMove("Pre Move", false);
 Category Physics("Physics", false);
 Category PostMove("Post Move", false);
 Category CollisionDetection("Collision Detection", false);
+Category GatherTurretTargets("Gather turret targets", false);
 
 Category RenderBuffer("Render Buffer", true);
 
 Category QueueRender("Queue Render", false);
+Category CullObjects("Cull Objects", false);
 Category BuildModelUniforms("Build Model Uniforms", false);
 Category UploadModelUniforms("Upload Model Uniforms", true);
 Category SubmitDraws("Submit Draws", true);
@@ -126,9 +129,13 @@ Category ReadModelFile("Read model file", false);
 Category ModelCreateVertexBuffers("Create model vertex buffers", false);
 Category ModelParseAllBSPTrees("Parse all BSP trees", false);
 Category ModelParseBSPTree("Parse BSP tree", false);
+Category ModelGenerateVertexBuffers("Model generate vertex buffers", false);
 Category ModelConfigureVertexBuffers("Model configure vertex buffers", false);
 Category ModelCreateTransparencyIndexBuffer("Model create transparency buffer", false);
 Category ModelCreateDetailIndexBuffers("Model create detail index buffers", false);
+Category ModelCacheLoad("Load cached model data", false);
+Category ModelCacheStore("Store cached model data", false);
+Category ModelFinishPendingLoads("Finish pending model loads", false);
 
 Category PreloadMissionSounds("Preload mission sounds", false);
 Category LoadSound("Load Sound", false);
@@ -61,14 +61,17 @@ extern Category ShipPostMove;
 extern Category FireballPostMove;
 extern Category DebrisPostMove;
 extern Category AsteroidPostMove;
+extern Category AsteroidFieldRocks;
 extern Category PreMove;
 extern Category Physics;
 extern Category PostMove;
 extern Category CollisionDetection;
+extern Category GatherTurretTargets;
 
 extern Category RenderBuffer;
 
 extern Category QueueRender;
+extern Category CullObjects;
 extern Category BuildModelUniforms;
 extern Category UploadModelUniforms;
 extern Category SubmitDraws;
@@ -140,9 +143,13 @@ extern Category ReadModelFile;
 extern Category ModelCreateVertexBuffers;
 extern Category ModelParseAllBSPTrees;
 extern Category ModelParseBSPTree;
+extern Category ModelGenerateVertexBuffers;
 extern Category ModelConfigureVertexBuffers;
 extern Category ModelCreateTransparencyIndexBuffer;
 extern Category ModelCreateDetailIndexBuffers;
+extern Category ModelCacheLoad;
+extern Category ModelCacheStore;
+extern Category ModelFinishPendingLoads;
 
 extern Category PreloadMissionSounds;
 extern Category LoadSound;
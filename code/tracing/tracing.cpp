@@ -8,6 +8,7 @@
 #include "MainFrameTimer.h"
 #include "FrameProfiler.h"
 
+#include <atomic>
 #include <cinttypes>
 #include <fstream>
 #include <future>
@@ -106,7 +107,8 @@ int gpu_start_query = -1;
 std::uint64_t gpu_start_time = 0;
 std::uint64_t cpu_start_time = 0;
 
-std::uint64_t current_id = 0;
+// Events may also be generated by worker threads
+std::atomic<std::uint64_t> current_id(0);
 
 void submit_event(trace_event* evt) {
 	if (evt->pid == GPU_PID) {
@@ -0,0 +1,228 @@
+#pragma once
+
+#include "globalincs/pstypes.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace util {
+
+/**
+ * @brief Refers to a slot of a chunked_pool and stays recognizable as stale after the slot was freed
+ */
+struct pool_handle {
+	int index = -1;
+	std::uint32_t generation = 0;
+
+	inline bool isValid() const { return index >= 0; }
+
+	friend bool operator==(const pool_handle& a, const pool_handle& b)
+	{
+		return a.index == b.index && a.generation == b.generation;
+	}
+	friend bool operator!=(const pool_handle& a, const pool_handle& b) { return !(a == b); }
+};
+
+/**
+ * @brief A growable array of slots for game objects which are created and destroyed all the time
+ *
+ * Slots are stored in chunks of ChunkSize elements and new chunks are only added if all slots are in use. Elements
+ * never move so pointers to them (e.g. the nodes of an intrusive linked list) stay valid when the pool grows. Slots
+ * are addressed with an int index like the fixed arrays this replaces.
+ *
+ * The indices of the used slots are also kept in a dense list so code which needs to visit every live element does not
+ * have to skip over the free slots.
+ *
+ * Every slot has a generation counter which is incremented when the slot is freed. A pool_handle stores the generation
+ * of the slot when it was created so it can be used instead of an index and signature check.
+ *
+ * If IndexMember is set, the pool stores the index of every slot in that member of its element so index_of() does not
+ * have to search the chunks. The member must not be changed by anything else.
+ *
+ * @note Slots are value initialized when their chunk is created but they are not reset when they are reused. Freeing
+ * a slot does not destroy the element either, the element is only destroyed when the pool is cleared.
+ */
+template <typename T, int ChunkSize = 256, int T::*IndexMember = nullptr>
+class chunked_pool {
+	static_assert(ChunkSize > 0, "The chunk size must be positive!");
+
+  public:
+	chunked_pool() = default;
+
+	chunked_pool(const chunked_pool&) = delete;
+	chunked_pool& operator=(const chunked_pool&) = delete;
+
+	/**
+	 * @brief Gets a free slot, adding a chunk if all slots are in use
+	 * @return The index of the slot
+	 */
+	int allocate()
+	{
+		if (_free.empty()) {
+			grow();
+		}
+
+		auto index = _free.back();
+		_free.pop_back();
+
+		_dense_position[index] = static_cast<int>(_used.size());
+		_used.push_back(index);
+
+		if (IndexMember != nullptr) {
+			(*this)[index].*IndexMember = index;
+		}
+
+		return index;
+	}
+
+	/**
+	 * @brief Returns a slot to the pool
+	 *
+	 * Handles of the slot are invalidated. The index may be returned by the next allocate() call.
+	 */
+	void free(int index)
+	{
+		Assertion(in_use(index), "Slot %d of the pool is not in use!", index);
+
+		// Move the last used index into the position of the freed one
+		auto position = _dense_position[index];
+		auto last     = _used.back();
+
+		_used[position]        = last;
+		_dense_position[last]  = position;
+		_used.pop_back();
+		_dense_position[index] = -1;
+
+		++_generations[index];
+		_free.push_back(index);
+	}
+
+	/**
+	 * @brief Frees all slots and releases the memory of the elements
+	 *
+	 * Handles created before this stay invalid even though the indices will be used again.
+	 */
+	void clear()
+	{
+		for (auto& generation : _generations) {
+			++generation;
+		}
+		_chunks.clear();
+		_dense_position.clear();
+		_used.clear();
+		_free.clear();
+	}
+
+	bool in_use(int index) const
+	{
+		return index >= 0 && index < capacity() && _dense_position[index] >= 0;
+	}
+
+	inline T& operator[](int index)
+	{
+		Assertion(index >= 0 && index < capacity(), "Pool index %d is out of range!", index);
+		return _chunks[index / ChunkSize][index % ChunkSize];
+	}
+	inline const T& operator[](int index) const
+	{
+		Assertion(index >= 0 && index < capacity(), "Pool index %d is out of range!", index);
+		return _chunks[index / ChunkSize][index % ChunkSize];
+	}
+
+	/**
+	 * @brief The number of slots, used or not. Every index below this may be accessed.
+	 */
+	inline int capacity() const { return static_cast<int>(_chunks.size()) * ChunkSize; }
+
+	/**
+	 * @brief The number of used slots
+	 */
+	inline int size() const { return static_cast<int>(_used.size()); }
+
+	/**
+	 * @brief The indices of all used slots in no particular order
+	 *
+	 * @warning Freeing a slot changes the order so do not free slots while iterating over this.
+	 */
+	inline const SCP_vector<int>& used() const { return _used; }
+
+	pool_handle handle(int index) const
+	{
+		Assertion(in_use(index), "Slot %d of the pool is not in use!", index);
+
+		pool_handle h;
+		h.index      = index;
+		h.generation = _generations[index];
+		return h;
+	}
+
+	/**
+	 * @brief Gets the element of a handle
+	 * @return The element or nullptr if the slot was freed since the handle was created
+	 */
+	T* get(const pool_handle& h)
+	{
+		if (!in_use(h.index) || _generations[h.index] != h.generation) {
+			return nullptr;
+		}
+		return &(*this)[h.index];
+	}
+
+	/**
+	 * @brief Gets the index of an element of this pool from its address
+	 *
+	 * This is constant time if the pool has an IndexMember, otherwise the chunks are searched for the address.
+	 *
+	 * @return The index or -1 if the pointer does not point into the pool
+	 */
+	int index_of(const T* ptr) const
+	{
+		if (IndexMember != nullptr) {
+			auto index = ptr->*IndexMember;
+			if (index >= 0 && index < capacity() && &(*this)[index] == ptr) {
+				return index;
+			}
+			return -1;
+		}
+
+		for (size_t chunk = 0; chunk < _chunks.size(); ++chunk) {
+			const T* begin = _chunks[chunk].get();
+			if (ptr >= begin && ptr < begin + ChunkSize) {
+				return static_cast<int>(chunk) * ChunkSize + static_cast<int>(ptr - begin);
+			}
+		}
+		return -1;
+	}
+
+  private:
+	void grow()
+	{
+		auto first = capacity();
+
+		_chunks.emplace_back(new T[ChunkSize]());
+		_dense_position.resize(capacity(), -1);
+		if (static_cast<int>(_generations.size()) < capacity()) {
+			_generations.resize(capacity(), 0);
+		}
+
+		if (IndexMember != nullptr) {
+			for (int index = first; index < capacity(); ++index) {
+				(*this)[index].*IndexMember = index;
+			}
+		}
+
+		// Reversed so the lowest index is handed out first
+		for (int index = capacity() - 1; index >= first; --index) {
+			_free.push_back(index);
+		}
+	}
+
+	SCP_vector<std::unique_ptr<T[]>> _chunks;
+
+	SCP_vector<std::uint32_t> _generations; // Kept when the pool is cleared so old handles stay invalid
+	SCP_vector<int> _dense_position;        // The position of a slot in _used or -1 if the slot is free
+	SCP_vector<int> _used;
+	SCP_vector<int> _free;
+};
+
+} // namespace util
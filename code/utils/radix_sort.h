@@ -0,0 +1,65 @@
+#pragma once
+
+#include "globalincs/vmallocator.h"
+
+#include <array>
+#include <cstdint>
+
+namespace util {
+
+/**
+ * @brief Sorts values by an unsigned 64-bit key using a stable LSD radix sort
+ *
+ * The key is extracted once per value and pass so it should be cheap to compute, usually it will be a member of the
+ * value. Passes in which all keys have the same byte are skipped so keys which only use their lower bits are cheaper to
+ * sort.
+ *
+ * @param values The values to sort
+ * @param scratch Temporary storage. Pass the same vector every time to avoid reallocating it.
+ * @param key Returns the key of a value
+ */
+template <typename T, typename KeyFunc>
+void radix_sort(SCP_vector<T>& values, SCP_vector<T>& scratch, KeyFunc key)
+{
+	constexpr size_t NUM_PASSES  = sizeof(std::uint64_t);
+	constexpr size_t NUM_BUCKETS = 256;
+
+	if (values.size() < 2) {
+		return;
+	}
+
+	std::array<std::array<size_t, NUM_BUCKETS>, NUM_PASSES> histograms{};
+	for (const auto& value : values) {
+		auto k = key(value);
+		for (size_t pass = 0; pass < NUM_PASSES; ++pass) {
+			++histograms[pass][(k >> (pass * 8)) & 0xFF];
+		}
+	}
+
+	scratch.resize(values.size());
+
+	for (size_t pass = 0; pass < NUM_PASSES; ++pass) {
+		auto& histogram = histograms[pass];
+
+		// if every key has the same byte here then this pass would not change anything
+		const auto first_byte = (key(values.front()) >> (pass * 8)) & 0xFF;
+		if (histogram[first_byte] == values.size()) {
+			continue;
+		}
+
+		size_t offset = 0;
+		for (auto& count : histogram) {
+			const auto bucket_size = count;
+			count                  = offset;
+			offset += bucket_size;
+		}
+
+		for (auto& value : values) {
+			scratch[histogram[(key(value) >> (pass * 8)) & 0xFF]++] = std::move(value);
+		}
+
+		values.swap(scratch);
+	}
+}
+
+} // namespace util
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "globalincs/pstypes.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace util {
+
+/**
+ * @brief Hands out runs of consecutive elements which live until the arena is cleared
+ *
+ * Runs are cut from large blocks so the elements of one run are next to each other in memory and runs allocated one
+ * after another usually are as well. A freed run is kept and handed out again for the next run with the same length,
+ * which is the common case when the runs belong to objects of the same class. Memory is only released by clear().
+ *
+ * @note Elements are value initialized when their block is created but they are not reset when a run is reused.
+ */
+template <typename T, int BlockSize = 256>
+class run_arena {
+	static_assert(BlockSize > 0, "The block size must be positive!");
+
+  public:
+	run_arena() = default;
+
+	run_arena(const run_arena&) = delete;
+	run_arena& operator=(const run_arena&) = delete;
+
+	/**
+	 * @brief Gets a run of count consecutive elements
+	 * @return The first element of the run or nullptr if count is zero
+	 */
+	T* allocate(int count)
+	{
+		Assertion(count >= 0, "Cannot allocate a run of %d elements!", count);
+		if (count == 0) {
+			return nullptr;
+		}
+
+		_in_use += count;
+
+		auto free_runs = _free_runs.find(count);
+		if (free_runs != _free_runs.end() && !free_runs->second.empty()) {
+			auto run = free_runs->second.back();
+			free_runs->second.pop_back();
+			return run;
+		}
+
+		reserve(count);
+
+		auto run = _blocks.back().get() + _block_used;
+		_block_used += count;
+		return run;
+	}
+
+	/**
+	 * @brief Gives a run back to the arena so it can be handed out again
+	 * @param run The value returned by allocate()
+	 * @param count The length the run was allocated with
+	 */
+	void free(T* run, int count)
+	{
+		if (run == nullptr) {
+			return;
+		}
+		Assertion(count > 0 && count <= _in_use, "Invalid length %d of a freed run!", count);
+
+		_in_use -= count;
+		_free_runs[count].push_back(run);
+	}
+
+	/**
+	 * @brief Makes sure the next runs with a total length of count fit into the current block
+	 *
+	 * Used to get the memory for everything that will be needed at once instead of spread over several blocks.
+	 */
+	void reserve(int count)
+	{
+		if (!_blocks.empty() && _block_size - _block_used >= count) {
+			return;
+		}
+
+		_block_size = std::max(count, BlockSize);
+		_block_used = 0;
+		_blocks.emplace_back(new T[_block_size]());
+		_allocated += _block_size;
+	}
+
+	/**
+	 * @brief Releases all memory. Every run handed out before is invalid after this.
+	 */
+	void clear()
+	{
+		_blocks.clear();
+		_free_runs.clear();
+		_block_size = 0;
+		_block_used = 0;
+		_allocated  = 0;
+		_in_use     = 0;
+	}
+
+	/**
+	 * @brief The number of elements in all blocks
+	 */
+	inline int allocated() const { return _allocated; }
+
+	/**
+	 * @brief The number of elements in runs which were not freed
+	 */
+	inline int in_use() const { return _in_use; }
+
+  private:
+	SCP_vector<std::unique_ptr<T[]>> _blocks;
+	SCP_unordered_map<int, SCP_vector<T*>> _free_runs; // Freed runs by length
+
+	int _block_size = 0; // Size of the last block, the only one runs are still cut from
+	int _block_used = 0;
+
+	int _allocated = 0;
+	int _in_use    = 0;
+};
+
+} // namespace util
@@ -17,6 +17,17 @@ template <std::size_t I = 0, typename FuncT, typename... Tp>
 	for_each<I + 1, FuncT, Tp...>(t, f);
 }
 
+template <std::size_t I = 0, typename FuncT, typename... Tp>
+inline typename std::enable_if<I == sizeof...(Tp), void>::type for_each(std::tuple<Tp...>&, FuncT)
+{
+}
+template <std::size_t I = 0, typename FuncT, typename... Tp>
+	inline typename std::enable_if < I<sizeof...(Tp), void>::type for_each(std::tuple<Tp...>& t, FuncT f)
+{
+	f(std::get<I>(t));
+	for_each<I + 1, FuncT, Tp...>(t, f);
+}
+
 template <std::size_t I = 0, typename FuncT, typename... Tp>
 inline typename std::enable_if<I == sizeof...(Tp), void>::type for_each(std::tuple<Tp...>&&, FuncT)
 {
@@ -35,6 +35,7 @@
 #include "network/multimsgs.h"
 #include "object/objcollide.h"
 #include "object/object.h"
+#include "object/objectbounds.h"
 #include "object/objectshield.h"
 #include "parse/parselo.h"
 #include "scripting/global_hooks.h"
@@ -68,8 +69,7 @@
 
 #define TOOLTIME						1500.0f
 
-std::array<beam, MAX_BEAMS> Beams;				// all beams
-beam Beam_free_list;					// free beams
+util::chunked_pool<beam, 64, &beam::pool_index> Beams;	// all beams, grows when they are all in use
 beam Beam_used_list;					// used beams
 int Beam_count = 0;					// how many beams are in use
 
@@ -228,18 +228,9 @@ void beam_init()
 void beam_level_init()
 {
 	// intialize beams
-	int idx;
-
 	Beam_count = 0;
-	list_init( &Beam_free_list );
 	list_init( &Beam_used_list );
-	Beams.fill({});
-
-	// Link all object slots into the free list
-	for (idx=0; idx<MAX_BEAMS; idx++)	{
-		Beams[idx].objnum = -1;
-		list_append(&Beam_free_list, &Beams[idx] );
-	}
+	Beams.clear();
 
 	// reset muzzle particle spew timestamp
 }
@@ -248,7 +239,6 @@ void beam_level_init()
 void beam_level_close()
 {
 	// clear the beams
-	list_init( &Beam_free_list );
 	list_init( &Beam_used_list );
 }
 
@@ -356,11 +346,6 @@ int beam_fire(beam_fire_info *fire_info)
 		return -1;
 	}
 
-	// if we're out of beams, bail
-	if(Beam_count >= MAX_BEAMS){
-		return -1;
-	}
-
 	// make sure the beam_info_index is valid
 	if ((fire_info->beam_info_index < 0) || (fire_info->beam_info_index >= weapon_info_size()) || !(Weapon_info[fire_info->beam_info_index].wi_flags[Weapon::Info_Flags::Beam])) {
 		UNREACHABLE("beam_info_index (%d) invalid (either <0, >= %d, or not actually a beam)!\n", fire_info->beam_info_index, weapon_info_size());
@@ -408,13 +393,6 @@ int beam_fire(beam_fire_info *fire_info)
 		firing_ship = &Ships[fire_info->shooter->instance];
 	}
 
-	// get a free beam
-	new_item = GET_FIRST(&Beam_free_list);
-	Assert( new_item != &Beam_free_list );		// shouldn't have the dummy element
-	if(new_item == &Beam_free_list){
-		return -1;
-	}
-
 	// make sure that our textures are loaded as well
 	extern bool weapon_is_used(int weapon_index);
 	extern void weapon_load_bitmaps(int weapon_index);
@@ -422,8 +400,8 @@ int beam_fire(beam_fire_info *fire_info)
 		weapon_load_bitmaps(fire_info->beam_info_index);
 	}
 
-	// remove from the free list
-	list_remove( &Beam_free_list, new_item );
+	// get a free beam
+	new_item = &Beams[Beams.allocate()];
 	
 	// insert onto the end of used list
 	list_append( &Beam_used_list, new_item );
@@ -442,6 +420,10 @@ int beam_fire(beam_fire_info *fire_info)
 	new_item->life_total = wip->b_info.beam_life;
 	new_item->r_collision_count = 0;
 	new_item->f_collision_count = 0;
+	new_item->stop_dist = -1.0f;
+	new_item->stop_objnum = -1;
+	new_item->stop_sig = 0;
+	new_item->stop_checked_objnum = -1;
 	new_item->target = fire_info->target;
 	new_item->target_subsys = fire_info->target_subsys;
 	new_item->target_sig = (fire_info->target != NULL) ? fire_info->target->signature : 0;
@@ -586,11 +568,6 @@ int beam_fire_targeting(fighter_beam_fire_info *fire_info)
 		return -1;
 	}
 
-	// if we're out of beams, bail
-	if(Beam_count >= MAX_BEAMS){
-		return -1;
-	}
-	
 	// make sure the beam_info_index is valid
 	Assert((fire_info->beam_info_index >= 0) && (fire_info->beam_info_index < weapon_info_size()) && (Weapon_info[fire_info->beam_info_index].wi_flags[Weapon::Info_Flags::Beam]));
 	if((fire_info->beam_info_index < 0) || (fire_info->beam_info_index >= weapon_info_size()) || !(Weapon_info[fire_info->beam_info_index].wi_flags[Weapon::Info_Flags::Beam])){
@@ -607,11 +584,7 @@ int beam_fire_targeting(fighter_beam_fire_info *fire_info)
 
 
 	// get a free beam
-	new_item = GET_FIRST(&Beam_free_list);
-	Assert( new_item != &Beam_free_list );		// shouldn't have the dummy element
-
-	// remove from the free list
-	list_remove( &Beam_free_list, new_item );
+	new_item = &Beams[Beams.allocate()];
 	
 	// insert onto the end of used list
 	list_append( &Beam_used_list, new_item );
@@ -636,6 +609,10 @@ int beam_fire_targeting(fighter_beam_fire_info *fire_info)
 	new_item->life_total = fire_info->life_total;
 	new_item->r_collision_count = 0;
 	new_item->f_collision_count = 0;
+	new_item->stop_dist = -1.0f;
+	new_item->stop_objnum = -1;
+	new_item->stop_sig = 0;
+	new_item->stop_checked_objnum = -1;
 	new_item->target = NULL;
 	new_item->target_subsys = NULL;
 	new_item->target_sig = 0;
@@ -726,7 +703,7 @@ int beam_get_weapon_info_index(object *bm)
 		return -1;
 	}
 
-	Assert(bm->instance >= 0 && bm->instance < MAX_BEAMS);
+	Assert(bm->instance >= 0 && bm->instance < Beams.capacity());
 	if (bm->instance < 0) {
 		return -1;
 	}
@@ -747,7 +724,7 @@ int beam_get_num_collisions(int objnum)
 		Int3();
 		return -1;
 	}
-	if((Objects[objnum].instance < 0) || (Objects[objnum].instance >= MAX_BEAMS)){
+	if((Objects[objnum].instance < 0) || (Objects[objnum].instance >= Beams.capacity())){
 		Int3();
 		return -1;
 	}
@@ -773,7 +750,7 @@ int beam_get_collision(int objnum, int num, int *collision_objnum, mc_info **cin
 		Int3();
 		return 0;
 	}
-	if((Objects[objnum].instance < 0) || (Objects[objnum].instance >= MAX_BEAMS)){
+	if((Objects[objnum].instance < 0) || (Objects[objnum].instance >= Beams.capacity())){
 		Int3();
 		return 0;
 	}
@@ -1094,6 +1071,8 @@ void beam_move_all_pre()
 
 		// unset collision info
 		b->f_collision_count = 0;
+		b->stop_dist = -1.0f;
+		b->stop_checked_objnum = -1;
 
 		if ( !physics_paused ) {
 			// make sure to check that firingpoint is still properly set
@@ -1146,6 +1125,11 @@ void beam_move_all_pre()
 			}
 		}
 
+		// the beam was aimed after all objects were moved
+		if (b->objnum >= 0) {
+			obj_bounds_update(&Objects[b->objnum]);
+		}
+
 		// next
 		moveup = GET_NEXT(moveup);
 	}
@@ -2051,9 +2035,8 @@ void beam_apply_lighting()
 // delete a beam
 void beam_delete(beam *b)
 {
-	// remove from active list and put on free list
+	// remove from active list, the slot is returned to the pool below
 	list_remove(&Beam_used_list, b);
-	list_append(&Beam_free_list, b);
 
 	// delete our associated object
 	if(b->objnum >= 0){
@@ -2075,6 +2058,8 @@ void beam_delete(beam *b)
         b->subsys->turret_animation_done_time = timestamp(50);
     }
 
+	Beams.free(BEAM_INDEX(b));
+
 	// subtract one
 	Beam_count--;
 	Assert(Beam_count >= 0);
@@ -2911,6 +2896,43 @@ void beam_jitter_aim(beam *b, float aim)
 // BEAM COLLISION FUNCTIONS
 // -----------------------------===========================------------------------------
 
+// whether a hit on this object ends the beam instead of letting it continue behind the object
+static bool beam_stops_at(beam *b, object *objp)
+{
+	float width = b->beam_collide_width * b->current_width_factor;
+
+	// if the radius of the target is somewhat close to the radius of the beam, "stop" the beam here
+	// for now : if its smaller than about 1/3 the radius of the ship
+	return (width <= objp->radius * BEAM_AREA_PERCENT) && !beam_will_tool_target(b, objp);
+}
+
+// whether the collision of a beam with this object doesn't need to be checked (again) this frame
+static bool beam_skip_collision(const beam *b, const object *objp)
+{
+	// it was the object which stopped the beam last frame and has been checked by beam_collide_previous_stops()
+	if (b->stop_checked_objnum == OBJ_INDEX(objp)) {
+		return true;
+	}
+
+	// nothing stopped the beam so far
+	if (b->stop_dist < 0.0f) {
+		return false;
+	}
+
+	// the radius is scaled like in beam_collide_early_out() so shields sticking out of the object are still hit
+	return beam_sphere_behind_stop(b, &objp->pos, objp->radius * 1.2f);
+}
+
+bool beam_sphere_behind_stop(const beam *b, const vec3d *pos, float radius)
+{
+	if (b->stop_dist < 0.0f) {
+		return false;
+	}
+
+	float beam_radius = b->beam_collide_width * b->current_width_factor * 0.5f;
+	return vm_vec_dist(&b->last_start, pos) - radius - beam_radius - COLLISION_PREFILTER_SLACK > b->stop_dist;
+}
+
 // collide a beam with a ship, returns 1 if we can ignore all future collisions between the 2 objects
 int beam_collide_ship(obj_pair *pair)
 {
@@ -2983,6 +3005,12 @@ int beam_collide_ship(obj_pair *pair)
 	if (shipp->flags[Ship::Ship_Flags::Arriving_stage_1])
 		return 0;
 
+	// already checked this frame or behind where the beam ends
+	if (beam_skip_collision(a_beam, pair->b)) {
+		pair->next_check_time = timestamp(0);
+		return 0;
+	}
+
 	int quadrant_num = -1;
 	bool valid_hit_occurred = false;
 	sip = &Ship_info[shipp->ship_info_index];
@@ -3240,6 +3268,12 @@ int beam_collide_asteroid(obj_pair *pair)
 	Beam_test_ast++;
 #endif
 
+	// already checked this frame or behind where the beam ends
+	if (beam_skip_collision(a_beam, pair->b)) {
+		pair->next_check_time = timestamp(0);
+		return 0;
+	}
+
 	// do the collision
 	mc_info test_collide;
 	test_collide.model_instance_num = -1;
@@ -3348,6 +3382,12 @@ int beam_collide_missile(obj_pair *pair)
 	Beam_test_ints++;
 #endif
 
+	// already checked this frame or behind where the beam ends
+	if (beam_skip_collision(a_beam, pair->b)) {
+		pair->next_check_time = timestamp(0);
+		return 0;
+	}
+
 	// do the collision
 	mc_info test_collide;
 	test_collide.model_instance_num = -1;
@@ -3457,6 +3497,12 @@ int beam_collide_debris(obj_pair *pair)
 	Beam_test_ints++;
 #endif
 
+	// already checked this frame or behind where the beam ends
+	if (beam_skip_collision(a_beam, pair->b)) {
+		pair->next_check_time = timestamp(0);
+		return 0;
+	}
+
 	// do the collision
 	mc_info test_collide;
 	test_collide.model_instance_num = -1;
@@ -3605,41 +3651,123 @@ int beam_collide_early_out(object *a, object *b)
 	return 0;
 }
 
+// collide every beam with the object which stopped it last frame, before all other collision pairs are checked. the beam
+// most likely ends there again so the pairs which come afterwards can be skipped by beam_skip_collision() right away
+void beam_collide_previous_stops()
+{
+	for (auto b: list_range(&Beam_used_list)) {
+		if ((b->objnum < 0) || (b->stop_objnum < 0)) {
+			continue;
+		}
+
+		object *beam_objp = &Objects[b->objnum];
+		object *objp = &Objects[b->stop_objnum];
+		if ((objp->signature != b->stop_sig) || (objp->type == OBJ_NONE) || objp->flags[Object::Object_Flags::Should_be_dead]) {
+			continue;
+		}
+
+		// the same checks obj_collide_pair() does before it gets to the beam
+		if (!beam_objp->flags[Object::Object_Flags::Collides] || !objp->flags[Object::Object_Flags::Collides]) {
+			continue;
+		}
+		if (reject_obj_pair_on_parent(beam_objp, objp) || reject_due_collision_groups(beam_objp, objp) || beam_collide_early_out(beam_objp, objp)) {
+			continue;
+		}
+
+		obj_pair pair;
+		pair.a = beam_objp;
+		pair.b = objp;
+		pair.next_check_time = timestamp(0);
+		pair.next = nullptr;
+
+		switch (objp->type) {
+		case OBJ_SHIP:
+			beam_collide_ship(&pair);
+			break;
+		case OBJ_ASTEROID:
+			beam_collide_asteroid(&pair);
+			break;
+		case OBJ_DEBRIS:
+			beam_collide_debris(&pair);
+			break;
+		case OBJ_WEAPON:
+			beam_collide_missile(&pair);
+			break;
+		default:
+			continue;
+		}
+
+		// don't let the regular pair add the same collision again
+		b->stop_checked_objnum = b->stop_objnum;
+	}
+}
+
 // add a collision to the beam for this frame (to be evaluated later)
 // Goober5000 - erg.  Rearranged for clarity, and also to fix a bug that caused is_exit_collision to hardly ever be assigned,
 // resulting in "tooled" ships taking twice as much damage (in a later function) as they should.
 void beam_add_collision(beam *b, object *hit_object, mc_info *cinfo, int quadrant_num, bool exit_flag)
+{
+	// if this object is going to stop the beam (see beam_handle_collisions()) nothing behind the hit matters anymore
+	bool stops = !exit_flag && beam_stops_at(b, hit_object);
+
+	beam_record_frame_collision(b, OBJ_INDEX(hit_object), cinfo, quadrant_num, exit_flag, stops);
+
+	// let the hud shield gauge know when Player or Player target is hit
+	if (quadrant_num >= 0)
+		hud_shield_quadrant_hit(hit_object, quadrant_num);
+}
+
+beam_collision *beam_record_frame_collision(beam *b, int objnum, const mc_info *cinfo, int quadrant_num, bool exit_flag, bool stops_beam)
 {
 	beam_collision *bc = nullptr;
-	int idx;
+	bool replaced = false;
 
 	// if we haven't reached the limit for beam collisions, just add it
 	if (b->f_collision_count < MAX_FRAME_COLLISIONS) {
 		bc = &b->f_collisions[b->f_collision_count++];
 	}
-	// otherwise, we've got to do some checking, ick. 
-	// I guess we can always just remove the farthest item
+	// otherwise keep the nearest ones. the collisions behind them can't matter as much
 	else {
-		for (idx = 0; idx < MAX_FRAME_COLLISIONS; idx++) {
+		for (int idx = 0; idx < MAX_FRAME_COLLISIONS; idx++) {
 			if ((bc == nullptr) || (b->f_collisions[idx].cinfo.hit_dist > bc->cinfo.hit_dist))
 				bc = &b->f_collisions[idx];
 		}
-	}
 
-	if (bc == nullptr) {
-		Int3();
-		return;
+		if (cinfo->hit_dist >= bc->cinfo.hit_dist) {
+			return nullptr;
+		}
+		replaced = true;
 	}
 
 	// copy in
-	bc->c_objnum = OBJ_INDEX(hit_object);
+	bc->c_objnum = objnum;
 	bc->cinfo = *cinfo;
 	bc->quadrant = quadrant_num;
 	bc->is_exit_collision = exit_flag;
+	bc->stops_beam = stops_beam;
+
+	float length = vm_vec_dist(&b->last_start, &b->last_shot);
+
+	if (replaced) {
+		// the collision which was dropped may have been the one the beam stopped at
+		b->stop_dist = -1.0f;
+		for (int idx = 0; idx < b->f_collision_count; idx++) {
+			const beam_collision &other = b->f_collisions[idx];
+			if (other.stops_beam) {
+				float dist = other.cinfo.hit_dist * length;
+				if (b->stop_dist < 0.0f || dist < b->stop_dist) {
+					b->stop_dist = dist;
+				}
+			}
+		}
+	} else if (stops_beam) {
+		float dist = cinfo->hit_dist * length;
+		if (b->stop_dist < 0.0f || dist < b->stop_dist) {
+			b->stop_dist = dist;
+		}
+	}
 
-	// let the hud shield gauge know when Player or Player target is hit
-	if (quadrant_num >= 0)
-		hud_shield_quadrant_hit(hit_object, quadrant_num);
+	return bc;
 }
 
 // sort collisions for the frame
@@ -3657,6 +3785,9 @@ void beam_handle_collisions(beam *b)
 	weapon_info *wi;
 	float width;	
 
+	// nothing stopped the beam unless we find otherwise below
+	b->stop_objnum = -1;
+
 	// early out if we had no collisions
 	if(b->f_collision_count <= 0){
 		return;
@@ -3717,6 +3848,7 @@ void beam_handle_collisions(beam *b)
 		r_coll[r_coll_count].cinfo = b->f_collisions[idx].cinfo;
 		r_coll[r_coll_count].quadrant = -1;
 		r_coll[r_coll_count].is_exit_collision = false;
+		r_coll[r_coll_count].stops_beam = b->f_collisions[idx].stops_beam;
 		
 		// if he was already on the recent collision list, copy his timestamp
 		// also, be sure not to play the impact sound again.
@@ -3994,12 +4126,15 @@ void beam_handle_collisions(beam *b)
 		}				
 
 		// if the radius of the target is somewhat close to the radius of the beam, "stop" the beam here
-		// for now : if its smaller than about 1/3 the radius of the ship
-		if(width <= (Objects[target].radius * BEAM_AREA_PERCENT) && !beam_will_tool_target(b, &Objects[target])){
+		if(beam_stops_at(b, &Objects[target])){
 			// set last_shot so we know where to properly draw the beam		
 			b->last_shot = b->f_collisions[idx].cinfo.hit_point_world;
 			Assert(is_valid_vec(&b->last_shot));		
 
+			// check this one first next frame
+			b->stop_objnum = target;
+			b->stop_sig = Objects[target].signature;
+
 			// done wif the beam
 			break;
 		}
@@ -17,6 +17,7 @@
 //
 #include "globalincs/globals.h"
 #include "model/model.h"
+#include "utils/chunked_pool.h"
 
 // prototypes
 class object;
@@ -61,7 +62,6 @@ typedef enum class BeamType {
 
 // max # of "shots" an individual beam will take
 #define MAX_BEAM_SHOTS				5
-#define MAX_BEAMS					500
 
 // apply damage
 #define BEAM_DAMAGE_TIME			170
@@ -139,6 +139,7 @@ typedef struct beam_collision {
 	int				c_stamp;							// when we should next apply damage	
 	int				quadrant;						// shield quadrant this beam hits if any -Bobboau
 	bool			is_exit_collision;					//does this occur when the beam is exiting the ship
+	bool			stops_beam;							// whether the beam ends at this collision
 } beam_collision;
 
 // beam flag defines
@@ -154,7 +155,8 @@ typedef struct beam_collision {
 // beam struct (the actual weapon/object)
 typedef struct beam {
 	// low-level data
-	int		objnum;					// our own objnum
+	int		pool_index = -1;			// the slot of this beam in Beams, kept up to date by the pool
+	int		objnum = -1;				// our own objnum
 	int		weapon_info_index;
 	int		sig;						// signature for the shooting object
 	object	*objp;					// the shooting object (who owns the turret that I am being fired from)
@@ -194,6 +196,14 @@ typedef struct beam {
 	beam_collision f_collisions[MAX_FRAME_COLLISIONS];					// collisions for the current frame
 	int f_collision_count;														// # of collisions we recorded this frame
 
+	// the nearest collision this frame which ends the beam, as distance from last_start, or -1 if there is none yet.
+	// anything entirely behind it can't be hit and is not checked
+	float	stop_dist;
+	// the object which ended the beam last frame. it usually does so again, so it gets checked before everything else
+	int		stop_objnum;
+	int		stop_sig;
+	int		stop_checked_objnum;	// stop_objnum if it was already checked this frame, -1 otherwise
+
 	// looping sound info, HANDLE
 	sound_handle beam_sound_loop; // invalid if none
 
@@ -221,10 +231,10 @@ typedef struct beam {
 	WeaponState weapon_state;  
 } beam;
 
-extern std::array<beam, MAX_BEAMS> Beams;				// all beams
+extern util::chunked_pool<beam, 64, &beam::pool_index> Beams;				// all beams
 extern int Beam_count;
 
-#define BEAM_INDEX(beam)			(int)((beam) - Beams.data())
+#define BEAM_INDEX(beam)			Beams.index_of(beam)
 
 // ------------------------------------------------------------------------------------------------
 // BEAM WEAPON FUNCTIONS
@@ -256,6 +266,16 @@ int beam_get_num_collisions(int objnum);
 int beam_get_collision(int objnum, int num, int *collision_objnum, mc_info **cinfo);
 // ---------------
 
+// collide every beam with the object which stopped it last frame, called right before all other collisions are checked
+void beam_collide_previous_stops();
+
+// record a collision of this frame and update where the beam stops. once all slots are used the farthest collisions are
+// dropped, which may be the new one. returns the stored collision or nullptr if it was dropped
+beam_collision *beam_record_frame_collision(beam *b, int objnum, const mc_info *cinfo, int quadrant_num, bool exit_flag, bool stops_beam);
+
+// whether a sphere is entirely behind the point where the beam stops this frame, so it can't be hit anymore
+bool beam_sphere_behind_stop(const beam *b, const vec3d *pos, float radius);
+
 // init at game startup
 void beam_init();
 
@@ -14,6 +14,7 @@
 #include "io/timer.h"
 #include "model/modelrender.h"
 #include "nebula/neb.h"
+#include "object/objcollide.h"
 #include "object/object.h"
 #include "options/Option.h"
 #include "render/3d.h"
@@ -22,6 +23,8 @@
 #include "ship/shiphit.h"
 #include "weapon/weapon.h"
 
+#include <algorithm>
+
 // -----------------------------------------------------------
 // Module-wide globals
 // -----------------------------------------------------------
@@ -33,15 +36,15 @@ static int Default_shockwave_loaded = 0;
 
 SCP_vector<shockwave_info> Shockwave_info;
 
-shockwave Shockwaves[MAX_SHOCKWAVES];
+util::chunked_pool<shockwave, 16> Shockwaves;
 shockwave Shockwave_list;
 int Shockwave_inited = 0;
 
-// -----------------------------------------------------------
-// Function macros
-// -----------------------------------------------------------
-#define SW_INDEX(sw) (sw-Shockwaves)
-	
+static SCP_vector<shockwave_target> Shockwave_targets;		// sorted by x
+static float Shockwave_targets_max_reach;
+static SCP_vector<shockwave*> Shockwave_active;
+static SCP_vector<const shockwave_target*> Shockwave_hits;
+
 // -----------------------------------------------------------
 // Externals
 // -----------------------------------------------------------
@@ -81,14 +84,6 @@ int shockwave_create(int parent_objnum, vec3d* pos, shockwave_create_info* sci,
 	shockwave		*sw;
 	matrix			orient;
 
- 	for (i = 0; i < MAX_SHOCKWAVES; i++) {
-		if ( !(Shockwaves[i].flags & SW_USED) )
-			break;
-	}
-
-	if (i == MAX_SHOCKWAVES)
-		return -1;
-
 	// try 2D shockwave first, then fall back to 3D, then fall back to default of either
 	// this should be pretty fool-proof and allow quick change between 2D and 3D effects
 	if ( strlen(sci->name) )
@@ -118,6 +113,7 @@ int shockwave_create(int parent_objnum, vec3d* pos, shockwave_create_info* sci,
 		real_parent = parent_objnum;
 	}
 
+	i = Shockwaves.allocate();
 	sw = &Shockwaves[i];
 
 	sw->model_id = model_id;
@@ -180,11 +176,12 @@ int shockwave_create(int parent_objnum, vec3d* pos, shockwave_create_info* sci,
 void shockwave_delete(object *objp)
 {
 	Assertion(objp->type == OBJ_SHOCKWAVE, "shockwave_delete() called on an object with a type of %d instead of OBJ_SHOCKWAVE (%d); get a coder!\n", objp->type, OBJ_SHOCKWAVE);
-	Assertion(objp->instance >= 0 && objp->instance < MAX_SHOCKWAVES, "shockwave_delete() called on an object with an invalid instance of %d (should be 0-%d); get a coder!\n", objp->instance, MAX_SHOCKWAVES - 1);
+	Assertion(objp->instance >= 0 && objp->instance < Shockwaves.capacity(), "shockwave_delete() called on an object with an invalid instance of %d (should be 0-%d); get a coder!\n", objp->instance, Shockwaves.capacity() - 1);
 
 	Shockwaves[objp->instance].flags = 0;
 	Shockwaves[objp->instance].objnum = -1;	
 	list_remove(&Shockwave_list, &Shockwaves[objp->instance]);
+	Shockwaves.free(objp->instance);
 }
 
 /**
@@ -211,7 +208,7 @@ void shockwave_set_framenum(int index)
 	shockwave		*sw;
 	shockwave_info	*si;
 
-	Assertion( (index >= 0) && (index < MAX_SHOCKWAVES), "shockwave_set_framenum called with an index of %d (should be 0-%d); get a coder!\n", index, MAX_SHOCKWAVES - 1 );
+	Assertion( (index >= 0) && (index < Shockwaves.capacity()), "shockwave_set_framenum called with an index of %d (should be 0-%d); get a coder!\n", index, Shockwaves.capacity() - 1 );
 
 	sw = &Shockwaves[index];
 	si = &Shockwave_info[sw->shockwave_info_index];
@@ -232,7 +229,7 @@ int shockwave_get_framenum(const int sw_idx, const int ani_id)
 {
 	shockwave		*sw;
 
-	if ( (sw_idx < 0) || (sw_idx >= MAX_SHOCKWAVES) ) {
+	if ( (sw_idx < 0) || (sw_idx >= Shockwaves.capacity()) ) {
 		Int3();
 		return 0;
 	}
@@ -249,15 +246,15 @@ int shockwave_get_framenum(const int sw_idx, const int ani_id)
  *
  * @param shockwave_objp	object pointer that points to shockwave object
  * @param frametime			time to simulate shockwave
+ *
+ * @return true if the shockwave affects objects this frame
  */
-void shockwave_move(object *shockwave_objp, float frametime)
+static bool shockwave_move(object *shockwave_objp, float frametime)
 {
 	shockwave	*sw;
-	object		*objp;
-	float			blast,damage;
 
 	Assertion(shockwave_objp->type == OBJ_SHOCKWAVE, "shockwave_move() called on an object of type %d instead of OBJ_SHOCKWAVE (%d); get a coder!\n", shockwave_objp->type, OBJ_SHOCKWAVE);
-	Assertion(shockwave_objp->instance  >= 0 && shockwave_objp->instance < MAX_SHOCKWAVES, "shockwave_move() called on an object with an instance of %d (should be 0-%d); get a coder!\n", shockwave_objp->instance, MAX_SHOCKWAVES - 1);
+	Assertion(shockwave_objp->instance  >= 0 && shockwave_objp->instance < Shockwaves.capacity(), "shockwave_move() called on an object with an instance of %d (should be 0-%d); get a coder!\n", shockwave_objp->instance, Shockwaves.capacity() - 1);
 	sw = &Shockwaves[shockwave_objp->instance];
 
 	// if the shockwave has a delay on it
@@ -265,7 +262,7 @@ void shockwave_move(object *shockwave_objp, float frametime)
 		if(timestamp_elapsed(sw->delay_stamp)){
 			sw->delay_stamp = -1;
 		} else {
-			return;
+			return false;
 		}
 	}
 
@@ -277,109 +274,204 @@ void shockwave_move(object *shockwave_objp, float frametime)
 	if ( sw->radius > sw->outer_radius ) {
 		sw->radius = sw->outer_radius;
         shockwave_objp->flags.set(Object::Object_Flags::Should_be_dead);
-		return;
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * How far from the origin of a bounding box any point of the box can be, in any orientation.  The result is at least
+ * radius.
+ */
+float shockwave_box_reach(const vec3d *mins, const vec3d *maxs, float radius)
+{
+	vec3d corner;
+	for (int axis = 0; axis < 3; ++axis) {
+		corner.a1d[axis] = MAX(fl_abs(mins->a1d[axis]), fl_abs(maxs->a1d[axis]));
 	}
+	return MAX(radius, vm_vec_mag(&corner));
+}
+
+/**
+ * How far from its position an object can be hit by a shockwave.  weapon_area_calc_damage() measures
+ * to the bounding box of a ship, which can stick out further than its radius.
+ */
+static float shockwave_target_reach(object *objp)
+{
+	if (objp->type != OBJ_SHIP)
+		return objp->radius;
+
+	polymodel *pm = model_get(Ship_info[Ships[objp->instance].ship_info_index].model_num);
+
+	return shockwave_box_reach(&pm->mins, &pm->maxs, objp->radius);
+}
+
+/**
+ * Gather the objects which shockwaves can affect.  This is done once per frame for all shockwaves
+ * instead of every shockwave walking the object list on its own.
+ *
+ * Objects created while the shockwaves are applied (e.g. by scripting hooks) are not gathered.  They are put on
+ * obj_create_list and only merged into obj_used_list by the next obj_move_all(), so the per shockwave walk of
+ * obj_used_list this replaces didn't see them either.  They are affected from the next frame on.
+ */
+static void shockwave_gather_targets()
+{
+	Shockwave_targets.clear();
+	Shockwave_targets_max_reach = 0.0f;
+
+	int order = 0;
+	for (auto objp : list_range(&obj_used_list)) {
+		++order;
 
-	// blast ships and asteroids
-	// And (some) weapons
-	for ( objp = GET_FIRST(&obj_used_list); objp !=END_OF_LIST(&obj_used_list); objp = GET_NEXT(objp) ) {
 		if (objp->flags[Object::Object_Flags::Should_be_dead])
 			continue;
+
+		// blast ships and asteroids
+		// And (some) weapons
 		if ( (objp->type != OBJ_SHIP) && (objp->type != OBJ_ASTEROID) && (objp->type != OBJ_WEAPON)) {
 			continue;
 		}
 
-		if(objp->type == OBJ_WEAPON) {
-			// only apply to missiles with hitpoints
-			weapon_info* wip = &Weapon_info[Weapons[objp->instance].weapon_info_index];
-			if (wip->weapon_hitpoints <= 0)
-				continue;
-
-			if (!Shockwaves_always_damage_bombs && !(wip->wi_flags[Weapon::Info_Flags::Takes_shockwave_damage] || (sw->weapon_info_index >= 0 && Weapon_info[sw->weapon_info_index].wi_flags[Weapon::Info_Flags::Ciws])))
-				continue;
+		// only apply to missiles with hitpoints
+		if ( (objp->type == OBJ_WEAPON) && (Weapon_info[Weapons[objp->instance].weapon_info_index].weapon_hitpoints <= 0) ) {
+			continue;
 		}
 
-	
 		// don't blast no-collide or navbuoys
 		if ( !objp->flags[Object::Object_Flags::Collides] || (objp->type == OBJ_SHIP && ship_get_SIF(objp->instance)[Ship::Info_Flags::Navbuoy]) ) {
 			continue;
 		}
 
-		bool found_in_list = false;
+		shockwave_target target;
+		target.objnum = OBJ_INDEX(objp);
+		target.order = order;
+		target.pos = objp->pos;
+		target.reach = shockwave_target_reach(objp);
+		Shockwave_targets.push_back(target);
 
-		// only apply damage to an object once from a shockwave
-		for (auto & comparison : sw->obj_sig_hitlist) {
-			if ( (objp->signature == comparison.first) && (objp->type == comparison.second) ){
-				found_in_list = true;
-				break;
-			}
-		}
+		Shockwave_targets_max_reach = MAX(Shockwave_targets_max_reach, target.reach);
+	}
 
-		if (found_in_list) {
-			continue;
-		}
+	std::sort(Shockwave_targets.begin(), Shockwave_targets.end(), [](const shockwave_target &a, const shockwave_target &b) {
+		return a.pos.xyz.x < b.pos.xyz.x;
+	});
+}
 
-		if ( weapon_area_calc_damage(objp, &sw->pos, sw->inner_radius, sw->outer_radius, sw->blast, sw->damage, &blast, &damage, sw->radius) == -1 ){
-			continue;
-		}
+/**
+ * Find the targets a shockwave with the given range may reach
+ *
+ * @param targets	the targets, sorted by x
+ * @param max_reach	the largest reach of all targets
+ * @param pos		the position of the shockwave
+ * @param range		the current radius of the shockwave
+ * @param hits		gets the targets whose reach overlaps the range, in object list order
+ */
+void shockwave_find_targets(const SCP_vector<shockwave_target> &targets, float max_reach, const vec3d *pos, float range, SCP_vector<const shockwave_target*> &hits)
+{
+	hits.clear();
 
-		weapon_info* wip = NULL;
-		
-		// okay, we have damage applied, record the object signature so we don't repeatedly apply damage 
-		// but only add non-ships to the list if the Game_settings flag is set
-		if (objp->type == OBJ_SHIP || Shockwaves_damage_all_obj_types_once) {
-			sw->obj_sig_hitlist.emplace_back(objp->signature, objp->type);
+	float max_x_dist = range + max_reach;
+
+	auto it = std::lower_bound(targets.cbegin(), targets.cend(), pos->xyz.x - max_x_dist, [](const shockwave_target &target, float x) {
+		return target.pos.xyz.x < x;
+	});
+	for (; it != targets.cend() && it->pos.xyz.x <= pos->xyz.x + max_x_dist; ++it) {
+		float max_dist = range + it->reach;
+		if (vm_vec_dist_squared(&it->pos, pos) <= max_dist * max_dist) {
+			hits.push_back(&*it);
 		}
+	}
 
-		switch(objp->type) {
-		case OBJ_SHIP:
-			// If we're doing an AoE Electronics shockwave, do the electronics stuff. -MageKing17
-			if ( (sw->weapon_info_index >= 0) && (Weapon_info[sw->weapon_info_index].wi_flags[Weapon::Info_Flags::Aoe_Electronics]) && !(objp->flags[Object::Object_Flags::Invulnerable]) ) {
-				weapon_do_electronics_effect(objp, &sw->pos, sw->weapon_info_index);
-			}
-			ship_apply_global_damage(objp, shockwave_objp, &sw->pos, damage, sw->damage_type_idx );
-			weapon_area_apply_blast(nullptr, objp, &sw->pos, blast, true);
-			break;
-		case OBJ_ASTEROID:
-			weapon_area_apply_blast(nullptr, objp, &sw->pos, blast, true);
-			asteroid_hit(objp, nullptr, nullptr, damage, nullptr);
-			break;
-		case OBJ_WEAPON:
-			wip = &Weapon_info[Weapons[objp->instance].weapon_info_index];
-			if (wip->armor_type_idx >= 0)
-				damage = Armor_types[wip->armor_type_idx].GetDamage(damage, shockwave_get_damage_type_idx(shockwave_objp->instance), 1.0f, false);
-
-			objp->hull_strength -= damage;
-			if (objp->hull_strength < 0.0f) {
-				Weapons[objp->instance].lifeleft = 0.001f;
-				Weapons[objp->instance].weapon_flags.set(Weapon::Weapon_Flags::Begun_detonation);
-				Weapons[objp->instance].weapon_flags.set(Weapon::Weapon_Flags::Destroyed_by_weapon);
-			}
-			break;
-		default:
-			Int3();
-			break;
+	// objects are affected in the order of the object list, like they always were
+	std::sort(hits.begin(), hits.end(), [](const shockwave_target *a, const shockwave_target *b) {
+		return a->order < b->order;
+	});
+}
+
+/**
+ * Apply a shockwave to an object it may reach
+ */
+static void shockwave_affect_object(object *shockwave_objp, shockwave *sw, object *objp)
+{
+	float			blast,damage;
+
+	// an earlier shockwave this frame may have finished it off
+	if (objp->flags[Object::Object_Flags::Should_be_dead])
+		return;
+
+	if(objp->type == OBJ_WEAPON) {
+		weapon_info* wip = &Weapon_info[Weapons[objp->instance].weapon_info_index];
+		if (!Shockwaves_always_damage_bombs && !(wip->wi_flags[Weapon::Info_Flags::Takes_shockwave_damage] || (sw->weapon_info_index >= 0 && Weapon_info[sw->weapon_info_index].wi_flags[Weapon::Info_Flags::Ciws])))
+			return;
+	}
+
+	// only apply damage to an object once from a shockwave
+	for (auto & comparison : sw->obj_sig_hitlist) {
+		if ( (objp->signature == comparison.first) && (objp->type == comparison.second) ){
+			return;
 		}
+	}
+
+	if ( weapon_area_calc_damage(objp, &sw->pos, sw->inner_radius, sw->outer_radius, sw->blast, sw->damage, &blast, &damage, sw->radius) == -1 ){
+		return;
+	}
 
-		// If this shockwave hit the player, play shockwave impact sound
-		if ( objp == Player_obj ) {
-			float full_damage, vol_scale;
-			if (sw->weapon_info_index >= 0) {
-				full_damage = Weapon_info[sw->weapon_info_index].damage;
-			} else {
-				full_damage = sw->damage;
-			}
-			if (full_damage != 0.0f) {
-				vol_scale = MAX(0.4f, damage/full_damage);
-			} else {
-				vol_scale = 1.0f;
-			}
-			if (sw->blast_sound_id.isValid()) {
-				snd_play(gamesnd_get_game_sound(sw->blast_sound_id), 0.0f, vol_scale);
-			}
+	weapon_info* wip = NULL;
+	
+	// okay, we have damage applied, record the object signature so we don't repeatedly apply damage 
+	// but only add non-ships to the list if the Game_settings flag is set
+	if (objp->type == OBJ_SHIP || Shockwaves_damage_all_obj_types_once) {
+		sw->obj_sig_hitlist.emplace_back(objp->signature, objp->type);
+	}
+
+	switch(objp->type) {
+	case OBJ_SHIP:
+		// If we're doing an AoE Electronics shockwave, do the electronics stuff. -MageKing17
+		if ( (sw->weapon_info_index >= 0) && (Weapon_info[sw->weapon_info_index].wi_flags[Weapon::Info_Flags::Aoe_Electronics]) && !(objp->flags[Object::Object_Flags::Invulnerable]) ) {
+			weapon_do_electronics_effect(objp, &sw->pos, sw->weapon_info_index);
+		}
+		ship_apply_global_damage(objp, shockwave_objp, &sw->pos, damage, sw->damage_type_idx );
+		weapon_area_apply_blast(nullptr, objp, &sw->pos, blast, true);
+		break;
+	case OBJ_ASTEROID:
+		weapon_area_apply_blast(nullptr, objp, &sw->pos, blast, true);
+		asteroid_hit(objp, nullptr, nullptr, damage, nullptr);
+		break;
+	case OBJ_WEAPON:
+		wip = &Weapon_info[Weapons[objp->instance].weapon_info_index];
+		if (wip->armor_type_idx >= 0)
+			damage = Armor_types[wip->armor_type_idx].GetDamage(damage, shockwave_get_damage_type_idx(shockwave_objp->instance), 1.0f, false);
+
+		objp->hull_strength -= damage;
+		if (objp->hull_strength < 0.0f) {
+			Weapons[objp->instance].lifeleft = 0.001f;
+			Weapons[objp->instance].weapon_flags.set(Weapon::Weapon_Flags::Begun_detonation);
+			Weapons[objp->instance].weapon_flags.set(Weapon::Weapon_Flags::Destroyed_by_weapon);
 		}
+		break;
+	default:
+		Int3();
+		break;
+	}
 
-	}	// end for
+	// If this shockwave hit the player, play shockwave impact sound
+	if ( objp == Player_obj ) {
+		float full_damage, vol_scale;
+		if (sw->weapon_info_index >= 0) {
+			full_damage = Weapon_info[sw->weapon_info_index].damage;
+		} else {
+			full_damage = sw->damage;
+		}
+		if (full_damage != 0.0f) {
+			vol_scale = MAX(0.4f, damage/full_damage);
+		} else {
+			vol_scale = 1.0f;
+		}
+		if (sw->blast_sound_id.isValid()) {
+			snd_play(gamesnd_get_game_sound(sw->blast_sound_id), 0.0f, vol_scale);
+		}
+	}
 }
 
 /**
@@ -394,7 +486,7 @@ void shockwave_render(object *objp, model_draw_list *scene)
 	vertex			p;
 
 	Assertion(objp->type == OBJ_SHOCKWAVE, "shockwave_render() called on an object of type %d instead of OBJ_SHOCKWAVE (%d); get a coder!\n", objp->type, OBJ_SHOCKWAVE);
-	Assertion(objp->instance >= 0 && objp->instance < MAX_SHOCKWAVES, "shockwave_render() called on an object with an instance of %d (should be 0-%d); get a coder!\n", objp->instance, MAX_SHOCKWAVES - 1);
+	Assertion(objp->instance >= 0 && objp->instance < Shockwaves.capacity(), "shockwave_render() called on an object with an instance of %d (should be 0-%d); get a coder!\n", objp->instance, Shockwaves.capacity() - 1);
 
 	sw = &Shockwaves[objp->instance];
 
@@ -579,12 +671,7 @@ void shockwave_level_init()
 	Assertion( ((Shockwave_info[0].bitmap_id >= 0) || (Shockwave_info[0].model_id >= 0)), "Default shockwave claims to be loaded, but has no bitmap or model; get a coder!\n" );
 
 	list_init(&Shockwave_list);
-
-	for ( i = 0; i < MAX_SHOCKWAVES; i++ ) {
-		Shockwaves[i].flags = 0;
-		Shockwaves[i].objnum = -1;
-		Shockwaves[i].model_id = -1;
-	}
+	Shockwaves.clear();
 
 	Shockwave_inited = 1;
 }
@@ -636,14 +723,33 @@ void shockwave_level_close()
 void shockwave_move_all(float frametime)
 {
 	shockwave	*sw, *next;
-	
+
+	// grow all shockwaves first...
+	Shockwave_active.clear();
+
 	sw = GET_FIRST(&Shockwave_list);
 	while ( sw != &Shockwave_list ) {
 		next = sw->next;
 		Assert(sw->objnum != -1);
-		shockwave_move(&Objects[sw->objnum], frametime);
+		if (shockwave_move(&Objects[sw->objnum], frametime)) {
+			Shockwave_active.push_back(sw);
+		}
 		sw = next;
 	}
+
+	if (Shockwave_active.empty())
+		return;
+
+	// ...then find what they reach with one set of targets sorted along x
+	shockwave_gather_targets();
+
+	for (auto active : Shockwave_active) {
+		shockwave_find_targets(Shockwave_targets, Shockwave_targets_max_reach, &active->pos, active->radius + COLLISION_PREFILTER_SLACK, Shockwave_hits);
+
+		for (auto target : Shockwave_hits) {
+			shockwave_affect_object(&Objects[active->objnum], active, &Objects[target->objnum]);
+		}
+	}
 }
 
 /**
@@ -651,7 +757,7 @@ void shockwave_move_all(float frametime)
  */
 int shockwave_get_weapon_index(int index)
 {
-	Assertion( (index >= 0) && (index < MAX_SHOCKWAVES), "shockwave_get_weapon_index() called on an index of %d (should be 0-%d); get a coder!\n", index, MAX_SHOCKWAVES - 1 );
+	Assertion( (index >= 0) && (index < Shockwaves.capacity()), "shockwave_get_weapon_index() called on an index of %d (should be 0-%d); get a coder!\n", index, Shockwaves.capacity() - 1 );
 	return Shockwaves[index].weapon_info_index;
 }
 
@@ -660,7 +766,7 @@ int shockwave_get_weapon_index(int index)
  */
 float shockwave_get_max_radius(int index)
 {
-	Assertion( (index >= 0) && (index < MAX_SHOCKWAVES), "shockwave_get_max_radius() called on an index of %d (should be 0-%d); get a coder!\n", index, MAX_SHOCKWAVES - 1 );
+	Assertion( (index >= 0) && (index < Shockwaves.capacity()), "shockwave_get_max_radius() called on an index of %d (should be 0-%d); get a coder!\n", index, Shockwaves.capacity() - 1 );
 	return Shockwaves[index].outer_radius;
 }
 
@@ -669,7 +775,7 @@ float shockwave_get_max_radius(int index)
  */
 float shockwave_get_min_radius(int index)
 {
-	Assertion( (index >= 0) && (index < MAX_SHOCKWAVES), "shockwave_get_min_radius() called on an index of %d (should be 0-%d); get a coder!\n", index, MAX_SHOCKWAVES - 1 );
+	Assertion( (index >= 0) && (index < Shockwaves.capacity()), "shockwave_get_min_radius() called on an index of %d (should be 0-%d); get a coder!\n", index, Shockwaves.capacity() - 1 );
 	return Shockwaves[index].inner_radius;
 }
 
@@ -678,7 +784,7 @@ float shockwave_get_min_radius(int index)
  */
 float shockwave_get_damage(int index)
 {
-	Assertion( (index >= 0) && (index < MAX_SHOCKWAVES), "shockwave_get_damage() called on an index of %d (should be 0-%d); get a coder!\n", index, MAX_SHOCKWAVES - 1 );
+	Assertion( (index >= 0) && (index < Shockwaves.capacity()), "shockwave_get_damage() called on an index of %d (should be 0-%d); get a coder!\n", index, Shockwaves.capacity() - 1 );
 	return Shockwaves[index].damage;
 }
 
@@ -687,7 +793,7 @@ float shockwave_get_damage(int index)
  */
 int shockwave_get_damage_type_idx(int index)
 {
-	Assertion( (index >= 0) && (index < MAX_SHOCKWAVES), "shockwave_get_damage_type_idx() called on an index of %d (should be 0-%d); get a coder!\n", index, MAX_SHOCKWAVES - 1 );
+	Assertion( (index >= 0) && (index < Shockwaves.capacity()), "shockwave_get_damage_type_idx() called on an index of %d (should be 0-%d); get a coder!\n", index, Shockwaves.capacity() - 1 );
 	return Shockwaves[index].damage_type_idx;
 }
 
@@ -696,7 +802,7 @@ int shockwave_get_damage_type_idx(int index)
  */
 int shockwave_get_flags(int index)
 {
-	Assertion( (index >= 0) && (index < MAX_SHOCKWAVES), "shockwave_get_flags() called on an index of %d (should be 0-%d); get a coder!\n", index, MAX_SHOCKWAVES - 1 );
+	Assertion( (index >= 0) && (index < Shockwaves.capacity()), "shockwave_get_flags() called on an index of %d (should be 0-%d); get a coder!\n", index, Shockwaves.capacity() - 1 );
 	return Shockwaves[index].flags;
 }
 
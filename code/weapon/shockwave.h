@@ -16,6 +16,7 @@
 #include "globalincs/pstypes.h"
 
 #include "gamesnd/gamesnd.h"
+#include "utils/chunked_pool.h"
 
 class object;
 class model_draw_list;
@@ -25,8 +26,6 @@ class model_draw_list;
 #define	SW_SHIP_DEATH		(1<<2)
 #define	SW_WEAPON_KILL		(1<<3)	// Shockwave created when weapon destroyed by another
 
-#define	MAX_SHOCKWAVES					16
-
 // -----------------------------------------------------------
 // Data structures
 // -----------------------------------------------------------
@@ -51,7 +50,7 @@ typedef struct shockwave_info
 typedef struct shockwave {
 	shockwave	*next, *prev;
 	int			flags;
-	int			objnum;					// index into Objects[] for shockwave
+	int			objnum = -1;			// index into Objects[] for shockwave
 	SCP_vector<std::pair<int, int>>			obj_sig_hitlist;
 	float		speed, radius;
 	float		inner_radius, outer_radius, damage;
@@ -66,10 +65,20 @@ typedef struct shockwave {
 	float		total_time;				// total lifetime of animation in seconds
 	int			delay_stamp;			// for delayed shockwaves
 	angles		rot_angles;
-	int			model_id;
+	int			model_id = -1;
 	gamesnd_id  blast_sound_id;
 } shockwave;
 
+extern util::chunked_pool<shockwave, 16> Shockwaves;	// all shockwaves, grows when they are all in use
+
+// An object which shockwaves can affect, see shockwave_move_all()
+typedef struct shockwave_target {
+	int		objnum;
+	int		order;					// position in obj_used_list; shockwaves affect objects in this order
+	vec3d	pos;
+	float	reach;					// how far from pos the object can be hit
+} shockwave_target;
+
 typedef struct shockwave_create_info {
 
 	char name[MAX_FILENAME_LEN];
@@ -98,6 +107,8 @@ void shockwave_level_init();
 void shockwave_level_close();
 void shockwave_delete(object *objp);
 void shockwave_move_all(float frametime);
+float shockwave_box_reach(const vec3d *mins, const vec3d *maxs, float radius);
+void shockwave_find_targets(const SCP_vector<shockwave_target> &targets, float max_reach, const vec3d *pos, float range, SCP_vector<const shockwave_target*> &hits);
 int  shockwave_create(int parent_objnum, vec3d *pos, shockwave_create_info *sci, int flag, int delay = -1);
 void shockwave_render(object *objp, model_draw_list *scene);
 int shockwave_load(const char *s_name, bool shock_3D = false);
@@ -152,7 +152,7 @@ void swarm_update_direction(object *objp, swarm_info* swarmp)
 	float			vel, target_dist, radius;
 	physics_info	*pi;
 
-	Assert(objp->instance >= 0 && objp->instance < MAX_WEAPONS);
+	Assert(objp->instance >= 0 && objp->instance < Weapons.capacity());
 
 	wp = &Weapons[objp->instance];
 
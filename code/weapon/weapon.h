@@ -32,6 +32,7 @@
 #include "weapon/weapon_flags.h"
 #include "model/modelrender.h"
 #include "render/3d.h"
+#include "utils/chunked_pool.h"
 
 class object;
 class ship_subsys;
@@ -83,8 +84,9 @@ constexpr int BANK_SWITCH_DELAY = 250;	// after switching banks, 1/4 second dela
 #define MAX_SPAWN_TYPES_PER_WEAPON 5
 
 typedef struct weapon {
-	int		weapon_info_index;			// index into weapon_info array
-	int		objnum;							// object number for this weapon
+	int		pool_index = -1;					// the slot of this weapon in Weapons, kept up to date by the pool
+	int		weapon_info_index = -1;			// index into weapon_info array
+	int		objnum = -1;						// object number for this weapon
 	int		model_instance_num;				// model instance number, if we have any intrinsic-moving submodels
 	int		team;								// The team of the ship that fired this
 	int		species;							// The species of the ship that fired thisz
@@ -277,7 +279,7 @@ typedef struct spawn_weapon_info
 #define BEAM_FAR_LENGTH				30000.0f
 
 
-extern weapon Weapons[MAX_WEAPONS];
+extern util::chunked_pool<weapon, 256, &weapon::pool_index> Weapons;
 
 #define WEAPON_TITLE_LEN			48
 
@@ -671,7 +673,7 @@ extern int Default_cmeasure_index;
 
 extern SCP_vector<int> Player_weapon_precedence;	// Vector of weapon types, precedence list for player weapon selection
 
-#define WEAPON_INDEX(wp)			(int)(wp-Weapons)
+#define WEAPON_INDEX(wp)			Weapons.index_of(wp)
 
 
 int weapon_info_lookup(const char *name);
@@ -85,12 +85,11 @@ DCF_BOOL( weapon_flyby, Weapon_flyby_sound_enabled )
 
 static int Weapon_flyby_sound_timer;	
 
-weapon Weapons[MAX_WEAPONS];
+// Grows with the number of weapons in flight, the only limit is the number of object slots
+util::chunked_pool<weapon, 256, &weapon::pool_index> Weapons;
 SCP_vector<weapon_info> Weapon_info;
 
-#define		MISSILE_OBJ_USED	(1<<0)			// flag used in missile_obj struct
-#define		MAX_MISSILE_OBJS	MAX_WEAPONS		// max number of missiles tracked in missile list
-missile_obj Missile_objs[MAX_MISSILE_OBJS];	// array used to store missile object indexes
+util::chunked_pool<missile_obj> Missile_objs;	// nodes of the missile list, these never move when the pool grows
 missile_obj Missile_obj_list;						// head of linked list of missile_obj structs
 
 #define DEFAULT_WEAPON_SPAWN_COUNT	10
@@ -543,12 +542,8 @@ void parse_weapon_expl_tbl(const char *filename)
  */
 void missile_obj_list_init()
 {
-	int i;
-
 	list_init(&Missile_obj_list);
-	for ( i = 0; i < MAX_MISSILE_OBJS; i++ ) {
-		Missile_objs[i].flags = 0;
-	}
+	Missile_objs.clear();
 }
 
 /**
@@ -557,21 +552,11 @@ void missile_obj_list_init()
  */
 int missile_obj_list_add(int objnum)
 {
-	int i;
+	int i = Missile_objs.allocate();
 
-	for ( i = 0; i < MAX_MISSILE_OBJS; i++ ) {
-		if ( !(Missile_objs[i].flags & MISSILE_OBJ_USED) )
-			break;
-	}
-	if ( i == MAX_MISSILE_OBJS ) {
-		Error(LOCATION, "Fatal Error: Ran out of missile object nodes\n");
-		return -1;
-	}
-	
 	Missile_objs[i].flags = 0;
 	Missile_objs[i].objnum = objnum;
 	list_append(&Missile_obj_list, &Missile_objs[i]);
-	Missile_objs[i].flags |= MISSILE_OBJ_USED;
 
 	return i;
 }
@@ -582,9 +567,9 @@ int missile_obj_list_add(int objnum)
  */
 void missle_obj_list_remove(int index)
 {
-	Assert(index >= 0 && index < MAX_MISSILE_OBJS);
-	list_remove(&Missile_obj_list, &Missile_objs[index]);	
-	Missile_objs[index].flags = 0;
+	Assert(Missile_objs.in_use(index));
+	list_remove(&Missile_obj_list, &Missile_objs[index]);
+	Missile_objs.free(index);
 }
 
 /**
@@ -593,7 +578,7 @@ void missle_obj_list_remove(int index)
  */
 missile_obj *missile_obj_return_address(int index)
 {
-	Assert(index >= 0 && index < MAX_MISSILE_OBJS);
+	Assert(Missile_objs.in_use(index));
 	return &Missile_objs[index];
 }
 
@@ -4529,10 +4514,7 @@ void weapon_level_init()
 
 	// Reset everything between levels
 	Num_weapons = 0;
-	for (i=0; i<MAX_WEAPONS; i++)	{
-		Weapons[i].objnum = -1;
-		Weapons[i].weapon_info_index = -1;
-	}
+	Weapons.clear();
 
 	for (i = 0; i < weapon_info_size(); i++) {
 		Weapon_info[i].damage_type_idx = Weapon_info[i].damage_type_idx_sav;
@@ -4642,6 +4624,7 @@ void weapon_delete(object *obj)
 	}
 
 	wp->objnum = -1;
+	Weapons.free(num);
 	Num_weapons--;
 	Assert(Num_weapons >= 0);
 }
@@ -6240,19 +6223,6 @@ int weapon_create( vec3d * pos, matrix * porient, int weapon_type, int parent_ob
 		}
 	}
 
-	if (Num_weapons == MAX_WEAPONS) {
-		mprintf(("Can't fire due to lack of weapon slots"));
-		return -1;
-	}
-
-	for (n=0; n<MAX_WEAPONS; n++ ){
-		if (Weapons[n].weapon_info_index < 0){
-			break;
-		}
-	}
-
-	Assertion(n != MAX_WEAPONS, "Somehow tried to create weapons despite being at max weapons");
-
 	// make sure we are loaded and useable
 	if ( (wip->render_type == WRT_POF) && (wip->model_num < 0) ) {
 		wip->model_num = model_load(wip->pofbitmap_name, 0, NULL);
@@ -6304,12 +6274,15 @@ int weapon_create( vec3d * pos, matrix * porient, int weapon_type, int parent_ob
 	if (wip->wi_flags[Weapon::Info_Flags::Can_damage_shooter])
 		default_flags.set(Object::Object_Flags::Collides_with_parent);
 
+	n = Weapons.allocate();
+
 	// mark this object creation as essential, if it is created by a player.  
 	// You don't want players mysteriously wondering why they aren't firing.
 	objnum = obj_create( OBJ_WEAPON, parent_objnum, n, orient, pos, 2.0f, default_flags, (parent_objp != nullptr && parent_objp->flags[Object::Object_Flags::Player_ship]));
 
 	if (objnum < 0) {
 		mprintf(("A weapon failed to be created because FSO is running out of object slots!\n"));
+		Weapons.free(n);
 		return -1;
 	}
 
@@ -6697,8 +6670,8 @@ void spawn_child_weapons(object *objp, int spawn_index_override)
 
 	Assertion(objp->type == OBJ_WEAPON || objp->type == OBJ_BEAM, "spawn_child_weapons() doesn't make sense for non-weapon non-beam objects; get a coder!\n");
 	Assertion(objp->instance >= 0, "spawn_child_weapons() called with an object with an instance of %d; get a coder!\n", objp->instance);
-	Assertion(!(objp->type == OBJ_WEAPON) || (objp->instance < MAX_WEAPONS), "spawn_child_weapons() called with a weapon with an instance of %d while MAX_WEAPONS is %d; get a coder!\n", objp->instance, MAX_WEAPONS);
-	Assertion(!(objp->type == OBJ_BEAM) || (objp->instance < MAX_BEAMS), "spawn_child_weapons() called with a beam with an instance of %d while MAX_BEAMS is %d; get a coder!\n", objp->instance, MAX_BEAMS);
+	Assertion(!(objp->type == OBJ_WEAPON) || (objp->instance < Weapons.capacity()), "spawn_child_weapons() called with a weapon with an instance of %d while the pool only has %d slots; get a coder!\n", objp->instance, Weapons.capacity());
+	Assertion(!(objp->type == OBJ_BEAM) || (objp->instance < Beams.capacity()), "spawn_child_weapons() called with a beam with an instance of %d while the pool only has %d slots; get a coder!\n", objp->instance, Beams.capacity());
 
 	if (objp->type == OBJ_WEAPON) {
 		wp = &Weapons[objp->instance];
@@ -7317,8 +7290,8 @@ void weapon_hit( object * weapon_obj, object * other_obj, vec3d * hitpos, int qu
 	if(weapon_obj == NULL){
 		return;
 	}
-	Assert((weapon_obj->type == OBJ_WEAPON) && (weapon_obj->instance >= 0) && (weapon_obj->instance < MAX_WEAPONS));
-	if((weapon_obj->type != OBJ_WEAPON) || (weapon_obj->instance < 0) || (weapon_obj->instance >= MAX_WEAPONS)){
+	Assert((weapon_obj->type == OBJ_WEAPON) && (weapon_obj->instance >= 0) && (weapon_obj->instance < Weapons.capacity()));
+	if((weapon_obj->type != OBJ_WEAPON) || (weapon_obj->instance < 0) || (weapon_obj->instance >= Weapons.capacity())){
 		return;
 	}
 
@@ -8440,7 +8413,7 @@ float weapon_get_damage_scale(weapon_info *wip, object *wep, object *target)
 	}
 
 	// don't scale any damage if its not a weapon	
-	if((wep->type != OBJ_WEAPON) || (wep->instance < 0) || (wep->instance >= MAX_WEAPONS)){
+	if((wep->type != OBJ_WEAPON) || (wep->instance < 0) || (wep->instance >= Weapons.capacity())){
 		return 1.0f;
 	}
 	wp = &Weapons[wep->instance];
@@ -8518,16 +8491,13 @@ float weapon_get_damage_scale(weapon_info *wip, object *wep, object *target)
 
 void pause_in_flight_sounds()
 {
-	for (int i = 0; i < MAX_WEAPONS; i++)
+	for (auto i : Weapons.used())
 	{
-		if (Weapons[i].objnum != -1)
-		{
-			weapon* wp = &Weapons[i];
+		weapon* wp = &Weapons[i];
 
-			if (wp->hud_in_flight_snd_sig.isValid() && snd_is_playing(wp->hud_in_flight_snd_sig)) {
-				// Stop sound, it will be restarted in the first frame after the game is unpaused
-				snd_stop(wp->hud_in_flight_snd_sig);
-			}
+		if (wp->hud_in_flight_snd_sig.isValid() && snd_is_playing(wp->hud_in_flight_snd_sig)) {
+			// Stop sound, it will be restarted in the first frame after the game is unpaused
+			snd_stop(wp->hud_in_flight_snd_sig);
 		}
 	}
 }
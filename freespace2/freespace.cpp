@@ -64,6 +64,7 @@
 #include "graphics/font.h"
 #include "graphics/light.h"
 #include "graphics/matrix.h"
+#include "graphics/render.h"
 #include "graphics/shadows.h"
 #include "headtracking/headtracking.h"
 #include "hud/hud.h"
@@ -1303,6 +1304,10 @@ void freespace_mission_load_stuff()
 
 		game_busy( NOX("** finished with level_page_in() **") );
 
+		// Sounds were decoding in the background while the level data was paged in
+		game_busy( NOX("** finishing sound loading **") );
+		snd_finish_pending_loads();
+
 		if(Game_loading_callback_inited) {
 			game_loading_callback_close();
 		}
@@ -1387,6 +1392,9 @@ bool game_start_mission()
 	if ( !(Game_mode & GM_STANDALONE_SERVER) )
 		game_loading_callback_init();
 
+	// the geometry of all models of the mission is generated at once in model_page_in_stop()
+	model_geometry_deferral defer_model_geometry;
+
 	game_level_init();
 	
 	if (Game_mode & GM_MULTIPLAYER) {
@@ -2209,6 +2217,16 @@ void game_show_framerate()
 		gr_printf_no_resize( sx, sy, NOX("Snds: %d"), snd_num_playing() );
 		sy += line_height;
 
+		{
+			const auto& draw_stats = gr_2d_get_draw_stats();
+			gr_printf_no_resize( sx, sy, NOX("2D DRAWS: %d"), draw_stats.draw_calls );
+			sy += line_height;
+			gr_printf_no_resize( sx, sy, NOX("2D QUADS: %d"), draw_stats.batched_quads );
+			sy += line_height;
+			gr_printf_no_resize( sx, sy, NOX("2D REUSED: %d"), draw_stats.replayed_quads );
+			sy += line_height;
+		}
+
 		if ( Timing_total > 0.01f )	{
 			gr_printf_no_resize(  sx, sy, NOX("CLEAR: %.0f%%"), Timing_clear*100.0f/Timing_total );
 			sy += line_height;
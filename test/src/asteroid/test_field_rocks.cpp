@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include "asteroid/asteroid.h"
+#include "math/vecmat.h"
+
+#include <random>
+
+TEST(FieldRocksTest, nearSegmentEnds)
+{
+	vec3d p0 = vm_vec_new(0.0f, 0.0f, 0.0f);
+	vec3d p1 = vm_vec_new(1000.0f, 0.0f, 0.0f);
+
+	// beside the middle of the beam
+	vec3d pos = vm_vec_new(500.0f, 40.0f, 0.0f);
+	ASSERT_TRUE(asteroid_field_rock_near_segment(&pos, 10.0f, &p0, &p1, 30.0f));
+	ASSERT_FALSE(asteroid_field_rock_near_segment(&pos, 10.0f, &p0, &p1, 29.0f));
+
+	// in line with the beam but past its end
+	pos = vm_vec_new(1040.0f, 0.0f, 0.0f);
+	ASSERT_TRUE(asteroid_field_rock_near_segment(&pos, 10.0f, &p0, &p1, 30.0f));
+	ASSERT_FALSE(asteroid_field_rock_near_segment(&pos, 10.0f, &p0, &p1, 29.0f));
+
+	// behind the muzzle
+	pos = vm_vec_new(-40.0f, 0.0f, 0.0f);
+	ASSERT_TRUE(asteroid_field_rock_near_segment(&pos, 10.0f, &p0, &p1, 30.0f));
+	ASSERT_FALSE(asteroid_field_rock_near_segment(&pos, 10.0f, &p0, &p1, 29.0f));
+
+	// a beam which hasn't got a length yet
+	pos = vm_vec_new(0.0f, 0.0f, 40.0f);
+	ASSERT_TRUE(asteroid_field_rock_near_segment(&pos, 10.0f, &p0, &p0, 30.0f));
+	ASSERT_FALSE(asteroid_field_rock_near_segment(&pos, 10.0f, &p0, &p0, 29.0f));
+}
+
+TEST(FieldRocksTest, nearSegmentMatchesSampling)
+{
+	// any rock touching a point of the beam has to be found
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> coord(-2000.0f, 2000.0f);
+	std::uniform_real_distribution<float> size(1.0f, 200.0f);
+	std::uniform_real_distribution<float> fraction(0.0f, 1.0f);
+
+	for (int i = 0; i < 1000; ++i) {
+		vec3d p0 = vm_vec_new(coord(gen), coord(gen), coord(gen));
+		vec3d p1 = vm_vec_new(coord(gen), coord(gen), coord(gen));
+
+		vec3d seg, on_beam;
+		vm_vec_sub(&seg, &p1, &p0);
+		vm_vec_scale_add(&on_beam, &p0, &seg, fraction(gen));
+
+		vec3d dir = vm_vec_new(coord(gen), coord(gen), coord(gen));
+		vm_vec_normalize_safe(&dir);
+		float radius = size(gen);
+		float dist = size(gen);
+
+		vec3d pos;
+		vm_vec_scale_add(&pos, &on_beam, &dir, (radius + dist) * 0.99f);
+		ASSERT_TRUE(asteroid_field_rock_near_segment(&pos, radius, &p0, &p1, dist));
+	}
+}
+
+TEST(FieldRocksTest, removeKeepsValuesTogether)
+{
+	asteroid_field_rocks rocks;
+	for (int i = 0; i < 4; ++i) {
+		vec3d pos = vm_vec_new(i * 100.0f, 0.0f, 0.0f);
+		rocks.add(pos, vmd_zero_vector, vmd_identity_matrix, vmd_zero_vector, 0.0f, 10.0f + i, 50.0f + i, i, i + 10);
+	}
+
+	// the last rock takes the slot of the removed one with all of its values
+	rocks.remove(1);
+	ASSERT_EQ(3, rocks.size());
+	ASSERT_FLOAT_EQ(300.0f, rocks.pos[1].xyz.x);
+	ASSERT_FLOAT_EQ(13.0f, rocks.radius[1]);
+	ASSERT_FLOAT_EQ(53.0f, rocks.hull[1]);
+	ASSERT_EQ(3, rocks.asteroid_type[1]);
+	ASSERT_EQ(13, rocks.asteroid_subtype[1]);
+
+	// removing from the highest index down leaves the lower indices where they were
+	rocks.remove(2);
+	rocks.remove(0);
+	ASSERT_EQ(1, rocks.size());
+	ASSERT_FLOAT_EQ(300.0f, rocks.pos[0].xyz.x);
+	ASSERT_EQ(3, rocks.asteroid_type[0]);
+
+	rocks.remove(0);
+	ASSERT_EQ(0, rocks.size());
+	ASSERT_TRUE(rocks.radius.empty());
+	ASSERT_TRUE(rocks.asteroid_subtype.empty());
+}
+
+TEST(FieldRocksTest, pickDemotionsFarthestFirst)
+{
+	SCP_vector<float> asteroid_dist = {100.0f, 900.0f, 300.0f, 700.0f};
+	SCP_vector<float> rock_dist     = {200.0f, 50.0f};
+	SCP_vector<int> demote;
+
+	asteroid_field_pick_demotions(asteroid_dist, rock_dist, demote);
+	ASSERT_EQ((size_t)2, demote.size());
+	ASSERT_EQ(1, demote[0]);
+	ASSERT_EQ(3, demote[1]);
+
+	// nothing to make room for
+	asteroid_field_pick_demotions(asteroid_dist, SCP_vector<float>(), demote);
+	ASSERT_TRUE(demote.empty());
+}
+
+TEST(FieldRocksTest, pickDemotionsOnlyForNearerRocks)
+{
+	SCP_vector<float> asteroid_dist = {100.0f, 600.0f, 300.0f};
+	SCP_vector<int> demote;
+
+	// the nearest rock gets the farthest asteroid, the next one isn't closer than the asteroid left over
+	asteroid_field_pick_demotions(asteroid_dist, {500.0f, 400.0f, 350.0f}, demote);
+	ASSERT_EQ((size_t)1, demote.size());
+	ASSERT_EQ(1, demote[0]);
+
+	// every asteroid is closer than the rocks, swapping them would be worse
+	asteroid_field_pick_demotions(asteroid_dist, {700.0f, 800.0f}, demote);
+	ASSERT_TRUE(demote.empty());
+
+	// an equally close rock doesn't replace an asteroid either
+	asteroid_field_pick_demotions(asteroid_dist, {600.0f}, demote);
+	ASSERT_TRUE(demote.empty());
+}
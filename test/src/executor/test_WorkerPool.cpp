@@ -0,0 +1,119 @@
+
+#include <gtest/gtest.h>
+
+#include "executor/WorkerPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+using namespace executor;
+
+TEST(WorkerPoolTests, submitReturnsResult)
+{
+	WorkerPool pool(2);
+
+	auto future = pool.submit([]() { return 42; });
+
+	ASSERT_EQ(42, future.get());
+}
+
+TEST(WorkerPoolTests, noThreadsRunsSynchronously)
+{
+	WorkerPool pool(0);
+
+	bool executed = false;
+	pool.post([&executed]() { executed = true; });
+
+	ASSERT_TRUE(executed);
+}
+
+TEST(WorkerPoolTests, parallelForVisitsEveryIndexOnce)
+{
+	WorkerPool pool(3);
+
+	SCP_vector<std::atomic<int>> visits(1000);
+	for (auto& visit : visits) {
+		visit = 0;
+	}
+
+	pool.parallel_for(visits.size(), [&visits](size_t i) { ++visits[i]; });
+
+	for (auto& visit : visits) {
+		ASSERT_EQ(1, visit.load());
+	}
+}
+
+TEST(WorkerPoolTests, manyTasks)
+{
+	WorkerPool pool(4);
+
+	std::atomic<int> counter(0);
+	SCP_vector<std::future<void>> futures;
+	for (auto i = 0; i < 500; ++i) {
+		futures.push_back(pool.submit([&counter]() { ++counter; }));
+	}
+
+	for (auto& future : futures) {
+		future.wait();
+	}
+
+	ASSERT_EQ(500, counter.load());
+}
+
+// Not run by default. Run with --gtest_also_run_disabled_tests --gtest_filter=*parallelForCost to see from which item
+// count splitting work into chunks of 128 items pays off. The work per item is about what culling one object costs.
+TEST(WorkerPoolTests, DISABLED_parallelForCost)
+{
+	const size_t chunk_size = 128;
+	const int frames        = 500;
+
+	WorkerPool pool(std::max(std::thread::hardware_concurrency(), 2u) - 1);
+
+	SCP_vector<float> values(8192);
+	for (size_t i = 0; i < values.size(); ++i) {
+		values[i] = static_cast<float>(i);
+	}
+	SCP_vector<float> results(values.size());
+
+	auto item = [&values, &results](size_t i) {
+		// eight rotated box corners, the same amount of math obj_sphere_in_view_cone() does
+		float sum = 0.0f;
+		for (int corner = 0; corner < 8; ++corner) {
+			auto x = values[i] * 0.3f + corner;
+			auto y = values[i] * 0.5f - corner;
+			auto z = values[i] * 0.7f + corner * 0.5f;
+			sum += std::sqrt(x * x + y * y + z * z);
+		}
+		results[i] = sum;
+	};
+
+	for (size_t count = 64; count <= values.size(); count *= 2) {
+		const auto num_chunks = (count + chunk_size - 1) / chunk_size;
+
+		auto serial_start = std::chrono::high_resolution_clock::now();
+		for (int frame = 0; frame < frames; ++frame) {
+			for (size_t i = 0; i < count; ++i) {
+				item(i);
+			}
+		}
+		auto serial_end = std::chrono::high_resolution_clock::now();
+
+		for (int frame = 0; frame < frames; ++frame) {
+			pool.parallel_for(num_chunks, [count, &item](size_t chunk) {
+				const auto last = std::min((chunk + 1) * chunk_size, count);
+				for (auto i = chunk * chunk_size; i < last; ++i) {
+					item(i);
+				}
+			});
+		}
+		auto parallel_end = std::chrono::high_resolution_clock::now();
+
+		auto serial_ns   = std::chrono::duration_cast<std::chrono::nanoseconds>(serial_end - serial_start).count();
+		auto parallel_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(parallel_end - serial_end).count();
+
+		std::cout << count << " items: serial " << serial_ns / frames / 1000.0 << " us, parallel "
+		          << parallel_ns / frames / 1000.0 << " us" << std::endl;
+	}
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include "graphics/2d.h"
+#include "graphics/util/CommandRecorder.h"
+
+using namespace graphics::util;
+
+namespace {
+int Backend_calls = 0;
+}
+
+class CommandRecorderTest : public ::testing::Test {
+  protected:
+	void SetUp() override
+	{
+		_flip              = gr_screen.gf_flip;
+		_zbuffer_set       = gr_screen.gf_zbuffer_set;
+		_set_cull          = gr_screen.gf_set_cull;
+		_update_buffer     = gr_screen.gf_update_buffer_data;
+		_render_primitives = gr_screen.gf_render_primitives;
+
+		Backend_calls = 0;
+
+		gr_screen.gf_flip        = []() { ++Backend_calls; };
+		gr_screen.gf_zbuffer_set = [](int mode) {
+			++Backend_calls;
+			return mode;
+		};
+		gr_screen.gf_set_cull = [](int cull) {
+			++Backend_calls;
+			return cull;
+		};
+		gr_screen.gf_update_buffer_data = [](gr_buffer_handle, size_t, const void*) { ++Backend_calls; };
+		gr_screen.gf_render_primitives  = [](material*, primitive_type, vertex_layout*, int, int, gr_buffer_handle,
+                                                size_t) { ++Backend_calls; };
+	}
+
+	void TearDown() override
+	{
+		gr_screen.gf_flip               = _flip;
+		gr_screen.gf_zbuffer_set        = _zbuffer_set;
+		gr_screen.gf_set_cull           = _set_cull;
+		gr_screen.gf_update_buffer_data = _update_buffer;
+		gr_screen.gf_render_primitives  = _render_primitives;
+	}
+
+	static void draw(int n_verts)
+	{
+		gr_screen.gf_render_primitives(nullptr, PRIM_TYPE_TRIS, nullptr, 0, n_verts, gr_buffer_handle(1), 0);
+	}
+
+	decltype(screen::gf_flip) _flip;
+	decltype(screen::gf_zbuffer_set) _zbuffer_set;
+	decltype(screen::gf_set_cull) _set_cull;
+	decltype(screen::gf_update_buffer_data) _update_buffer;
+	decltype(screen::gf_render_primitives) _render_primitives;
+};
+
+TEST_F(CommandRecorderTest, recordsAndForwards)
+{
+	CommandRecorder recorder;
+	recorder.start();
+
+	ASSERT_EQ(2, gr_screen.gf_zbuffer_set(2));
+	gr_screen.gf_update_buffer_data(gr_buffer_handle(3), 256, nullptr);
+	draw(6);
+
+	ASSERT_EQ(3, Backend_calls);
+
+	const auto& frame = recorder.currentFrame();
+	ASSERT_EQ((size_t)3, frame.size());
+	ASSERT_EQ(CommandType::ZbufferSet, frame[0].type);
+	ASSERT_EQ((uint64_t)2, frame[0].value);
+	ASSERT_EQ(CommandType::UpdateBufferData, frame[1].type);
+	ASSERT_EQ((uint64_t)3, frame[1].value);
+	ASSERT_EQ((uint32_t)256, frame[1].size);
+	ASSERT_EQ(CommandType::RenderPrimitives, frame[2].type);
+	ASSERT_EQ((uint32_t)6, frame[2].size);
+
+	recorder.stop();
+
+	// The original functions must be back in place
+	gr_screen.gf_zbuffer_set(1);
+	ASSERT_EQ(4, Backend_calls);
+	ASSERT_EQ((size_t)3, recorder.currentFrame().size());
+}
+
+TEST_F(CommandRecorderTest, flipEndsFrame)
+{
+	CommandRecorder recorder;
+	recorder.start();
+
+	draw(3);
+	draw(3);
+	gr_screen.gf_flip();
+
+	ASSERT_TRUE(recorder.currentFrame().empty());
+	ASSERT_EQ((size_t)3, recorder.lastFrame().size());
+	ASSERT_EQ(CommandType::Flip, recorder.lastFrame().back().type);
+	ASSERT_EQ((size_t)1, recorder.numFrames());
+
+	draw(3);
+	gr_screen.gf_flip();
+
+	ASSERT_EQ((size_t)2, recorder.numFrames());
+	ASSERT_EQ((size_t)3, recorder.totalStats().draw_calls);
+	ASSERT_EQ((size_t)9, recorder.totalStats().vertices);
+
+	recorder.stop();
+}
+
+TEST_F(CommandRecorderTest, redundantStateChanges)
+{
+	CommandRecorder recorder;
+	recorder.start();
+
+	gr_screen.gf_set_cull(1);
+	gr_screen.gf_set_cull(1);
+	gr_screen.gf_zbuffer_set(ZBUFFER_TYPE_FULL);
+	gr_screen.gf_set_cull(0);
+	gr_screen.gf_zbuffer_set(ZBUFFER_TYPE_FULL);
+	gr_screen.gf_update_buffer_data(gr_buffer_handle(1), 100, nullptr);
+	gr_screen.gf_update_buffer_data(gr_buffer_handle(1), 28, nullptr);
+
+	auto stats = compute_command_stats(recorder.currentFrame());
+
+	ASSERT_EQ((size_t)7, stats.commands);
+	ASSERT_EQ((size_t)5, stats.state_calls);
+	ASSERT_EQ((size_t)3, stats.state_changes);
+	ASSERT_EQ((size_t)2, stats.uploads);
+	ASSERT_EQ((size_t)128, stats.bytes_uploaded);
+	ASSERT_EQ((size_t)0, stats.draw_calls);
+
+	recorder.stop();
+}
@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+
+#include "graphics/2d.h"
+#include "graphics/grstub.h"
+#include "graphics/util/FrameRingBuffer.h"
+
+using namespace graphics::util;
+
+namespace {
+// A minimal backend on top of the stub which keeps track of buffers and fences
+struct fake_backend {
+	bool persistent_mapping = false;
+
+	int num_buffers = 0;
+	SCP_vector<int> deleted_buffers;
+	SCP_vector<size_t> buffer_sizes;
+	SCP_vector<std::unique_ptr<uint8_t[]>> buffer_memory;
+
+	SCP_vector<bool> signaled_fences;
+	SCP_vector<size_t> waited_fences;
+
+	size_t uploaded_bytes = 0;
+	size_t flushed_bytes  = 0;
+};
+fake_backend Backend;
+
+gr_sync fence_from_index(size_t index) { return reinterpret_cast<gr_sync>(index + 1); }
+size_t fence_to_index(gr_sync sync) { return reinterpret_cast<size_t>(sync) - 1; }
+} // namespace
+
+class FrameRingBufferTest : public ::testing::Test {
+  protected:
+	void SetUp() override
+	{
+		_saved = gr_screen;
+		ASSERT_TRUE(gr_stub_init());
+
+		Backend = fake_backend();
+
+		gr_screen.gf_is_capable = [](gr_capability capability) {
+			return capability == CAPABILITY_PERSISTENT_BUFFER_MAPPING && Backend.persistent_mapping;
+		};
+		gr_screen.gf_create_buffer = [](BufferType, BufferUsageHint) {
+			Backend.buffer_sizes.push_back(0);
+			Backend.buffer_memory.emplace_back();
+			return gr_buffer_handle(Backend.num_buffers++);
+		};
+		gr_screen.gf_delete_buffer = [](gr_buffer_handle handle) { Backend.deleted_buffers.push_back(handle.value()); };
+		gr_screen.gf_update_buffer_data = [](gr_buffer_handle handle, size_t size, const void*) {
+			Backend.buffer_sizes[handle.value()] = size;
+			Backend.buffer_memory[handle.value()].reset(new uint8_t[size]);
+		};
+		gr_screen.gf_update_buffer_data_offset = [](gr_buffer_handle handle, size_t offset, size_t size,
+													 const void* data) {
+			ASSERT_LE(offset + size, Backend.buffer_sizes[handle.value()]);
+			memcpy(Backend.buffer_memory[handle.value()].get() + offset, data, size);
+			Backend.uploaded_bytes += size;
+		};
+		gr_screen.gf_map_buffer = [](gr_buffer_handle handle) -> void* {
+			return Backend.buffer_memory[handle.value()].get();
+		};
+		gr_screen.gf_flush_mapped_buffer = [](gr_buffer_handle, size_t, size_t size) { Backend.flushed_bytes += size; };
+
+		gr_screen.gf_sync_fence = []() {
+			Backend.signaled_fences.push_back(false);
+			return fence_from_index(Backend.signaled_fences.size() - 1);
+		};
+		gr_screen.gf_sync_wait = [](gr_sync sync, uint64_t) {
+			Backend.waited_fences.push_back(fence_to_index(sync));
+			return static_cast<bool>(Backend.signaled_fences[fence_to_index(sync)]);
+		};
+		gr_screen.gf_sync_delete = [](gr_sync) {};
+	}
+
+	void TearDown() override
+	{
+		gr_screen = _saved;
+		Backend   = fake_backend();
+	}
+
+	static void signal_all_fences()
+	{
+		for (size_t i = 0; i < Backend.signaled_fences.size(); ++i) {
+			Backend.signaled_fences[i] = true;
+		}
+	}
+
+	screen _saved;
+};
+
+TEST_F(FrameRingBufferTest, allocationsAreAligned)
+{
+	FrameRingBuffer ring(BufferType::Vertex, 1024);
+
+	auto first = ring.allocate(10);
+	ASSERT_EQ((size_t)0, first.offset);
+	ASSERT_EQ((size_t)10, first.size);
+
+	// Vertex sizes don't have to be powers of two
+	auto second = ring.allocate(96, 48);
+	ASSERT_EQ((size_t)48, second.offset);
+
+	auto third = ring.allocate(16, 256);
+	ASSERT_EQ((size_t)256, third.offset);
+	ASSERT_EQ((size_t)272, ring.getCurrentlyUsedSize());
+
+	ASSERT_EQ(first.handle, third.handle);
+	ASSERT_EQ(1, Backend.num_buffers);
+}
+
+TEST_F(FrameRingBufferTest, framesUseTheirOwnSegment)
+{
+	FrameRingBuffer ring(BufferType::Vertex, 1024);
+	ASSERT_EQ((size_t)1024 * FrameRingBuffer::NUM_FRAMES, Backend.buffer_sizes[0]);
+
+	for (size_t frame = 0; frame < FrameRingBuffer::NUM_FRAMES; ++frame) {
+		auto alloc = ring.allocate(100);
+		ASSERT_EQ(frame * 1024, alloc.offset);
+
+		signal_all_fences();
+		ring.onFrameEnd();
+	}
+
+	// Back at the first segment which may only be used once the GPU is done with the first frame
+	ASSERT_FALSE(Backend.waited_fences.empty());
+	ASSERT_EQ((size_t)0, Backend.waited_fences.back());
+
+	auto alloc = ring.allocate(100);
+	ASSERT_EQ((size_t)0, alloc.offset);
+}
+
+TEST_F(FrameRingBufferTest, submitUploadsStagedData)
+{
+	FrameRingBuffer ring(BufferType::Vertex, 1024);
+	ASSERT_FALSE(ring.usesPersistentMapping());
+
+	auto alloc = ring.allocate(64, 16);
+	ring.allocate(64, 16);
+
+	alloc = ring.allocate(4, 16);
+	ASSERT_NE(nullptr, alloc.data);
+	ASSERT_EQ(nullptr, alloc.mapped);
+	memcpy(alloc.data, "abcd", 4);
+
+	ring.submit(alloc);
+
+	ASSERT_EQ((size_t)4, Backend.uploaded_bytes);
+	ASSERT_EQ(0, memcmp(Backend.buffer_memory[0].get() + alloc.offset, "abcd", 4));
+}
+
+TEST_F(FrameRingBufferTest, directWritesGoToMappedMemory)
+{
+	Backend.persistent_mapping = true;
+
+	FrameRingBuffer ring(BufferType::Vertex, 1024);
+	ASSERT_TRUE(ring.usesPersistentMapping());
+
+	ring.allocate(32);
+	auto alloc = ring.allocate(4);
+	ASSERT_EQ(alloc.mapped, alloc.data);
+	ASSERT_EQ(Backend.buffer_memory[0].get() + 32, alloc.data);
+
+	memcpy(alloc.data, "abcd", 4);
+	ring.submit(alloc);
+
+	ASSERT_EQ((size_t)0, Backend.uploaded_bytes);
+	ASSERT_EQ((size_t)4, Backend.flushed_bytes);
+}
+
+TEST_F(FrameRingBufferTest, stagedWritesAreCopiedOnSubmit)
+{
+	Backend.persistent_mapping = true;
+
+	FrameRingBuffer ring(BufferType::Uniform, 1024, FrameRingBuffer::WriteMode::Staged);
+
+	auto alloc = ring.allocate(8);
+	ASSERT_NE(alloc.mapped, alloc.data);
+
+	memcpy(alloc.data, "abcdefgh", 8);
+	ring.submit(alloc, 4);
+
+	ASSERT_EQ((size_t)4, Backend.flushed_bytes);
+	ASSERT_EQ(0, memcmp(Backend.buffer_memory[0].get(), "abcd", 4));
+}
+
+TEST_F(FrameRingBufferTest, growsWhenFrameIsFull)
+{
+	FrameRingBuffer ring(BufferType::Vertex, 256);
+
+	auto first = ring.allocate(200);
+	memcpy(first.data, "old", 4);
+
+	auto second = ring.allocate(200);
+	ASSERT_EQ(2, Backend.num_buffers);
+	ASSERT_NE(first.handle, second.handle);
+	ASSERT_EQ((size_t)0, second.offset);
+	ASSERT_GE(ring.getFrameSize(), (size_t)400);
+
+	// Allocations from before the resize can still be submitted into the old buffer
+	ring.submit(first, 4);
+	ASSERT_EQ(0, memcmp(Backend.buffer_memory[0].get(), "old", 4));
+
+	// The old buffer is deleted once the GPU is done with it
+	ring.onFrameEnd();
+	ASSERT_TRUE(Backend.deleted_buffers.empty());
+
+	signal_all_fences();
+	ring.onFrameEnd();
+	ASSERT_EQ((size_t)1, Backend.deleted_buffers.size());
+	ASSERT_EQ(0, Backend.deleted_buffers[0]);
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include "graphics/2d.h"
+#include "graphics/grstub.h"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+
+namespace {
+const int Num_calls = 1000000;
+
+int Last_cull_mode = -1;
+
+int record_set_cull(int cull)
+{
+	Last_cull_mode = cull;
+	return 1;
+}
+
+template <typename Func>
+void measure(const char* label, Func func)
+{
+	const auto start = std::chrono::high_resolution_clock::now();
+
+	func();
+
+	const auto end = std::chrono::high_resolution_clock::now();
+	const auto ns  = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+	std::cout << label << ": " << static_cast<double>(ns) / Num_calls << " ns per call" << std::endl;
+}
+} // namespace
+
+class GrDispatchTest : public ::testing::Test {
+  protected:
+	void SetUp() override
+	{
+		_saved = gr_screen;
+		ASSERT_TRUE(gr_stub_init());
+	}
+
+	void TearDown() override { gr_screen = _saved; }
+
+	screen _saved;
+};
+
+TEST_F(GrDispatchTest, stubFunctionsAreBound)
+{
+	ASSERT_NE(nullptr, gr_screen.gf_flip);
+	ASSERT_NE(nullptr, gr_screen.gf_set_cull);
+	ASSERT_NE(nullptr, gr_screen.gf_update_buffer_data);
+	ASSERT_NE(nullptr, gr_screen.gf_render_primitives);
+}
+
+TEST_F(GrDispatchTest, callsReachBoundFunction)
+{
+	gr_screen.gf_set_cull = record_set_cull;
+
+	ASSERT_EQ(1, gr_set_cull(0));
+	ASSERT_EQ(0, Last_cull_mode);
+
+	ASSERT_EQ(1, gr_set_cull(1));
+	ASSERT_EQ(1, Last_cull_mode);
+}
+
+// Not run by default. Run with --gtest_also_run_disabled_tests --gtest_filter=*callOverhead to compare the cost of
+// calling into the backend with the std::function members gr_screen used to have.
+TEST_F(GrDispatchTest, DISABLED_callOverhead)
+{
+	// The stub backend does nothing so only the dispatch is measured
+	int sum = 0;
+
+	measure("gr_set_cull", [&sum]() {
+		for (int i = 0; i < Num_calls; ++i) {
+			sum += gr_set_cull(i & 1);
+		}
+	});
+	std::function<int(int)> set_cull = gr_screen.gf_set_cull;
+	measure("gr_set_cull (std::function)", [&sum, &set_cull]() {
+		for (int i = 0; i < Num_calls; ++i) {
+			sum += set_cull(i & 1);
+		}
+	});
+
+	measure("gr_update_buffer_data", []() {
+		for (int i = 0; i < Num_calls; ++i) {
+			gr_update_buffer_data(gr_buffer_handle(i & 0xFF), 64, nullptr);
+		}
+	});
+	std::function<void(gr_buffer_handle, size_t, const void*)> update_buffer = gr_screen.gf_update_buffer_data;
+	measure("gr_update_buffer_data (std::function)", [&update_buffer]() {
+		for (int i = 0; i < Num_calls; ++i) {
+			update_buffer(gr_buffer_handle(i & 0xFF), 64, nullptr);
+		}
+	});
+
+	vertex_layout layout;
+	measure("gr_render_primitives", [&layout]() {
+		for (int i = 0; i < Num_calls; ++i) {
+			gr_render_primitives(nullptr, PRIM_TYPE_TRIS, &layout, 0, 3, gr_buffer_handle(i & 0xFF));
+		}
+	});
+	std::function<void(material*, primitive_type, vertex_layout*, int, int, gr_buffer_handle, size_t)>
+		render_primitives = gr_screen.gf_render_primitives;
+	measure("gr_render_primitives (std::function)", [&layout, &render_primitives]() {
+		for (int i = 0; i < Num_calls; ++i) {
+			render_primitives(nullptr, PRIM_TYPE_TRIS, &layout, 0, 3, gr_buffer_handle(i & 0xFF), 0);
+		}
+	});
+
+	// The stub returns 0 for everything, this also keeps the calls from being optimized out
+	ASSERT_EQ(0, sum);
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include "graphics/util/QuadBatch.h"
+
+using namespace graphics::util;
+
+namespace {
+material make_material(float red)
+{
+	material mat;
+	mat.set_color(red, 1.0f, 1.0f, 1.0f);
+	return mat;
+}
+
+void add_quad(QuadBatch& batch, const material& mat, float x)
+{
+	batch.addQuad(mat, x, 0.0f, 0.0f, 0.0f, x + 10.0f, 10.0f, 1.0f, 1.0f);
+}
+} // namespace
+
+TEST(QuadBatchTest, mergesConsecutiveQuads)
+{
+	QuadBatch batch;
+	auto red   = make_material(1.0f);
+	auto green = make_material(0.0f);
+
+	add_quad(batch, red, 0.0f);
+	add_quad(batch, red, 10.0f);
+	add_quad(batch, green, 20.0f);
+	add_quad(batch, red, 30.0f);
+
+	ASSERT_EQ(batch.vertices().size(), 24u);
+	ASSERT_EQ(batch.runs().size(), 3u);
+	ASSERT_EQ(batch.runs()[0].n_verts, 12);
+	ASSERT_EQ(batch.runs()[1].first_vert, 12);
+	ASSERT_EQ(batch.runs()[2].first_vert, 18);
+
+	batch.clear();
+	ASSERT_TRUE(batch.empty());
+	ASSERT_TRUE(batch.vertices().empty());
+}
+
+TEST(QuadBatchTest, captureStartsOwnRun)
+{
+	QuadBatch batch;
+	auto red = make_material(1.0f);
+
+	add_quad(batch, red, 0.0f);
+
+	batch.beginCapture();
+	add_quad(batch, red, 10.0f);
+	add_quad(batch, red, 20.0f);
+
+	quad_batch_capture capture;
+	ASSERT_TRUE(batch.endCapture(&capture));
+
+	// split from the quad before the capture even though the material is the same
+	ASSERT_EQ(batch.runs().size(), 2u);
+
+	ASSERT_EQ(capture.verts.size(), 12u);
+	ASSERT_EQ(capture.runs.size(), 1u);
+	ASSERT_EQ(capture.runs[0].first_vert, 0);
+	ASSERT_EQ(capture.runs[0].n_verts, 12);
+	ASSERT_EQ(capture.verts[0].x, 10.0f);
+
+	// quads after the capture may merge with it again
+	add_quad(batch, red, 30.0f);
+	ASSERT_EQ(batch.runs().size(), 2u);
+}
+
+TEST(QuadBatchTest, replayMatchesAddingQuads)
+{
+	auto red   = make_material(1.0f);
+	auto green = make_material(0.0f);
+
+	QuadBatch batch;
+	batch.beginCapture();
+	add_quad(batch, red, 0.0f);
+	add_quad(batch, green, 10.0f);
+	quad_batch_capture capture;
+	ASSERT_TRUE(batch.endCapture(&capture));
+	batch.clear();
+
+	// the first run merges with the quad before it, the rest is appended in order
+	add_quad(batch, red, 100.0f);
+	batch.replay(capture);
+
+	QuadBatch expected;
+	add_quad(expected, red, 100.0f);
+	add_quad(expected, red, 0.0f);
+	add_quad(expected, green, 10.0f);
+
+	ASSERT_EQ(batch.runs().size(), expected.runs().size());
+	for (size_t i = 0; i < expected.runs().size(); ++i) {
+		ASSERT_TRUE(batch.runs()[i].mat == expected.runs()[i].mat);
+		ASSERT_EQ(batch.runs()[i].first_vert, expected.runs()[i].first_vert);
+		ASSERT_EQ(batch.runs()[i].n_verts, expected.runs()[i].n_verts);
+	}
+
+	ASSERT_EQ(batch.vertices().size(), expected.vertices().size());
+	for (size_t i = 0; i < expected.vertices().size(); ++i) {
+		ASSERT_EQ(batch.vertices()[i].x, expected.vertices()[i].x);
+		ASSERT_EQ(batch.vertices()[i].y, expected.vertices()[i].y);
+	}
+}
+
+TEST(QuadBatchTest, replayAfterCaptureStartKeepsOwnRun)
+{
+	auto red = make_material(1.0f);
+
+	QuadBatch batch;
+	batch.beginCapture();
+	add_quad(batch, red, 0.0f);
+	quad_batch_capture capture;
+	ASSERT_TRUE(batch.endCapture(&capture));
+	batch.clear();
+
+	// replaying inside another capture must not merge into the quads before it
+	add_quad(batch, red, 100.0f);
+	batch.beginCapture();
+	batch.replay(capture);
+
+	quad_batch_capture outer;
+	ASSERT_TRUE(batch.endCapture(&outer));
+	ASSERT_EQ(batch.runs().size(), 2u);
+	ASSERT_EQ(outer.verts.size(), 6u);
+	ASSERT_EQ(outer.verts[0].x, 0.0f);
+}
+
+TEST(QuadBatchTest, breakFailsCapture)
+{
+	auto red = make_material(1.0f);
+
+	QuadBatch batch;
+	add_quad(batch, red, 0.0f);
+
+	batch.beginCapture();
+	add_quad(batch, red, 10.0f);
+
+	// something was drawn outside of the batch, the queue was drawn before it
+	batch.markBreak();
+	batch.clear();
+	add_quad(batch, red, 20.0f);
+
+	quad_batch_capture capture;
+	capture.verts.resize(6);
+	ASSERT_FALSE(batch.endCapture(&capture));
+	ASSERT_TRUE(capture.verts.empty());
+	ASSERT_TRUE(capture.runs.empty());
+
+	// the next capture is unaffected
+	batch.beginCapture();
+	add_quad(batch, red, 30.0f);
+	ASSERT_TRUE(batch.endCapture(&capture));
+	ASSERT_EQ(capture.verts.size(), 6u);
+}
+
+TEST(QuadBatchTest, breakBeforeCaptureIsIgnored)
+{
+	auto red = make_material(1.0f);
+
+	QuadBatch batch;
+	add_quad(batch, red, 0.0f);
+	batch.markBreak();
+	batch.clear();
+
+	batch.beginCapture();
+	add_quad(batch, red, 10.0f);
+
+	quad_batch_capture capture;
+	ASSERT_TRUE(batch.endCapture(&capture));
+	ASSERT_EQ(capture.verts.size(), 6u);
+}
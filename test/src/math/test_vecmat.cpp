@@ -6,6 +6,12 @@
 
 #include "util/FSTestFixture.h"
 
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+
 using Random = util::Random;
 
 // "Correct" answers for matrix functions provided by Wolfram Mathematica 11
@@ -719,3 +725,139 @@ TEST_F(VecmatTest, orthogonalize_matrix) {
 	}
 }
 
+
+namespace {
+// The SIMD paths do the same operations in the same order as the scalar code but the compiler may still contract the
+// scalar multiplications and additions differently. Each component is a sum of three products which are all smaller
+// than the length of the input (the matrix is orthonormal), so the results may differ by a few units in the last place
+// of that length. Measuring relative to the result instead would fail whenever the products cancel out.
+const int Batch_max_ulps = 4;
+
+float ulp(float value)
+{
+	value = std::abs(value);
+	return std::nextafter(value, std::numeric_limits<float>::infinity()) - value;
+}
+
+void expect_vec_near(const vec3d& expected, const vec3d& actual, float scale)
+{
+	for (int i = 0; i < 3; ++i) {
+		EXPECT_NEAR(expected.a1d[i], actual.a1d[i], Batch_max_ulps * ulp(scale));
+	}
+}
+
+SCP_vector<vec3d> random_vectors(size_t count)
+{
+	SCP_vector<vec3d> out(count);
+	for (auto& v : out) {
+		static_randvec_unnormalized(Random::next(), &v);
+		vm_vec_scale(&v, 1000.0f * frand());
+	}
+	return out;
+}
+
+matrix random_orient()
+{
+	vec3d fvec, uvec;
+	matrix m;
+
+	static_randvec(Random::next(), &fvec);
+	static_randvec(Random::next(), &uvec);
+	vm_vector_2_matrix(&m, &fvec, &uvec);
+	return m;
+}
+} // namespace
+
+TEST_F(VecmatTest, test_vm_vec_rotate_batch)
+{
+	// cover every possible remainder after the groups of four
+	for (size_t count = 0; count < 14; ++count) {
+		auto m   = random_orient();
+		auto src = random_vectors(count);
+
+		SCP_vector<vec3d> dest(count);
+		vm_vec_rotate_batch(dest.data(), src.data(), count, &m);
+
+		for (size_t i = 0; i < count; ++i) {
+			vec3d expected;
+			vm_vec_rotate(&expected, &src[i], &m);
+			expect_vec_near(expected, dest[i], vm_vec_mag(&src[i]));
+		}
+
+		// in place
+		auto in_place = src;
+		vm_vec_rotate_batch(in_place.data(), in_place.data(), count, &m);
+		for (size_t i = 0; i < count; ++i) {
+			expect_vec_near(dest[i], in_place[i], vm_vec_mag(&src[i]));
+		}
+	}
+}
+
+TEST_F(VecmatTest, test_vm_vec_unrotate_batch)
+{
+	for (size_t count = 0; count < 14; ++count) {
+		auto m   = random_orient();
+		auto src = random_vectors(count);
+		vec3d offset;
+		static_randvec_unnormalized(Random::next(), &offset);
+
+		SCP_vector<vec3d> dest(count), dest_offset(count);
+		vm_vec_unrotate_batch(dest.data(), src.data(), count, &m);
+		vm_vec_unrotate_batch(dest_offset.data(), src.data(), count, &m, &offset);
+
+		for (size_t i = 0; i < count; ++i) {
+			float scale = vm_vec_mag(&src[i]);
+
+			vec3d expected;
+			vm_vec_unrotate(&expected, &src[i], &m);
+			expect_vec_near(expected, dest[i], scale);
+
+			// the offset is added last so it can be as large as the rotated vector
+			vm_vec_add2(&expected, &offset);
+			expect_vec_near(expected, dest_offset[i], scale + vm_vec_mag(&offset));
+		}
+	}
+}
+
+// Not run by default. Run with --gtest_also_run_disabled_tests --gtest_filter=*batch_rotate_cost to compare rotating
+// many points at once with doing it one by one.
+TEST_F(VecmatTest, DISABLED_batch_rotate_cost)
+{
+	const size_t num_points = 4096;
+	const int num_iterations = 200;
+
+	auto m   = random_orient();
+	auto src = random_vectors(num_points);
+	SCP_vector<vec3d> single(num_points), batch(num_points);
+
+	auto measure = [&](const char* label, const std::function<void()>& func) {
+		const auto start = std::chrono::high_resolution_clock::now();
+		for (int iter = 0; iter < num_iterations; ++iter) {
+			func();
+		}
+		const auto end = std::chrono::high_resolution_clock::now();
+		const auto ns  = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+		std::cout << label << ": " << static_cast<double>(ns) / (num_points * num_iterations) << " ns per point"
+		          << std::endl;
+	};
+
+	measure("vm_vec_rotate", [&]() {
+		for (size_t i = 0; i < num_points; ++i) {
+			vm_vec_rotate(&single[i], &src[i], &m);
+		}
+	});
+	measure("vm_vec_rotate_batch", [&]() { vm_vec_rotate_batch(batch.data(), src.data(), num_points, &m); });
+
+	measure("vm_vec_unrotate", [&]() {
+		for (size_t i = 0; i < num_points; ++i) {
+			vm_vec_unrotate(&single[i], &src[i], &m);
+		}
+	});
+	measure("vm_vec_unrotate_batch", [&]() { vm_vec_unrotate_batch(batch.data(), src.data(), num_points, &m); });
+
+	// also keeps the loops from being optimized out
+	for (size_t i = 0; i < num_points; ++i) {
+		expect_vec_near(single[i], batch[i], vm_vec_mag(&src[i]));
+	}
+}
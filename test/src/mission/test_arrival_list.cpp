@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include "globalincs/linklist.h"
+#include "mission/missionparse.h"
+
+namespace {
+p_object* linear_find(const char* name)
+{
+	for (p_object* p_objp = GET_FIRST(&Ship_arrival_list); p_objp != END_OF_LIST(&Ship_arrival_list);
+	     p_objp = GET_NEXT(p_objp)) {
+		if (!stricmp(p_objp->name, name)) {
+			return p_objp;
+		}
+	}
+	return nullptr;
+}
+} // namespace
+
+class ArrivalListTest : public ::testing::Test {
+  protected:
+	void SetUp() override { mission_parse_reset_arrival_list(); }
+
+	void TearDown() override { mission_parse_reset_arrival_list(); }
+
+	void create_objects(size_t count)
+	{
+		_objects.reset(new p_object[count]);
+		for (size_t i = 0; i < count; ++i) {
+			sprintf(_objects[i].name, "Ship %d", (int)i);
+			_objects[i].net_signature = (ushort)(i + 1);
+		}
+	}
+
+	std::unique_ptr<p_object[]> _objects;
+};
+
+TEST_F(ArrivalListTest, lookupByName)
+{
+	create_objects(3);
+
+	mission_parse_add_arrival_ship(&_objects[0]);
+	mission_parse_add_arrival_ship(&_objects[1]);
+
+	ASSERT_EQ(&_objects[0], mission_parse_get_arrival_ship("Ship 0"));
+	ASSERT_EQ(&_objects[1], mission_parse_get_arrival_ship("SHIP 1"));
+	ASSERT_EQ(nullptr, mission_parse_get_arrival_ship("Ship 2"));
+	ASSERT_EQ(nullptr, mission_parse_get_arrival_ship((const char*)nullptr));
+
+	mission_parse_remove_arrival_ship(&_objects[0]);
+
+	ASSERT_EQ(nullptr, mission_parse_get_arrival_ship("Ship 0"));
+	ASSERT_EQ(&_objects[1], mission_parse_get_arrival_ship("Ship 1"));
+	ASSERT_EQ(&_objects[1], GET_FIRST(&Ship_arrival_list));
+}
+
+TEST_F(ArrivalListTest, lookupBySignature)
+{
+	create_objects(2);
+
+	mission_parse_add_arrival_ship(&_objects[0]);
+	mission_parse_add_arrival_ship(&_objects[1]);
+
+	ASSERT_EQ(&_objects[0], mission_parse_get_arrival_ship((ushort)1));
+	ASSERT_EQ(&_objects[1], mission_parse_get_arrival_ship((ushort)2));
+	ASSERT_EQ(nullptr, mission_parse_get_arrival_ship((ushort)3));
+
+	// Wing ships get a new signature for every wave while they stay on the list
+	mission_parse_set_net_signature(&_objects[1], 10);
+
+	ASSERT_EQ(nullptr, mission_parse_get_arrival_ship((ushort)2));
+	ASSERT_EQ(&_objects[1], mission_parse_get_arrival_ship((ushort)10));
+
+	mission_parse_remove_arrival_ship(&_objects[1]);
+
+	ASSERT_EQ(nullptr, mission_parse_get_arrival_ship((ushort)10));
+}
+
+TEST_F(ArrivalListTest, duplicateKeysUseListOrder)
+{
+	// In single player every parse object has the signature 0
+	create_objects(3);
+	for (size_t i = 0; i < 3; ++i) {
+		_objects[i].net_signature = 0;
+	}
+
+	mission_parse_add_arrival_ship(&_objects[0]);
+	mission_parse_add_arrival_ship(&_objects[1]);
+	mission_parse_add_arrival_ship(&_objects[2]);
+
+	ASSERT_EQ(&_objects[0], mission_parse_get_arrival_ship((ushort)0));
+
+	mission_parse_remove_arrival_ship(&_objects[0]);
+	ASSERT_EQ(&_objects[1], mission_parse_get_arrival_ship((ushort)0));
+
+	// Moving an object to a signature which is already in use must keep the list order
+	mission_parse_set_net_signature(&_objects[1], 5);
+	mission_parse_set_net_signature(&_objects[2], 5);
+	mission_parse_set_net_signature(&_objects[1], 0);
+	mission_parse_set_net_signature(&_objects[1], 5);
+
+	ASSERT_EQ(&_objects[1], mission_parse_get_arrival_ship((ushort)5));
+	ASSERT_EQ(nullptr, mission_parse_get_arrival_ship((ushort)0));
+}
+
+TEST_F(ArrivalListTest, signatureOfObjectNotOnList)
+{
+	create_objects(1);
+
+	mission_parse_set_net_signature(&_objects[0], 7);
+
+	ASSERT_EQ(7, _objects[0].net_signature);
+	ASSERT_EQ(nullptr, mission_parse_get_arrival_ship((ushort)7));
+}
+
+TEST_F(ArrivalListTest, reset)
+{
+	create_objects(2);
+
+	mission_parse_add_arrival_ship(&_objects[0]);
+	mission_parse_add_arrival_ship(&_objects[1]);
+
+	mission_parse_reset_arrival_list();
+
+	ASSERT_EQ(END_OF_LIST(&Ship_arrival_list), GET_FIRST(&Ship_arrival_list));
+	ASSERT_EQ(nullptr, mission_parse_get_arrival_ship("Ship 0"));
+	ASSERT_EQ(nullptr, mission_parse_get_arrival_ship((ushort)2));
+}
+
+TEST_F(ArrivalListTest, rename)
+{
+	create_objects(2);
+
+	mission_parse_add_arrival_ship(&_objects[0]);
+
+	// Wing ships are renamed for every wave and scripts can rename parse objects while they wait to arrive
+	mission_parse_set_name(&_objects[0], "Alpha 2");
+
+	ASSERT_STREQ("Alpha 2", _objects[0].name);
+	ASSERT_EQ(nullptr, mission_parse_get_arrival_ship("Ship 0"));
+	ASSERT_EQ(&_objects[0], mission_parse_get_arrival_ship("alpha 2"));
+
+	mission_parse_remove_arrival_ship(&_objects[0]);
+	ASSERT_EQ(nullptr, mission_parse_get_arrival_ship("Alpha 2"));
+
+	// Objects which are not on the list are only renamed
+	mission_parse_set_name(&_objects[1], "Beta 1");
+
+	ASSERT_STREQ("Beta 1", _objects[1].name);
+	ASSERT_EQ(nullptr, mission_parse_get_arrival_ship("Beta 1"));
+}
+
+TEST_F(ArrivalListTest, matchesListWalk)
+{
+	// Every name lookup must find the same object as the list walk the index replaced, including after renames which
+	// produce duplicate names
+	const int num_ships = 100;
+
+	create_objects(num_ships);
+	for (int i = 0; i < num_ships; ++i) {
+		mission_parse_add_arrival_ship(&_objects[i]);
+	}
+
+	for (int i = 0; i < num_ships; i += 3) {
+		mission_parse_set_name(&_objects[i], _objects[(i * 7) % num_ships].name);
+	}
+	for (int i = 0; i < num_ships; i += 5) {
+		mission_parse_remove_arrival_ship(&_objects[i]);
+	}
+
+	for (int i = 0; i < num_ships; ++i) {
+		char name[NAME_LENGTH];
+		sprintf(name, "Ship %d", i);
+
+		ASSERT_EQ(linear_find(name), mission_parse_get_arrival_ship(name)) << name;
+	}
+}
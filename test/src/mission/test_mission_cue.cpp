@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include "globalincs/systemvars.h"
+#include "mission/missioncue.h"
+#include "mission/missiongoals.h"
+#include "parse/sexp.h"
+
+class MissionCueTest : public ::testing::Test {
+  protected:
+	void SetUp() override
+	{
+		init_sexp();
+		mission_cue_reset();
+
+		_tracking = Mission_cue_tracking;
+		_verify   = Mission_cue_verify;
+
+		Mission_cue_tracking = true;
+		Mission_cue_verify   = false;
+
+		Missiontime = 0;
+		Mission_events.clear();
+	}
+
+	void TearDown() override
+	{
+		Mission_cue_tracking = _tracking;
+		Mission_cue_verify   = _verify;
+
+		Mission_events.clear();
+		mission_cue_reset();
+	}
+
+	// Builds ( <op> <args...> ) the same way the mission parser does
+	static int make_operator(const char* op, int args)
+	{
+		int op_node = alloc_sexp(op, SEXP_ATOM, SEXP_ATOM_OPERATOR, -1, args);
+		return alloc_sexp("", SEXP_LIST, SEXP_ATOM_LIST, op_node, -1);
+	}
+
+	static int make_number(const char* value, int rest = -1)
+	{
+		return alloc_sexp(value, SEXP_ATOM, SEXP_ATOM_NUMBER, -1, rest);
+	}
+
+	static int make_string(const char* value, int rest = -1)
+	{
+		return alloc_sexp(value, SEXP_ATOM, SEXP_ATOM_STRING, -1, rest);
+	}
+
+	static void add_event(const char* name)
+	{
+		mission_event event;
+		event.name    = name;
+		event.formula = Locked_sexp_false;
+		Mission_events.push_back(event);
+	}
+
+	bool _tracking = true;
+	bool _verify   = false;
+};
+
+TEST_F(MissionCueTest, skipsUnchangedEvents)
+{
+	add_event("Test");
+	int cue = make_operator("is-event-true-delay", make_string("Test", make_number("0")));
+
+	ASSERT_FALSE(mission_cue_eval(cue));
+
+	// The tracker was not told about the change so the result must come from the cache
+	Mission_events[0].result = 1;
+	ASSERT_FALSE(mission_cue_eval(cue));
+
+	mission_cue_fact_changed(CueFact::Events);
+	ASSERT_TRUE(mission_cue_eval(cue));
+}
+
+TEST_F(MissionCueTest, unrelatedChangesAreIgnored)
+{
+	add_event("Test");
+	int cue = make_operator("is-event-true-delay", make_string("Test", make_number("0")));
+
+	ASSERT_FALSE(mission_cue_eval(cue));
+
+	Mission_events[0].result = 1;
+	mission_cue_fact_changed(CueFact::MissionLog);
+	ASSERT_FALSE(mission_cue_eval(cue));
+}
+
+TEST_F(MissionCueTest, wakesUpForTimers)
+{
+	int cue = make_operator("has-time-elapsed", make_number("10"));
+
+	ASSERT_FALSE(mission_cue_eval(cue));
+
+	Missiontime = i2f(9);
+	ASSERT_FALSE(mission_cue_eval(cue));
+
+	Missiontime = i2f(10);
+	ASSERT_TRUE(mission_cue_eval(cue));
+}
+
+TEST_F(MissionCueTest, logicalOperators)
+{
+	add_event("Test");
+	int event_check = make_operator("is-event-true-delay", make_string("Test", make_number("0")));
+	int timer_check = make_operator("has-time-elapsed", make_number("5"));
+	Sexp_nodes[event_check].rest = timer_check;
+	int cue = make_operator("and", event_check);
+
+	ASSERT_FALSE(mission_cue_eval(cue));
+
+	Mission_events[0].result = 1;
+	mission_cue_fact_changed(CueFact::Events);
+	ASSERT_FALSE(mission_cue_eval(cue));
+
+	Missiontime = i2f(5);
+	ASSERT_TRUE(mission_cue_eval(cue));
+}
+
+TEST_F(MissionCueTest, untrackedOperatorsArePolled)
+{
+	add_event("Test");
+	// ( < 0 1 ) is constant but not one of the tracked operators so the cue must be evaluated every time
+	int comparison = make_operator("<", make_number("0", make_number("1")));
+	int event_check = make_operator("is-event-true-delay", make_string("Test", make_number("0")));
+	Sexp_nodes[comparison].rest = event_check;
+	int cue = make_operator("and", comparison);
+
+	ASSERT_FALSE(mission_cue_eval(cue));
+
+	Mission_events[0].result = 1;
+	ASSERT_TRUE(mission_cue_eval(cue));
+}
+
+TEST_F(MissionCueTest, disabledTracking)
+{
+	add_event("Test");
+	int cue = make_operator("is-event-true-delay", make_string("Test", make_number("0")));
+
+	ASSERT_FALSE(mission_cue_eval(cue));
+
+	Mission_cue_tracking = false;
+	Mission_events[0].result = 1;
+	ASSERT_TRUE(mission_cue_eval(cue));
+}
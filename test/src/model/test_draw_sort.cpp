@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include "graphics/material.h"
+#include "model/modelrender.h"
+
+namespace {
+model_material make_material(int texture)
+{
+	model_material mat;
+	mat.set_texture_map(TM_BASE_TYPE, texture);
+	mat.set_depth_mode(ZBUFFER_TYPE_FULL);
+	return mat;
+}
+} // namespace
+
+TEST(ModelDrawSortTest, keyOrdersByFieldPriority)
+{
+	// each field decides the order regardless of all fields after it
+	ASSERT_LT(model_draw_sort_key(ZBUFFER_TYPE_NONE, 127, 65535, 65535, 1000),
+		model_draw_sort_key(ZBUFFER_TYPE_READ, 0, 0, 0, 0));
+	ASSERT_LT(model_draw_sort_key(ZBUFFER_TYPE_FULL, 1, 65535, 65535, 1000),
+		model_draw_sort_key(ZBUFFER_TYPE_FULL, 2, 0, 0, 0));
+	ASSERT_LT(model_draw_sort_key(ZBUFFER_TYPE_FULL, 1, 5, 65535, 1000),
+		model_draw_sort_key(ZBUFFER_TYPE_FULL, 1, 6, 0, 0));
+	ASSERT_LT(model_draw_sort_key(ZBUFFER_TYPE_FULL, 1, 5, 7, 1000),
+		model_draw_sort_key(ZBUFFER_TYPE_FULL, 1, 5, 8, 0));
+	ASSERT_LT(model_draw_sort_key(ZBUFFER_TYPE_FULL, 1, 5, 7, 3),
+		model_draw_sort_key(ZBUFFER_TYPE_FULL, 1, 5, 7, 4));
+
+	ASSERT_EQ(model_draw_sort_key(ZBUFFER_TYPE_FULL, 1, 5, 7, 3), model_draw_sort_key(ZBUFFER_TYPE_FULL, 1, 5, 7, 3));
+}
+
+TEST(ModelDrawSortTest, keyClampsLargeValues)
+{
+	// values which don't fit into their bits must not spill into the fields before them
+	ASSERT_EQ(model_draw_sort_key(ZBUFFER_TYPE_FULL, 1000, 0, 0, 0), model_draw_sort_key(ZBUFFER_TYPE_FULL, 127, 0, 0, 0));
+	ASSERT_LT(model_draw_sort_key(ZBUFFER_TYPE_FULL, 1, 100000, 0, 0), model_draw_sort_key(ZBUFFER_TYPE_FULL, 2, 0, 0, 0));
+	ASSERT_LT(model_draw_sort_key(ZBUFFER_TYPE_FULL, 1, 5, 100000, 0), model_draw_sort_key(ZBUFFER_TYPE_FULL, 1, 6, 0, 0));
+	ASSERT_LT(model_draw_sort_key(ZBUFFER_TYPE_FULL, 1, 5, 7, 1u << 30), model_draw_sort_key(ZBUFFER_TYPE_FULL, 1, 5, 8, 0));
+
+	// an invalid vertex buffer sorts first
+	ASSERT_EQ(model_draw_sort_key(ZBUFFER_TYPE_FULL, 1, -1, 0, 0), model_draw_sort_key(ZBUFFER_TYPE_FULL, 1, 0, 0, 0));
+}
+
+TEST(ModelDrawSortTest, materialTableDeduplicates)
+{
+	model_material_table table;
+
+	auto first  = make_material(10);
+	auto second = make_material(11);
+
+	auto first_index = table.add(first);
+	ASSERT_EQ(first_index, table.add(first));
+	ASSERT_EQ(first_index, table.add(make_material(10)));
+
+	auto second_index = table.add(second);
+	ASSERT_NE(first_index, second_index);
+	ASSERT_EQ((size_t)2, table.size());
+
+	ASSERT_TRUE(table.get(first_index) == first);
+	ASSERT_TRUE(table.get(second_index) == second);
+
+	table.clear();
+	ASSERT_EQ((size_t)0, table.size());
+	ASSERT_EQ(0, table.add(second));
+}
+
+TEST(ModelDrawSortTest, materialTableSeparatesSameSignature)
+{
+	// these only differ in state which is not part of the signature so they end up in the same chain
+	model_material_table table;
+
+	auto plain = make_material(10);
+	auto lit   = make_material(10);
+	lit.set_lighting(true);
+	auto colored = make_material(10);
+	colored.set_color(0.5f, 0.5f, 0.5f, 1.0f);
+
+	auto plain_index   = table.add(plain);
+	auto lit_index     = table.add(lit);
+	auto colored_index = table.add(colored);
+
+	ASSERT_NE(plain_index, lit_index);
+	ASSERT_NE(plain_index, colored_index);
+	ASSERT_NE(lit_index, colored_index);
+
+	// found further down the chain as well
+	ASSERT_EQ(colored_index, table.add(colored));
+	ASSERT_EQ(lit_index, table.add(lit));
+	ASSERT_EQ((size_t)3, table.size());
+}
+
+TEST(ModelDrawSortTest, materialEquality)
+{
+	material a;
+	material b;
+	ASSERT_TRUE(a == b);
+
+	b.set_texture_map(TM_GLOW_TYPE, 3);
+	ASSERT_FALSE(a == b);
+	b = a;
+
+	b.set_blend_mode(ALPHA_BLEND_ADDITIVE);
+	ASSERT_FALSE(a == b);
+	b = a;
+
+	b.set_color(1.0f, 0.0f, 1.0f, 1.0f);
+	ASSERT_FALSE(a == b);
+	b = a;
+
+	b.set_depth_bias(1);
+	ASSERT_FALSE(a == b);
+	b = a;
+
+	// the clip plane is only compared while it is enabled
+	vec3d normal   = vm_vec_new(0.0f, 0.0f, 1.0f);
+	vec3d position = vm_vec_new(0.0f, 0.0f, 0.0f);
+	vec3d moved    = vm_vec_new(0.0f, 0.0f, 5.0f);
+	a.set_clip_plane(normal, position);
+	b.set_clip_plane(normal, moved);
+	ASSERT_FALSE(a == b);
+	a.set_clip_plane();
+	b.set_clip_plane();
+	ASSERT_TRUE(a == b);
+
+	// the same for the stencil state
+	a.set_stencil_mask(0x0F);
+	ASSERT_TRUE(a == b);
+	a.set_stencil_test(true);
+	b.set_stencil_test(true);
+	ASSERT_FALSE(a == b);
+	b.set_stencil_mask(0x0F);
+	ASSERT_TRUE(a == b);
+}
+
+TEST(ModelDrawSortTest, modelMaterialEquality)
+{
+	auto a = make_material(10);
+	auto b = make_material(10);
+	ASSERT_TRUE(a == b);
+
+	b.set_desaturation(true);
+	ASSERT_FALSE(a == b);
+	b = a;
+
+	team_color red  = {{1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}};
+	team_color blue = {{0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}};
+	a.set_team_color(red);
+	b.set_team_color(blue);
+	ASSERT_FALSE(a == b);
+	b.set_team_color(red);
+	ASSERT_TRUE(a == b);
+	a.set_team_color();
+	ASSERT_FALSE(a == b);
+	b.set_team_color();
+	ASSERT_TRUE(a == b);
+
+	a.set_fog(10, 10, 10, 1.0f, 100.0f);
+	b.set_fog(10, 10, 10, 1.0f, 200.0f);
+	ASSERT_FALSE(a == b);
+	a.set_fog();
+	b.set_fog();
+	ASSERT_TRUE(a == b);
+
+	// the base material state counts as well
+	b.set_texture_map(TM_BASE_TYPE, 11);
+	ASSERT_FALSE(a == b);
+}
@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+#include <model/model.h>
+#include <model/modelcache.h>
+
+namespace {
+
+void fill_collision_tree(bsp_collision_tree* tree)
+{
+	tree->n_verts    = 3;
+	tree->point_list = static_cast<vec3d*>(vm_malloc(sizeof(vec3d) * tree->n_verts));
+	for (int i = 0; i < tree->n_verts; ++i) {
+		tree->point_list[i] = vec3d{{{static_cast<float>(i), 1.0f, 2.0f}}};
+	}
+
+	tree->n_nodes   = 1;
+	tree->node_list = static_cast<bsp_collision_node*>(vm_malloc(sizeof(bsp_collision_node)));
+	memset(tree->node_list, 0, sizeof(bsp_collision_node));
+	tree->node_list[0].back      = -1;
+	tree->node_list[0].front     = -1;
+	tree->node_list[0].leaf      = 0;
+	tree->node_list[0].max.xyz.x = 5.0f;
+
+	tree->n_leaves  = 1;
+	tree->leaf_list = static_cast<bsp_collision_leaf*>(vm_malloc(sizeof(bsp_collision_leaf)));
+	memset(tree->leaf_list, 0, sizeof(bsp_collision_leaf));
+	tree->leaf_list[0].vert_start = 0;
+	tree->leaf_list[0].num_verts  = 3;
+	tree->leaf_list[0].next       = -1;
+
+	tree->vert_list = static_cast<model_tmap_vert*>(vm_malloc(sizeof(model_tmap_vert) * 3));
+	for (uint i = 0; i < 3; ++i) {
+		tree->vert_list[i].vertnum = i;
+		tree->vert_list[i].normnum = i;
+		tree->vert_list[i].u       = 0.5f;
+		tree->vert_list[i].v       = 0.25f;
+	}
+
+	tree->poly_centers.push_back(vec3d{{{1.0f, 1.0f, 2.0f}}});
+}
+
+} // namespace
+
+class ModelCacheTest : public ::testing::Test {
+  protected:
+	void SetUp() override
+	{
+		key.pof_checksum      = 0x12345678;
+		key.pof_size          = 1024;
+		key.texture_signature = 42;
+		key.tangents          = false;
+		key.vertex_buffers    = true;
+
+		source   = make_model();
+		restored = make_model();
+
+		source->submodel[0].collision_tree_index = model_create_bsp_collision_tree();
+		fill_collision_tree(model_get_bsp_collision_tree(source->submodel[0].collision_tree_index));
+
+		auto& vb             = source->submodel[0].buffer;
+		vb.flags             = VB_FLAG_POSITION | VB_FLAG_NORMAL | VB_FLAG_UV1;
+		vb.stride            = 16;
+		vb.vertex_offset     = 0;
+		vb.vertex_num_offset = 0;
+
+		buffer_data buffer;
+		buffer.texture      = 2;
+		buffer.n_verts      = 3;
+		buffer.index_offset = 0;
+		buffer.i_first      = 0;
+		buffer.i_last       = 2;
+		vb.tex_buf.push_back(buffer);
+
+		source->submodel[0].n_verts_outline = 2;
+		source->submodel[0].outline_buffer  = static_cast<vertex*>(vm_malloc(sizeof(vertex) * 2));
+		memset(source->submodel[0].outline_buffer, 0, sizeof(vertex) * 2);
+		source->submodel[0].outline_buffer[1].world.xyz.y = 3.0f;
+
+		source->flags |= PM_FLAG_BATCHED;
+
+		source->vert_source.Vertex_list_size = 48;
+		source->vert_source.Vertex_list      = vm_malloc(source->vert_source.Vertex_list_size);
+		memset(source->vert_source.Vertex_list, 7, source->vert_source.Vertex_list_size);
+
+		source->vert_source.Index_list_size = 8;
+		source->vert_source.Index_list      = vm_malloc(source->vert_source.Index_list_size);
+		memset(source->vert_source.Index_list, 3, source->vert_source.Index_list_size);
+	}
+
+	void TearDown() override
+	{
+		free_model(source);
+		free_model(restored);
+	}
+
+	static polymodel* make_model()
+	{
+		auto pm             = new polymodel();
+		pm->n_models        = 1;
+		pm->submodel        = new bsp_info[1];
+		pm->n_detail_levels = 1;
+		strcpy_s(pm->filename, "test.pof");
+		return pm;
+	}
+
+	static void free_model(polymodel* pm)
+	{
+		auto& sm = pm->submodel[0];
+		if (sm.collision_tree_index >= 0) {
+			model_remove_bsp_collision_tree(sm.collision_tree_index);
+		}
+		if (sm.outline_buffer != nullptr) {
+			vm_free(sm.outline_buffer);
+		}
+		if (pm->vert_source.Vertex_list != nullptr) {
+			vm_free(pm->vert_source.Vertex_list);
+		}
+		if (pm->vert_source.Index_list != nullptr) {
+			vm_free(pm->vert_source.Index_list);
+		}
+
+		delete[] pm->submodel;
+		delete pm;
+	}
+
+	model_cache_key key;
+	polymodel* source   = nullptr;
+	polymodel* restored = nullptr;
+};
+
+TEST_F(ModelCacheTest, roundtrip)
+{
+	SCP_vector<ubyte> data;
+	model_cache_write(source, key, 16, data);
+
+	size_t stride = 0;
+	ASSERT_TRUE(model_cache_read(restored, key, data.data(), data.size(), stride));
+	ASSERT_EQ(16, (int)stride);
+
+	auto src_tree = model_get_bsp_collision_tree(source->submodel[0].collision_tree_index);
+	auto dst_tree = model_get_bsp_collision_tree(restored->submodel[0].collision_tree_index);
+	ASSERT_NE(src_tree, dst_tree);
+
+	ASSERT_EQ(src_tree->n_verts, dst_tree->n_verts);
+	ASSERT_EQ(src_tree->n_nodes, dst_tree->n_nodes);
+	ASSERT_EQ(src_tree->n_leaves, dst_tree->n_leaves);
+	ASSERT_EQ(0, memcmp(src_tree->point_list, dst_tree->point_list, sizeof(vec3d) * src_tree->n_verts));
+	ASSERT_EQ(0, memcmp(src_tree->node_list, dst_tree->node_list, sizeof(bsp_collision_node) * src_tree->n_nodes));
+	ASSERT_EQ(0, memcmp(src_tree->leaf_list, dst_tree->leaf_list, sizeof(bsp_collision_leaf) * src_tree->n_leaves));
+	ASSERT_EQ(0, memcmp(src_tree->vert_list, dst_tree->vert_list, sizeof(model_tmap_vert) * 3));
+	ASSERT_EQ(1, (int)dst_tree->poly_centers.size());
+
+	const auto& vb = restored->submodel[0].buffer;
+	ASSERT_EQ(source->submodel[0].buffer.flags, vb.flags);
+	ASSERT_EQ(16, (int)vb.stride);
+	ASSERT_GT(vb.layout.get_num_vertex_components(), (size_t)0);
+	ASSERT_EQ(1, (int)vb.tex_buf.size());
+	ASSERT_EQ(2, vb.tex_buf[0].texture);
+	ASSERT_EQ(3, (int)vb.tex_buf[0].n_verts);
+	ASSERT_EQ(2u, vb.tex_buf[0].i_last);
+
+	// An empty buffer must not get a vertex layout
+	ASSERT_EQ((size_t)0, restored->submodel[0].trans_buffer.layout.get_num_vertex_components());
+
+	ASSERT_EQ(2u, restored->submodel[0].n_verts_outline);
+	ASSERT_FLOAT_EQ(3.0f, restored->submodel[0].outline_buffer[1].world.xyz.y);
+
+	ASSERT_TRUE(restored->flags & PM_FLAG_BATCHED);
+
+	ASSERT_EQ(source->vert_source.Vertex_list_size, restored->vert_source.Vertex_list_size);
+	ASSERT_EQ(0, memcmp(source->vert_source.Vertex_list, restored->vert_source.Vertex_list,
+	                    source->vert_source.Vertex_list_size));
+	ASSERT_EQ(source->vert_source.Index_list_size, restored->vert_source.Index_list_size);
+	ASSERT_EQ(0, memcmp(source->vert_source.Index_list, restored->vert_source.Index_list,
+	                    source->vert_source.Index_list_size));
+}
+
+TEST_F(ModelCacheTest, stale_key)
+{
+	SCP_vector<ubyte> data;
+	model_cache_write(source, key, 16, data);
+
+	auto changed = key;
+	changed.texture_signature++;
+
+	size_t stride = 0;
+	ASSERT_FALSE(model_cache_read(restored, changed, data.data(), data.size(), stride));
+	ASSERT_EQ(-1, restored->submodel[0].collision_tree_index);
+}
+
+TEST_F(ModelCacheTest, truncated_data)
+{
+	SCP_vector<ubyte> data;
+	model_cache_write(source, key, 16, data);
+	data.resize(data.size() - 4);
+
+	size_t stride = 0;
+	ASSERT_FALSE(model_cache_read(restored, key, data.data(), data.size(), stride));
+
+	// Nothing of the partially read data may be left behind
+	ASSERT_EQ(-1, restored->submodel[0].collision_tree_index);
+	ASSERT_EQ(nullptr, restored->submodel[0].outline_buffer);
+	ASSERT_EQ(nullptr, restored->vert_source.Vertex_list);
+	ASSERT_EQ(nullptr, restored->vert_source.Index_list);
+}
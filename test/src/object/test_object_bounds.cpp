@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include "globalincs/linklist.h"
+#include "object/object.h"
+#include "object/objectbounds.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace {
+const int Num_test_objects = 3000;
+const int Num_iterations   = 100;
+
+template <typename Func>
+void measure(const char* label, Func func)
+{
+	const auto start = std::chrono::high_resolution_clock::now();
+
+	func();
+
+	const auto end = std::chrono::high_resolution_clock::now();
+	const auto ns  = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+	std::cout << label << ": " << static_cast<double>(ns) / (Num_test_objects * Num_iterations) << " ns per object"
+			  << std::endl;
+}
+} // namespace
+
+class ObjectBoundsTest : public ::testing::Test {
+  protected:
+	void SetUp() override
+	{
+		_saved_first = obj_used_list.next;
+		_saved_last  = obj_used_list.prev;
+		list_init(&obj_used_list);
+	}
+
+	void TearDown() override
+	{
+		for (int i = 0; i < Num_test_objects; ++i) {
+			Objects[i].type = OBJ_NONE;
+		}
+
+		obj_used_list.next = _saved_first;
+		obj_used_list.prev = _saved_last;
+	}
+
+	static object* make_object(int objnum, char type, const vec3d& pos, const vec3d& last_pos, float radius)
+	{
+		auto objp      = &Objects[objnum];
+		objp->type     = type;
+		objp->pos      = pos;
+		objp->last_pos = last_pos;
+		objp->radius   = radius;
+		return objp;
+	}
+
+	object* _saved_first = nullptr;
+	object* _saved_last  = nullptr;
+};
+
+TEST_F(ObjectBoundsTest, shipBoundsAreSphereBox)
+{
+	vec3d pos = vm_vec_new(10.0f, -20.0f, 30.0f);
+	auto objp = make_object(0, OBJ_SHIP, pos, vmd_zero_vector, 5.0f);
+
+	obj_bounds_update(objp);
+
+	ASSERT_FLOAT_EQ(5.0f, Obj_bounds.radius[0]);
+	ASSERT_FLOAT_EQ(10.0f, Obj_bounds.pos[0].xyz.x);
+	ASSERT_FLOAT_EQ(5.0f, Obj_bounds.sweep_min[0].xyz.x);
+	ASSERT_FLOAT_EQ(-25.0f, Obj_bounds.sweep_min[0].xyz.y);
+	ASSERT_FLOAT_EQ(25.0f, Obj_bounds.sweep_min[0].xyz.z);
+	ASSERT_FLOAT_EQ(15.0f, Obj_bounds.sweep_max[0].xyz.x);
+	ASSERT_FLOAT_EQ(-15.0f, Obj_bounds.sweep_max[0].xyz.y);
+	ASSERT_FLOAT_EQ(35.0f, Obj_bounds.sweep_max[0].xyz.z);
+}
+
+TEST_F(ObjectBoundsTest, weaponBoundsIncludePath)
+{
+	vec3d pos      = vm_vec_new(100.0f, 0.0f, -50.0f);
+	vec3d last_pos = vm_vec_new(0.0f, 0.0f, 50.0f);
+	auto objp      = make_object(1, OBJ_WEAPON, pos, last_pos, 1.0f);
+
+	obj_bounds_update(objp);
+
+	ASSERT_FLOAT_EQ(-1.0f, Obj_bounds.sweep_min[1].xyz.x);
+	ASSERT_FLOAT_EQ(-51.0f, Obj_bounds.sweep_min[1].xyz.z);
+	ASSERT_FLOAT_EQ(101.0f, Obj_bounds.sweep_max[1].xyz.x);
+	ASSERT_FLOAT_EQ(51.0f, Obj_bounds.sweep_max[1].xyz.z);
+}
+
+TEST_F(ObjectBoundsTest, frameUpdatePicksUpMovedObjects)
+{
+	// Positions set outside of physics (scripts, SEXPs, multiplayer updates) must be in the table once the next frame
+	// starts since the AI reads the distances from it
+	vec3d start = vm_vec_new(0.0f, 0.0f, 0.0f);
+	auto ship   = make_object(0, OBJ_SHIP, start, start, 10.0f);
+	auto weapon = make_object(1, OBJ_WEAPON, start, start, 1.0f);
+	list_append(&obj_used_list, ship);
+	list_append(&obj_used_list, weapon);
+	obj_bounds_update_all();
+
+	ship->pos    = vm_vec_new(500.0f, 0.0f, 0.0f);
+	ship->radius = 20.0f;
+	weapon->last_pos = weapon->pos;
+	weapon->pos      = vm_vec_new(0.0f, 0.0f, -300.0f);
+
+	obj_bounds_update_all();
+
+	ASSERT_FLOAT_EQ(500.0f, Obj_bounds.pos[0].xyz.x);
+	ASSERT_FLOAT_EQ(20.0f, Obj_bounds.radius[0]);
+	ASSERT_FLOAT_EQ(480.0f, Obj_bounds.sweep_min[0].xyz.x);
+	ASSERT_FLOAT_EQ(520.0f, Obj_bounds.sweep_max[0].xyz.x);
+
+	ASSERT_FLOAT_EQ(-300.0f, Obj_bounds.pos[1].xyz.z);
+	ASSERT_FLOAT_EQ(-301.0f, Obj_bounds.sweep_min[1].xyz.z);
+	ASSERT_FLOAT_EQ(1.0f, Obj_bounds.sweep_max[1].xyz.z);
+
+	// The distance the AI sees is the one between the live positions
+	ASSERT_FLOAT_EQ(vm_vec_dist(&ship->pos, &weapon->pos), vm_vec_dist(&Obj_bounds.pos[0], &Obj_bounds.pos[1]));
+}
+
+// Not run by default. Run with --gtest_also_run_disabled_tests --gtest_filter=*iterationCost to compare reading the
+// collision endpoints of every object through the objects and through the bounds table.
+TEST_F(ObjectBoundsTest, DISABLED_iterationCost)
+{
+	// The objects are visited in the order of a shuffled used list
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> coord(-10000.0f, 10000.0f);
+
+	SCP_vector<int> order;
+	for (int i = 0; i < Num_test_objects; ++i) {
+		vec3d pos = vm_vec_new(coord(gen), coord(gen), coord(gen));
+		obj_bounds_update(make_object(i, (i % 4 == 0) ? OBJ_SHIP : OBJ_WEAPON, pos, pos, 10.0f));
+		order.push_back(i);
+	}
+	std::shuffle(order.begin(), order.end(), gen);
+
+	float object_sum = 0.0f;
+	measure("endpoints from objects", [&]() {
+		for (int iter = 0; iter < Num_iterations; ++iter) {
+			for (int axis = 0; axis < 3; ++axis) {
+				for (auto objnum : order) {
+					const object* objp = &Objects[objnum];
+					float min_end      = objp->pos.a1d[axis];
+					if (objp->type == OBJ_WEAPON) {
+						min_end = std::min(min_end, objp->last_pos.a1d[axis]);
+					}
+					object_sum += min_end - objp->radius;
+				}
+			}
+		}
+	});
+
+	float table_sum = 0.0f;
+	measure("endpoints from bounds table", [&]() {
+		for (int iter = 0; iter < Num_iterations; ++iter) {
+			for (int axis = 0; axis < 3; ++axis) {
+				for (auto objnum : order) {
+					table_sum += Obj_bounds.sweep_min[objnum].a1d[axis];
+				}
+			}
+		}
+	});
+
+	// Both ways have to give the same result, this also keeps the loops from being optimized out
+	ASSERT_FLOAT_EQ(object_sum, table_sum);
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include "physics/physics.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace {
+const int Num_bodies = 3000;
+const int Num_frames = 100;
+const float Frametime = 1.0f / 60.0f;
+
+struct body {
+	vec3d pos;
+	matrix orient;
+	physics_info pi;
+};
+
+// Something that behaves like a missile: moving forward, turning and a bit of sideways slip
+SCP_vector<body> make_missiles(std::mt19937& gen)
+{
+	std::uniform_real_distribution<float> coord(-5000.0f, 5000.0f);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+	SCP_vector<body> bodies(Num_bodies);
+	for (int i = 0; i < Num_bodies; ++i) {
+		auto& b = bodies[i];
+		physics_init(&b.pi);
+
+		b.pos = vm_vec_new(coord(gen), coord(gen), coord(gen));
+
+		vec3d fvec = vm_vec_new(unit(gen), unit(gen), unit(gen) + 2.0f);
+		vm_vector_2_matrix(&b.orient, &fvec, nullptr, nullptr);
+
+		// a few different missile classes
+		b.pi.side_slip_time_const = 0.05f * (i % 3);
+		b.pi.rotdamp              = 0.1f + 0.1f * (i % 4);
+
+		b.pi.vel = b.orient.vec.fvec * 200.0f;
+		b.pi.desired_vel = b.orient.vec.fvec * 300.0f + vm_vec_new(unit(gen), unit(gen), unit(gen)) * 20.0f;
+		b.pi.desired_rotvel = vm_vec_new(unit(gen), unit(gen), unit(gen));
+
+		if (i % 5 == 0) {
+			b.pi.flags |= PF_NEWTONIAN_DAMP;
+		}
+		if (i % 7 == 0) {
+			b.pi.gravity_const = 1.0f;
+		}
+		if (i % 11 == 0) {
+			// takes the regular path inside the batch
+			b.pi.flags |= PF_DEAD_DAMP;
+		}
+		if (i % 13 == 0) {
+			b.pi.flags |= PF_CONST_VEL;
+		}
+	}
+	return bodies;
+}
+
+template <typename Func>
+void measure(const char* label, Func func)
+{
+	const auto start = std::chrono::high_resolution_clock::now();
+
+	func();
+
+	const auto end = std::chrono::high_resolution_clock::now();
+	const auto ns  = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+	std::cout << label << ": " << static_cast<double>(ns) / (Num_bodies * Num_frames) << " ns per body" << std::endl;
+}
+} // namespace
+
+TEST(PhysicsBatchTest, sameAsSingleBodies)
+{
+	std::mt19937 gen(1234);
+	auto single = make_missiles(gen);
+	auto batched = single;
+
+	vec3d gravity = vm_vec_new(0.0f, -9.81f, 0.0f);
+
+	physics_batch batch;
+	for (auto& b : batched) {
+		batch.add(&b.pos, &b.orient, &b.pi);
+	}
+
+	for (int frame = 0; frame < Num_frames; ++frame) {
+		for (auto& b : single) {
+			physics_sim(&b.pos, &b.orient, &b.pi, &gravity, Frametime);
+		}
+		physics_sim_batch(&batch, &gravity, Frametime);
+	}
+
+	for (int i = 0; i < Num_bodies; ++i) {
+		for (int axis = 0; axis < 3; ++axis) {
+			ASSERT_FLOAT_EQ(single[i].pos.a1d[axis], batched[i].pos.a1d[axis]);
+			ASSERT_FLOAT_EQ(single[i].pi.vel.a1d[axis], batched[i].pi.vel.a1d[axis]);
+			ASSERT_FLOAT_EQ(single[i].pi.rotvel.a1d[axis], batched[i].pi.rotvel.a1d[axis]);
+		}
+		for (int j = 0; j < 9; ++j) {
+			ASSERT_FLOAT_EQ(single[i].orient.a1d[j], batched[i].orient.a1d[j]);
+		}
+		ASSERT_FLOAT_EQ(single[i].pi.speed, batched[i].pi.speed);
+		ASSERT_FLOAT_EQ(single[i].pi.fspeed, batched[i].pi.fspeed);
+	}
+}
+
+// Not run by default. Run with --gtest_also_run_disabled_tests --gtest_filter=*simulationCost to compare the cost of
+// simulating 3000 missiles one by one and as a batch.
+TEST(PhysicsBatchTest, DISABLED_simulationCost)
+{
+	std::mt19937 gen(1234);
+	auto single = make_missiles(gen);
+	auto batched = single;
+
+	vec3d gravity = vm_vec_new(0.0f, -9.81f, 0.0f);
+
+	physics_batch batch;
+	for (auto& b : batched) {
+		batch.add(&b.pos, &b.orient, &b.pi);
+	}
+
+	measure("physics_sim", [&]() {
+		for (int frame = 0; frame < Num_frames; ++frame) {
+			for (auto& b : single) {
+				physics_sim(&b.pos, &b.orient, &b.pi, &gravity, Frametime);
+			}
+		}
+	});
+	measure("physics_sim_batch", [&]() {
+		for (int frame = 0; frame < Num_frames; ++frame) {
+			physics_sim_batch(&batch, &gravity, Frametime);
+		}
+	});
+
+	// also keeps the loops from being optimized out
+	for (int i = 0; i < Num_bodies; ++i) {
+		ASSERT_FLOAT_EQ(single[i].pos.xyz.x, batched[i].pos.xyz.x);
+	}
+}
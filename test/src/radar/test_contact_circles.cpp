@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include "radar/radar.h"
+
+namespace {
+struct drawn_group {
+	ubyte red;
+	int diameter;
+	SCP_vector<int> centers;
+};
+
+radar_contact_circle make_circle(ubyte red, int diameter, int x, int y)
+{
+	radar_contact_circle circle;
+	memset(&circle.clr, 0, sizeof(circle.clr));
+	circle.clr.red   = red;
+	circle.clr.alpha = 255;
+	circle.diameter  = diameter;
+	circle.x         = x;
+	circle.y         = y;
+	return circle;
+}
+
+SCP_vector<drawn_group> draw_groups(SCP_vector<radar_contact_circle>& circles)
+{
+	SCP_vector<drawn_group> groups;
+	SCP_vector<int> centers;
+
+	radar_draw_contact_circle_groups(circles, centers,
+		[&groups](const color& clr, int diameter, const int* group_centers, int n_circles) {
+			groups.push_back({clr.red, diameter, SCP_vector<int>(group_centers, group_centers + 2 * n_circles)});
+		});
+
+	return groups;
+}
+} // namespace
+
+TEST(RadarContactCirclesTest, groupsByColorAndSize)
+{
+	SCP_vector<radar_contact_circle> circles = {
+		make_circle(200, 4, 1, 2),
+		make_circle(100, 4, 3, 4),
+		make_circle(200, 6, 5, 6),
+		make_circle(200, 4, 7, 8),
+		make_circle(100, 4, 9, 10),
+	};
+
+	auto groups = draw_groups(circles);
+	ASSERT_EQ((size_t)3, groups.size());
+
+	// circles of a group keep the order they were added in
+	ASSERT_EQ(100, groups[0].red);
+	ASSERT_EQ(4, groups[0].diameter);
+	ASSERT_EQ((SCP_vector<int>{3, 4, 9, 10}), groups[0].centers);
+
+	ASSERT_EQ(200, groups[1].red);
+	ASSERT_EQ(4, groups[1].diameter);
+	ASSERT_EQ((SCP_vector<int>{1, 2, 7, 8}), groups[1].centers);
+
+	ASSERT_EQ(200, groups[2].red);
+	ASSERT_EQ(6, groups[2].diameter);
+	ASSERT_EQ((SCP_vector<int>{5, 6}), groups[2].centers);
+}
+
+TEST(RadarContactCirclesTest, alphaSeparatesGroups)
+{
+	SCP_vector<radar_contact_circle> circles = {make_circle(200, 4, 1, 2), make_circle(200, 4, 3, 4)};
+	circles[1].clr.alpha = 128;
+
+	auto groups = draw_groups(circles);
+	ASSERT_EQ((size_t)2, groups.size());
+	ASSERT_EQ((SCP_vector<int>{3, 4}), groups[0].centers);
+	ASSERT_EQ((SCP_vector<int>{1, 2}), groups[1].centers);
+}
+
+TEST(RadarContactCirclesTest, nothingToDraw)
+{
+	SCP_vector<radar_contact_circle> circles;
+	ASSERT_TRUE(draw_groups(circles).empty());
+}
@@ -1,6 +1,9 @@
 
 #include "scripting/ScriptingTestFixture.h"
 
+#include <chrono>
+#include <iostream>
+
 namespace {
 
 class HookVarsTest : public test::scripting::ScriptingTestFixture {
@@ -11,6 +14,19 @@ class HookVarsTest : public test::scripting::ScriptingTestFixture {
 	}
 };
 
+struct lazy_test_value {
+	int value = 0;
+	int pushes = 0;
+};
+
+void push_lazy_test_value(lua_State* L, void* data)
+{
+	auto val = static_cast<lazy_test_value*>(data);
+
+	++val->pushes;
+	::scripting::ade_set_args(L, "i", val->value);
+}
+
 } // namespace
 
 TEST_F(HookVarsTest, empty)
@@ -44,3 +60,109 @@ TEST_F(HookVarsTest, removeNonExistent)
 	// Should not cause any errors
 	_state->RemHookVar("Test");
 }
+
+TEST_F(HookVarsTest, lazyHookVars)
+{
+	lazy_test_value value;
+	value.value = 42;
+
+	const auto id = script_state::GetHookVariableId("Lazy");
+	_state->SetLazyHookVar(id, push_lazy_test_value, &value);
+
+	// Nothing should be converted until a script actually needs the value
+	ASSERT_EQ(0, value.pushes);
+
+	// The script reads the value twice but it should only be converted once
+	this->EvalTestScript();
+	ASSERT_EQ(1, value.pushes);
+
+	_state->RemHookVar(id);
+
+	this->EvalTestScript();
+	ASSERT_EQ(1, value.pushes);
+}
+
+TEST_F(HookVarsTest, repeatedBinding)
+{
+	// Binding and removing the same variable once per hook call must always give the script the current value
+	const int iterations = 100;
+
+	auto L        = _state->GetLuaSession();
+	const auto id = script_state::GetHookVariableId("Value");
+	auto reader   = luacpp::LuaFunction::createFromCode(L, "return hv.Value", "repeatedBinding");
+
+	lazy_test_value value;
+
+	auto bind = [&](bool eager, bool read) {
+		for (int i = 0; i < iterations; ++i) {
+			value.value = i;
+			if (eager) {
+				_state->SetHookVar("Value", 'i', i);
+			} else {
+				_state->SetLazyHookVar(id, push_lazy_test_value, &value);
+			}
+
+			if (read) {
+				auto ret = reader.call(L);
+				ASSERT_EQ(1, (int)ret.size());
+				ASSERT_EQ(i, ret.front().getValue<int>());
+			}
+
+			_state->RemHookVar(id);
+		}
+	};
+
+	bind(true, false);
+	bind(true, true);
+	bind(false, false);
+	ASSERT_EQ(0, value.pushes);
+
+	bind(false, true);
+	ASSERT_EQ(iterations, value.pushes);
+
+	ASSERT_FALSE(_state->IsHookVarSet(id));
+}
+
+// Not run by default. Run with --gtest_also_run_disabled_tests --gtest_filter=*bindingCost to see what binding a hook
+// parameter costs per hook call, both for the common case where no script reads the variable and for a script that
+// uses it.
+TEST_F(HookVarsTest, DISABLED_bindingCost)
+{
+	const int iterations = 100000;
+
+	auto L        = _state->GetLuaSession();
+	const auto id = script_state::GetHookVariableId("Value");
+	auto reader   = luacpp::LuaFunction::createFromCode(L, "return hv.Value", "bindingCost");
+
+	lazy_test_value value;
+
+	auto measure = [&](bool eager, bool read) {
+		const auto start = std::chrono::high_resolution_clock::now();
+
+		for (int i = 0; i < iterations; ++i) {
+			value.value = i;
+			if (eager) {
+				_state->SetHookVar("Value", 'i', i);
+			} else {
+				_state->SetLazyHookVar(id, push_lazy_test_value, &value);
+			}
+
+			if (read) {
+				reader.call(L);
+			}
+
+			_state->RemHookVar(id);
+		}
+
+		const auto end = std::chrono::high_resolution_clock::now();
+		const auto ns  = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+		std::cout << (eager ? "Eager" : "Lazy") << " binding " << (read ? "with" : "without")
+				  << " reading script: " << ns / iterations << " ns per hook call" << std::endl;
+	};
+
+	measure(true, false);
+	measure(true, true);
+	measure(false, false);
+	measure(false, true);
+}
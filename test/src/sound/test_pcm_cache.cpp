@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include "sound/pcm_cache.h"
+
+using namespace sound;
+
+namespace {
+pcm_cache_entry make_entry()
+{
+	pcm_cache_entry entry;
+	entry.props.bytes_per_sample = 2;
+	entry.props.num_channels     = 1;
+	entry.props.sample_rate      = 22050;
+	entry.props.total_samples    = 50;
+	entry.props.duration         = 50.0 / 22050.0;
+	entry.source_channels        = 2;
+
+	for (int i = 0; i < 100; ++i) {
+		entry.pcm.push_back((uint8_t)(i * 7));
+	}
+
+	return entry;
+}
+} // namespace
+
+TEST(PcmCacheTest, roundTrip)
+{
+	auto entry = make_entry();
+
+	SCP_vector<uint8_t> data;
+	pcm_cache_write(entry, data);
+
+	pcm_cache_entry read;
+	ASSERT_TRUE(pcm_cache_read(data.data(), data.size(), read));
+
+	ASSERT_EQ(read.props.bytes_per_sample, entry.props.bytes_per_sample);
+	ASSERT_EQ(read.props.num_channels, entry.props.num_channels);
+	ASSERT_EQ(read.props.sample_rate, entry.props.sample_rate);
+	ASSERT_EQ(read.props.total_samples, entry.props.total_samples);
+	ASSERT_FLOAT_EQ((float)read.props.duration, (float)entry.props.duration);
+	ASSERT_EQ(read.source_channels, entry.source_channels);
+	ASSERT_EQ(read.pcm, entry.pcm);
+}
+
+TEST(PcmCacheTest, rejectsTruncatedData)
+{
+	SCP_vector<uint8_t> data;
+	pcm_cache_write(make_entry(), data);
+
+	// every prefix is missing either part of the header or part of the samples
+	for (size_t size = 0; size < data.size(); ++size) {
+		pcm_cache_entry read;
+		ASSERT_FALSE(pcm_cache_read(data.data(), size, read)) << "size " << size;
+	}
+}
+
+TEST(PcmCacheTest, rejectsOtherFiles)
+{
+	SCP_vector<uint8_t> data;
+	pcm_cache_write(make_entry(), data);
+
+	// wrong magic
+	auto bad_magic = data;
+	bad_magic[0] ^= 0xFF;
+	pcm_cache_entry read;
+	ASSERT_FALSE(pcm_cache_read(bad_magic.data(), bad_magic.size(), read));
+
+	// a different format version
+	auto bad_version = data;
+	bad_version[4] += 1;
+	ASSERT_FALSE(pcm_cache_read(bad_version.data(), bad_version.size(), read));
+}
+
+TEST(PcmCacheTest, nameDependsOnFormat)
+{
+	auto name = pcm_cache_name(0x1234abcd, 4096, 3, false);
+
+	ASSERT_EQ(name, "snd_pcm-1234abcd-1000-3s.pcm");
+	ASSERT_NE(name, pcm_cache_name(0x1234abcd, 4096, 3, true));
+	ASSERT_NE(name, pcm_cache_name(0x1234abcd, 4096, 2, false));
+	ASSERT_NE(name, pcm_cache_name(0x1234abcd, 4097, 3, false));
+}
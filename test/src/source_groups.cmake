@@ -13,10 +13,18 @@ add_file_folder("Actions\\\\Expression"
 	actions/expression/test_ExpressionParser.cpp
 )
 
+add_file_folder("Asteroid"
+    asteroid/test_field_rocks.cpp
+)
+
 add_file_folder("CFile"
     cfile/cfile.cpp
 )
 
+add_file_folder("Executor"
+    executor/test_WorkerPool.cpp
+)
+
 add_file_folder("Globalincs"
     globalincs/test_flagset.cpp
     globalincs/test_safe_strings.cpp
@@ -24,7 +32,11 @@ add_file_folder("Globalincs"
 )
 
 add_file_folder("Graphics"
+	   graphics/test_command_recorder.cpp
 	   graphics/test_font.cpp
+	   graphics/test_frame_ring_buffer.cpp
+	   graphics/test_gr_dispatch.cpp
+	   graphics/test_quad_batch.cpp
 )
 
 add_file_folder("Math"
@@ -35,23 +47,42 @@ add_file_folder("menuui"
     menuui/test_intel_parse.cpp
 )
 
+add_file_folder("Mission"
+    mission/test_arrival_list.cpp
+    mission/test_mission_cue.cpp
+)
+
 add_file_folder("mod"
     mod/test_mod_table.cpp
 )
 
 add_file_folder("model"
+    model/test_draw_sort.cpp
+    model/test_modelcache.cpp
     model/test_modelread.cpp
 )
 
+add_file_folder("Object"
+    object/test_object_bounds.cpp
+)
+
 add_file_folder("Parse"
     parse/test_parselo.cpp
     parse/test_replace.cpp
 )
 
+add_file_folder("Physics"
+    physics/test_physics_batch.cpp
+)
+
 add_file_folder("Pilotfile"
     pilotfile/plr.cpp
 )
 
+add_file_folder("Radar"
+    radar/test_contact_circles.cpp
+)
+
 add_file_folder("Scripting"
     scripting/ade_args.cpp
     scripting/doc_parser.cpp
@@ -81,6 +112,10 @@ add_file_folder("Scripting\\\\Lua"
     scripting/lua/Value.cpp
 )
 
+add_file_folder("Sound"
+    sound/test_pcm_cache.cpp
+)
+
 add_file_folder("Test Util"
     util/FSTestFixture.cpp
     util/FSTestFixture.h
@@ -88,9 +123,14 @@ add_file_folder("Test Util"
 )
 
 add_file_folder("Utils"
+    utils/ChunkedPoolTest.cpp
     utils/HeapAllocatorTest.cpp
+    utils/RadixSortTest.cpp
+    utils/RunArenaTest.cpp
 )
 
 add_file_folder("Weapon"
+    weapon/test_beam_collisions.cpp
+    weapon/test_shockwave.cpp
     weapon/weapons.cpp
 )
@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+
+#include "utils/chunked_pool.h"
+
+#include <algorithm>
+#include <random>
+
+using namespace util;
+
+namespace {
+struct element {
+	int objnum = -1;
+	int value  = 0;
+};
+
+struct indexed_element {
+	int pool_index = -1;
+	int value      = 0;
+};
+} // namespace
+
+TEST(ChunkedPoolTest, allocateGrowsByChunks)
+{
+	chunked_pool<element, 4> pool;
+	ASSERT_EQ(0, pool.capacity());
+
+	for (int i = 0; i < 4; ++i) {
+		ASSERT_EQ(i, pool.allocate());
+	}
+	ASSERT_EQ(4, pool.capacity());
+
+	ASSERT_EQ(4, pool.allocate());
+	ASSERT_EQ(8, pool.capacity());
+	ASSERT_EQ(5, pool.size());
+
+	// New slots are value initialized
+	ASSERT_EQ(-1, pool[4].objnum);
+	ASSERT_EQ(0, pool[4].value);
+}
+
+TEST(ChunkedPoolTest, addressesAreStable)
+{
+	chunked_pool<element, 4> pool;
+
+	auto first = pool.allocate();
+	element* ptr = &pool[first];
+	ptr->value = 42;
+
+	for (int i = 0; i < 100; ++i) {
+		pool.allocate();
+	}
+
+	ASSERT_EQ(ptr, &pool[first]);
+	ASSERT_EQ(42, pool[first].value);
+	ASSERT_EQ(first, pool.index_of(ptr));
+	ASSERT_EQ(57, pool.index_of(&pool[57]));
+
+	element outside;
+	ASSERT_EQ(-1, pool.index_of(&outside));
+}
+
+TEST(ChunkedPoolTest, indexMemberIsMaintained)
+{
+	chunked_pool<indexed_element, 4, &indexed_element::pool_index> pool;
+
+	for (int i = 0; i < 10; ++i) {
+		ASSERT_EQ(i, pool.allocate());
+		ASSERT_EQ(i, pool[i].pool_index);
+		ASSERT_EQ(i, pool.index_of(&pool[i]));
+	}
+
+	// Slots which were not handed out yet know their index as well
+	ASSERT_EQ(11, pool.index_of(&pool[11]));
+
+	pool.free(3);
+	ASSERT_EQ(3, pool.allocate());
+	ASSERT_EQ(3, pool.index_of(&pool[3]));
+
+	indexed_element outside;
+	ASSERT_EQ(-1, pool.index_of(&outside));
+	outside.pool_index = 2;
+	ASSERT_EQ(-1, pool.index_of(&outside));
+}
+
+TEST(ChunkedPoolTest, freedSlotsAreReused)
+{
+	chunked_pool<element, 4> pool;
+
+	for (int i = 0; i < 4; ++i) {
+		pool.allocate();
+	}
+	pool.free(2);
+	ASSERT_FALSE(pool.in_use(2));
+	ASSERT_EQ(3, pool.size());
+
+	ASSERT_EQ(2, pool.allocate());
+	ASSERT_EQ(4, pool.capacity());
+}
+
+TEST(ChunkedPoolTest, handlesDetectStaleSlots)
+{
+	chunked_pool<element, 4> pool;
+
+	auto index = pool.allocate();
+	auto h     = pool.handle(index);
+	ASSERT_TRUE(h.isValid());
+	ASSERT_EQ(&pool[index], pool.get(h));
+
+	pool.free(index);
+	ASSERT_EQ(nullptr, pool.get(h));
+
+	// Same slot but a different generation
+	ASSERT_EQ(index, pool.allocate());
+	ASSERT_EQ(nullptr, pool.get(h));
+	ASSERT_NE(h, pool.handle(index));
+
+	auto current = pool.handle(index);
+	pool.clear();
+	ASSERT_EQ(0, pool.capacity());
+
+	ASSERT_EQ(index, pool.allocate());
+	ASSERT_EQ(nullptr, pool.get(current));
+
+	ASSERT_EQ(nullptr, pool.get(pool_handle()));
+}
+
+TEST(ChunkedPoolTest, usedListIsDense)
+{
+	chunked_pool<element, 4> pool;
+
+	for (int i = 0; i < 10; ++i) {
+		pool.allocate();
+	}
+	pool.free(0);
+	pool.free(5);
+	pool.free(9);
+
+	auto used = pool.used();
+	std::sort(used.begin(), used.end());
+
+	SCP_vector<int> expected = {1, 2, 3, 4, 6, 7, 8};
+	ASSERT_EQ(expected, used);
+}
+
+TEST(ChunkedPoolTest, createAndDestroyManyObjects)
+{
+	chunked_pool<element> pool;
+	SCP_vector<pool_handle> live;
+	SCP_vector<pool_handle> dead;
+
+	std::mt19937 gen(1234);
+
+	const int num_objects = 50000;
+
+	// Fill the pool past the old fixed limits and destroy a random half of the objects
+	for (int i = 0; i < num_objects; ++i) {
+		auto index = pool.allocate();
+		pool[index].objnum = i;
+		live.push_back(pool.handle(index));
+	}
+	ASSERT_EQ(num_objects, pool.size());
+
+	std::shuffle(live.begin(), live.end(), gen);
+	for (int i = 0; i < num_objects / 2; ++i) {
+		pool.free(live.back().index);
+		dead.push_back(live.back());
+		live.pop_back();
+	}
+
+	// Recreating the destroyed objects must not need more memory
+	auto capacity = pool.capacity();
+	for (int i = 0; i < num_objects / 2; ++i) {
+		auto index = pool.allocate();
+		pool[index].objnum = num_objects + i;
+		live.push_back(pool.handle(index));
+	}
+	ASSERT_EQ(capacity, pool.capacity());
+	ASSERT_EQ(num_objects, pool.size());
+	ASSERT_EQ(static_cast<size_t>(num_objects), pool.used().size());
+
+	for (const auto& h : live) {
+		ASSERT_NE(nullptr, pool.get(h));
+	}
+	for (const auto& h : dead) {
+		ASSERT_EQ(nullptr, pool.get(h));
+	}
+
+	// Destroy everything through the dense list
+	while (pool.size() > 0) {
+		pool.free(pool.used().back());
+	}
+	for (const auto& h : live) {
+		ASSERT_EQ(nullptr, pool.get(h));
+	}
+
+	pool.clear();
+	ASSERT_EQ(0, pool.capacity());
+}
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include "utils/radix_sort.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+
+using namespace util;
+
+namespace {
+struct keyed_value {
+	std::uint64_t key;
+	int index;
+};
+
+std::uint64_t get_key(const keyed_value& value) { return value.key; }
+
+SCP_vector<keyed_value> random_values(size_t count, std::uint64_t key_mask)
+{
+	std::mt19937_64 gen(1234);
+
+	SCP_vector<keyed_value> values;
+	for (size_t i = 0; i < count; ++i) {
+		values.push_back({gen() & key_mask, static_cast<int>(i)});
+	}
+	return values;
+}
+
+void check_matches_stable_sort(SCP_vector<keyed_value> values)
+{
+	auto expected = values;
+	std::stable_sort(expected.begin(), expected.end(),
+		[](const keyed_value& a, const keyed_value& b) { return a.key < b.key; });
+
+	SCP_vector<keyed_value> scratch;
+	radix_sort(values, scratch, get_key);
+
+	ASSERT_EQ(expected.size(), values.size());
+	for (size_t i = 0; i < values.size(); ++i) {
+		ASSERT_EQ(expected[i].key, values[i].key);
+		ASSERT_EQ(expected[i].index, values[i].index);
+	}
+}
+} // namespace
+
+TEST(RadixSortTests, emptyAndSingle)
+{
+	SCP_vector<keyed_value> values;
+	SCP_vector<keyed_value> scratch;
+
+	radix_sort(values, scratch, get_key);
+	ASSERT_TRUE(values.empty());
+
+	values.push_back({42, 0});
+	radix_sort(values, scratch, get_key);
+	ASSERT_EQ((size_t)1, values.size());
+	ASSERT_EQ((std::uint64_t)42, values[0].key);
+}
+
+TEST(RadixSortTests, fullKeys) { check_matches_stable_sort(random_values(10000, ~static_cast<std::uint64_t>(0))); }
+
+TEST(RadixSortTests, stableWithDuplicates)
+{
+	// Only a few different keys so most values have the same key as another one
+	check_matches_stable_sort(random_values(10000, 0x0F000000000000F0));
+}
+
+TEST(RadixSortTests, identicalKeys)
+{
+	SCP_vector<keyed_value> values;
+	for (int i = 0; i < 100; ++i) {
+		values.push_back({7, i});
+	}
+	check_matches_stable_sort(values);
+}
+
+TEST(RadixSortTests, scratchIsReused)
+{
+	SCP_vector<keyed_value> scratch;
+
+	auto values = random_values(1000, 0xFFFF);
+	radix_sort(values, scratch, get_key);
+	ASSERT_TRUE(std::is_sorted(values.begin(), values.end(),
+		[](const keyed_value& a, const keyed_value& b) { return a.key < b.key; }));
+
+	// A smaller second sort must not leave stale values behind
+	values = random_values(10, 0xFFFF);
+	radix_sort(values, scratch, get_key);
+	ASSERT_EQ((size_t)10, values.size());
+	ASSERT_TRUE(std::is_sorted(values.begin(), values.end(),
+		[](const keyed_value& a, const keyed_value& b) { return a.key < b.key; }));
+}
+
+// Not run by default. Run with --gtest_also_run_disabled_tests --gtest_filter=*sortCost to compare the sort with the
+// comparison sort the model draw list used before.
+TEST(RadixSortTests, DISABLED_sortCost)
+{
+	// Not a real benchmark but it shows the difference for the number of draws of a busy scene. The comparison sort has
+	// to look up a separate record for every comparison the same way the model draw list used to.
+	const size_t num_draws = 20000;
+
+	struct draw_record {
+		uint shader;
+		int vertex_buffer;
+		int textures[8];
+	};
+
+	std::mt19937 gen(4321);
+	SCP_vector<draw_record> records(num_draws);
+	for (auto& record : records) {
+		record.shader        = gen() % 8;
+		record.vertex_buffer = static_cast<int>(gen() % 64);
+		for (auto& texture : record.textures) {
+			texture = static_cast<int>(gen() % 256);
+		}
+	}
+
+	auto measure = [&](const char* label, void (*sort)(const SCP_vector<draw_record>&)) {
+		const auto start = std::chrono::high_resolution_clock::now();
+
+		sort(records);
+
+		const auto end = std::chrono::high_resolution_clock::now();
+		const auto ns  = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+		std::cout << label << ": " << ns / 1000 << " us for " << num_draws << " draws" << std::endl;
+	};
+
+	measure("Comparison sort", [](const SCP_vector<draw_record>& draws) {
+		SCP_vector<int> indices;
+		for (size_t i = 0; i < draws.size(); ++i) {
+			indices.push_back(static_cast<int>(i));
+		}
+
+		std::sort(indices.begin(), indices.end(), [&draws](int a, int b) {
+			const auto& draw_a = draws[a];
+			const auto& draw_b = draws[b];
+			if (draw_a.shader != draw_b.shader) {
+				return draw_a.shader < draw_b.shader;
+			}
+			if (draw_a.vertex_buffer != draw_b.vertex_buffer) {
+				return draw_a.vertex_buffer < draw_b.vertex_buffer;
+			}
+			for (size_t i = 0; i < 8; ++i) {
+				if (draw_a.textures[i] != draw_b.textures[i]) {
+					return draw_a.textures[i] < draw_b.textures[i];
+				}
+			}
+			return false;
+		});
+
+		ASSERT_EQ(draws.size(), indices.size());
+	});
+	measure("Radix sort", [](const SCP_vector<draw_record>& draws) {
+		SCP_vector<keyed_value> keys;
+		SCP_vector<keyed_value> scratch;
+		for (size_t i = 0; i < draws.size(); ++i) {
+			const auto& draw = draws[i];
+			auto key         = (static_cast<std::uint64_t>(draw.shader) << 40) |
+			           (static_cast<std::uint64_t>(draw.vertex_buffer) << 24) |
+			           (static_cast<std::uint64_t>(draw.textures[0]) << 8);
+			keys.push_back({key, static_cast<int>(i)});
+		}
+
+		radix_sort(keys, scratch, get_key);
+
+		ASSERT_EQ(draws.size(), keys.size());
+	});
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include "utils/run_arena.h"
+
+using namespace util;
+
+namespace {
+struct element {
+	int parent = -1;
+	int index  = 0;
+};
+} // namespace
+
+TEST(RunArenaTest, runsAreConsecutive)
+{
+	run_arena<element, 16> arena;
+	ASSERT_EQ(nullptr, arena.allocate(0));
+	ASSERT_EQ(0, arena.allocated());
+
+	auto first  = arena.allocate(5);
+	auto second = arena.allocate(7);
+	ASSERT_EQ(16, arena.allocated());
+	ASSERT_EQ(12, arena.in_use());
+
+	// Both runs come from the same block, one after the other
+	ASSERT_EQ(first + 5, second);
+
+	// Value initialized
+	ASSERT_EQ(-1, second[6].parent);
+}
+
+TEST(RunArenaTest, largeRunsGetTheirOwnBlock)
+{
+	run_arena<element, 16> arena;
+
+	arena.allocate(10);
+	auto large = arena.allocate(40);
+	ASSERT_EQ(56, arena.allocated());
+
+	for (int i = 0; i < 40; ++i) {
+		large[i].index = i;
+	}
+	ASSERT_EQ(39, large[39].index);
+}
+
+TEST(RunArenaTest, freedRunsAreReused)
+{
+	run_arena<element, 16> arena;
+
+	auto first = arena.allocate(6);
+	arena.allocate(6);
+	arena.free(first, 6);
+	ASSERT_EQ(6, arena.in_use());
+
+	// A different length does not fit into the freed run
+	auto other = arena.allocate(3);
+	ASSERT_NE(first, other);
+
+	ASSERT_EQ(first, arena.allocate(6));
+	ASSERT_EQ(15, arena.in_use());
+	ASSERT_EQ(16, arena.allocated());
+}
+
+TEST(RunArenaTest, reserveKeepsRunsTogether)
+{
+	run_arena<element, 16> arena;
+
+	arena.allocate(10);
+	arena.reserve(30);
+	ASSERT_EQ(46, arena.allocated());
+
+	// Everything that was reserved comes out of the new block without gaps
+	auto first  = arena.allocate(12);
+	auto second = arena.allocate(12);
+	auto third  = arena.allocate(6);
+	ASSERT_EQ(first + 12, second);
+	ASSERT_EQ(second + 12, third);
+	ASSERT_EQ(46, arena.allocated());
+
+	arena.clear();
+	ASSERT_EQ(0, arena.allocated());
+	ASSERT_EQ(0, arena.in_use());
+}
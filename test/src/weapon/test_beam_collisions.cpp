@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include "math/vecmat.h"
+#include "weapon/beam.h"
+
+namespace {
+void init_beam(beam& b)
+{
+	b.last_start           = vm_vec_new(0.0f, 0.0f, 0.0f);
+	b.last_shot            = vm_vec_new(0.0f, 0.0f, 1000.0f);
+	b.beam_collide_width   = 10.0f;
+	b.current_width_factor = 1.0f;
+	b.f_collision_count    = 0;
+	b.stop_dist            = -1.0f;
+}
+
+beam_collision* record(beam& b, int objnum, float hit_dist, bool stops, bool exit_flag = false)
+{
+	mc_info cinfo;
+	cinfo.hit_dist = hit_dist;
+	return beam_record_frame_collision(&b, objnum, &cinfo, -1, exit_flag, stops);
+}
+
+bool behind_stop(const beam& b, float z, float radius)
+{
+	vec3d pos = vm_vec_new(0.0f, 0.0f, z);
+	return beam_sphere_behind_stop(&b, &pos, radius);
+}
+} // namespace
+
+TEST(BeamCollisionTest, stopsAtFirstBlockingObject)
+{
+	beam b;
+	init_beam(b);
+
+	// nothing is skipped before anything stopped the beam
+	ASSERT_FALSE(behind_stop(b, 900.0f, 10.0f));
+
+	ASSERT_NE(nullptr, record(b, 1, 0.6f, true));
+	ASSERT_FLOAT_EQ(600.0f, b.stop_dist);
+
+	// a nearer blocking object moves the stop, one behind it or one which doesn't block doesn't
+	ASSERT_NE(nullptr, record(b, 2, 0.3f, true));
+	ASSERT_FLOAT_EQ(300.0f, b.stop_dist);
+	ASSERT_NE(nullptr, record(b, 3, 0.1f, false));
+	ASSERT_NE(nullptr, record(b, 4, 0.5f, true));
+	ASSERT_FLOAT_EQ(300.0f, b.stop_dist);
+	ASSERT_EQ(4, b.f_collision_count);
+
+	// objects entirely behind the stop are skipped, anything reaching in front of it is not
+	ASSERT_TRUE(behind_stop(b, 600.0f, 50.0f));
+	ASSERT_FALSE(behind_stop(b, 320.0f, 50.0f));
+	ASSERT_FALSE(behind_stop(b, 100.0f, 10.0f));
+
+	// the beam radius counts as well
+	ASSERT_FALSE(behind_stop(b, 310.0f, 4.0f));
+}
+
+TEST(BeamCollisionTest, fullListKeepsNearestCollisions)
+{
+	beam b;
+	init_beam(b);
+
+	for (int i = 0; i < MAX_FRAME_COLLISIONS; ++i) {
+		record(b, i, 0.05f * (i + 1), false, true);
+	}
+	ASSERT_EQ(MAX_FRAME_COLLISIONS, b.f_collision_count);
+	ASSERT_FLOAT_EQ(-1.0f, b.stop_dist);
+
+	// farther than everything recorded, dropped
+	ASSERT_EQ(nullptr, record(b, 100, 0.9f, true));
+	ASSERT_FLOAT_EQ(-1.0f, b.stop_dist);
+
+	// replaces the farthest one
+	auto bc = record(b, 101, 0.2f, true);
+	ASSERT_NE(nullptr, bc);
+	ASSERT_EQ(101, bc->c_objnum);
+	ASSERT_EQ(MAX_FRAME_COLLISIONS, b.f_collision_count);
+	ASSERT_FLOAT_EQ(200.0f, b.stop_dist);
+	for (int i = 0; i < b.f_collision_count; ++i) {
+		ASSERT_NE(MAX_FRAME_COLLISIONS - 1, b.f_collisions[i].c_objnum);
+	}
+}
+
+TEST(BeamCollisionTest, droppingStopperClearsStop)
+{
+	beam b;
+	init_beam(b);
+
+	// the blocking object is the farthest collision
+	for (int i = 0; i < MAX_FRAME_COLLISIONS - 1; ++i) {
+		record(b, i, 0.05f * (i + 1), false, true);
+	}
+	record(b, 50, 0.8f, true);
+	ASSERT_FLOAT_EQ(800.0f, b.stop_dist);
+
+	// it gets dropped for a nearer collision which doesn't block the beam, so nothing may be skipped anymore
+	ASSERT_NE(nullptr, record(b, 51, 0.6f, false));
+	ASSERT_FLOAT_EQ(-1.0f, b.stop_dist);
+	ASSERT_FALSE(behind_stop(b, 900.0f, 10.0f));
+
+	// the stop comes from the remaining blocking collisions
+	record(b, 52, 0.4f, true);
+	record(b, 53, 0.3f, false);
+	ASSERT_FLOAT_EQ(400.0f, b.stop_dist);
+}
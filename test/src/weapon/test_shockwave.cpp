@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include "math/vecmat.h"
+#include "weapon/shockwave.h"
+
+#include <random>
+
+TEST(ShockwaveTest, boxReachCoversBox)
+{
+	// weapon_area_calc_damage() measures to the bounding box so no point of the box may be further away than the reach,
+	// whichever way the object is rotated
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> extent(0.0f, 500.0f);
+	std::uniform_real_distribution<float> fraction(0.0f, 1.0f);
+
+	for (int i = 0; i < 1000; ++i) {
+		vec3d mins = vm_vec_new(-extent(gen), -extent(gen), -extent(gen));
+		vec3d maxs = vm_vec_new(extent(gen), extent(gen), extent(gen));
+		float radius = extent(gen);
+
+		float reach = shockwave_box_reach(&mins, &maxs, radius);
+		ASSERT_GE(reach, radius);
+
+		vec3d point;
+		for (int axis = 0; axis < 3; ++axis) {
+			point.a1d[axis] = mins.a1d[axis] + (maxs.a1d[axis] - mins.a1d[axis]) * fraction(gen);
+		}
+		ASSERT_LE(vm_vec_mag(&point), reach);
+	}
+
+	// a long thin model reaches much further than a sphere with its radius
+	vec3d mins = vm_vec_new(-10.0f, -10.0f, -400.0f);
+	vec3d maxs = vm_vec_new(10.0f, 10.0f, 100.0f);
+	ASSERT_GE(shockwave_box_reach(&mins, &maxs, 50.0f), 400.0f);
+}
+
+TEST(ShockwaveTest, findTargetsMatchesDistanceTest)
+{
+	std::mt19937 gen(4321);
+	std::uniform_real_distribution<float> coord(-5000.0f, 5000.0f);
+	std::uniform_real_distribution<float> reach(1.0f, 800.0f);
+
+	SCP_vector<shockwave_target> targets(500);
+	float max_reach = 0.0f;
+	for (int i = 0; i < (int)targets.size(); ++i) {
+		auto& target  = targets[i];
+		target.objnum = i;
+		target.order  = (i * 7919) % (int)targets.size();
+		target.pos    = vm_vec_new(coord(gen), coord(gen), coord(gen));
+		target.reach  = reach(gen);
+		max_reach     = MAX(max_reach, target.reach);
+	}
+	std::sort(targets.begin(), targets.end(), [](const shockwave_target& a, const shockwave_target& b) {
+		return a.pos.xyz.x < b.pos.xyz.x;
+	});
+
+	SCP_vector<const shockwave_target*> hits;
+	for (int i = 0; i < 100; ++i) {
+		vec3d pos   = vm_vec_new(coord(gen), coord(gen), coord(gen));
+		float range = reach(gen) * 2.0f;
+
+		shockwave_find_targets(targets, max_reach, &pos, range, hits);
+
+		// every target whose reach overlaps the range has to be found exactly once, in object list order
+		SCP_vector<const shockwave_target*> expected;
+		for (const auto& target : targets) {
+			if (vm_vec_dist(&target.pos, &pos) < range + target.reach) {
+				expected.push_back(&target);
+			}
+		}
+		std::sort(expected.begin(), expected.end(), [](const shockwave_target* a, const shockwave_target* b) {
+			return a->order < b->order;
+		});
+
+		ASSERT_EQ(expected, hits);
+	}
+}
+
+TEST(ShockwaveTest, findTargetsUsesReach)
+{
+	// A ship whose center is beyond the shockwave radius plus its sphere radius but whose bounding box reaches into the
+	// shockwave
+	vec3d mins = vm_vec_new(-10.0f, -10.0f, -300.0f);
+	vec3d maxs = vm_vec_new(10.0f, 10.0f, 300.0f);
+
+	SCP_vector<shockwave_target> targets(1);
+	targets[0].objnum = 0;
+	targets[0].order  = 0;
+	targets[0].pos    = vm_vec_new(400.0f, 0.0f, 0.0f);
+	targets[0].reach  = shockwave_box_reach(&mins, &maxs, 50.0f);
+
+	SCP_vector<const shockwave_target*> hits;
+	shockwave_find_targets(targets, targets[0].reach, &vmd_zero_vector, 150.0f, hits);
+	ASSERT_EQ(1u, hits.size());
+
+	shockwave_find_targets(targets, targets[0].reach, &vmd_zero_vector, 50.0f, hits);
+	ASSERT_TRUE(hits.empty());
+}
@@ -0,0 +1,19 @@
+
+if not invocation then
+    invocation = 0
+end
+invocation = invocation + 1
+
+local assert = require("assert")
+
+if invocation == 1 then
+    assert.equals(1, #hv.Globals)
+    assert.equals("Lazy", hv.Globals[1])
+
+    assert.equals(42, hv.Lazy)
+    -- Reading the value again must use the already converted value
+    assert.equals(42, hv.Lazy)
+elseif invocation == 2 then
+    assert.equals(0, #hv.Globals)
+    assert.equals(nil, hv.Lazy)
+end